@@ -0,0 +1,6 @@
+static int leaf(int x){ volatile char b[40]; b[0]=x; return b[0]; }
+int mid(int x){ volatile char b[20]; b[1]=x; return leaf(x)+b[1]; }
+void (*fp)(void);
+void tgt(void){ volatile char b[100]; b[0]=1; }
+int main(void){ fp(); return mid(3); }
+void __vector_1(void){ volatile char c[10]; c[0]=mid(1); }
@@ -0,0 +1,60 @@
+/* -----------------------------------------------------
+                        bench.c
+
+    Messrahmen fuer die Benchmarks (siehe bench.h)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+
+#ifndef F_CPU
+  #define F_CPU  8000000ul
+#endif
+
+static uint32_t start_cycles;
+static uint32_t start_usibits;
+static uint8_t  clk_bits = 0;                       // 0 = keine Taktleitung beobachtet
+
+/* -------------------------------------------------------
+                      bench_clock
+
+     Pegelwechsel von addr & mask zaehlen, ein Byte auf
+     dem Bus hat bitsperbyte Takte (I2C: 9)
+   ------------------------------------------------------- */
+void bench_clock(uint8_t addr, uint8_t mask, uint8_t bitsperbyte)
+{
+  host_watch(addr, mask);
+  clk_bits= bitsperbyte;
+}
+
+/* -------------------------------------------------------
+                      bench_begin
+   ------------------------------------------------------- */
+void bench_begin(void)
+{
+  host_sync();
+  start_cycles= host_cycles;
+  start_usibits= host_usibits;
+  host_edges= 0;
+}
+
+/* -------------------------------------------------------
+                      bench_end
+   ------------------------------------------------------- */
+void bench_end(const char *modul, const char *funktion, uint16_t anz)
+{
+  double cycles, bytes;
+
+  host_sync();
+  cycles= (double)(host_cycles - start_cycles) / anz;
+  if (clk_bits) bytes= (double)host_edges / 2.0 / clk_bits;
+          else bytes= (double)(host_usibits - start_usibits) / 8.0;
+  bytes /= anz;
+
+  printf("%s,%s,%lu,%u,%.1f,%.2f,%.0f\n", modul, funktion, (unsigned long)F_CPU, anz, cycles, bytes,
+         cycles > 0 ? bytes * F_CPU / cycles : 0.0);
+  fflush(stdout);
+}
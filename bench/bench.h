@@ -0,0 +1,75 @@
+/* -----------------------------------------------------
+                        bench.h
+
+    Messrahmen fuer die Benchmarks in bench/ (siehe
+    readme.txt). Gemessen wird mit der Registerebene des
+    Host-Builds (host/host_hal.h):
+
+      - virtuelle Takte je Aufruf (Registerzugriffe und
+        Wartezeiten, keine Rechenzeit)
+      - Bytes auf dem Bus je Aufruf: Pegelwechsel der
+        mit bench_clock angegebenen Taktleitung / 2 /
+        Bits je Byte, ohne bench_clock die ueber das USI
+        geschobenen Bits / 8
+      - Bytes auf dem Bus je Sekunde (aus den beiden
+        Werten und F_CPU)
+
+    Die Ergebnisse werden als CSV-Zeile auf stdout aus-
+    gegeben.
+
+    Mit BENCH_AVR (make size) wird dasselbe Programm fuer
+    den ATtiny44 uebersetzt: BENCH fuehrt dann nur die
+    Aufrufe aus, es wird nichts gemessen (Flash- und
+    Stackbedarf).
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_bench
+  #define in_bench
+
+  #include <stdint.h>
+
+  #if defined(BENCH_AVR)
+
+    #include <avr/io.h>
+
+    #define BENCH(modul, funktion, anz, aufruf)       \
+      {                                               \
+        uint16_t bench_i;                             \
+        for (bench_i= 0; bench_i< (anz); bench_i++)   \
+        {                                             \
+          aufruf;                                     \
+        }                                             \
+      }
+
+    #define bench_clock(addr, mask, bitsperbyte)
+    #define HOST_ADDR(reg)            0
+
+  #else
+
+    #include "host_hal.h"
+
+    /* -------------------------------------------------------
+       BENCH(modul, funktion, anz, aufruf)
+
+       fuehrt aufruf anz mal aus und gibt eine CSV-Zeile aus
+       ------------------------------------------------------- */
+    #define BENCH(modul, funktion, anz, aufruf)       \
+      {                                               \
+        uint16_t bench_i;                             \
+        bench_begin();                                \
+        for (bench_i= 0; bench_i< (anz); bench_i++)   \
+        {                                             \
+          aufruf;                                     \
+        }                                             \
+        bench_end(modul, funktion, anz);              \
+      }
+
+    void bench_clock(uint8_t addr, uint8_t mask, uint8_t bitsperbyte);    // Taktleitung bei Bitbanging
+    void bench_begin(void);
+    void bench_end(const char *modul, const char *funktion, uint16_t anz);
+
+  #endif
+
+#endif
@@ -0,0 +1,48 @@
+/* -----------------------------------------------------
+                     bench_i2c_sw.c
+
+    Benchmark i2c_sw (Bitbanging bzw. USI mit
+    I2C_USI_TWI). Ein simulierter Slave (host/host_i2c.c)
+    quittiert alle Bytes, damit i2c_write_buf den ganzen
+    Block sendet.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "i2c_sw.h"
+#if !defined(BENCH_AVR)
+  #include "host_i2c.h"
+#endif
+
+#if defined(I2C_USI_TWI)
+  #define MODUL   "i2c_sw_usi"
+#elif (I2C_BUS_HZ != 100000)
+  #define MODUL   "i2c_sw_400k"
+#else
+  #define MODUL   "i2c_sw"
+#endif
+
+#define SLAVE     0x78
+
+int main(void)
+{
+  static uint8_t buf[32];
+
+  #if !defined(BENCH_AVR)
+    host_i2c_attach(SLAVE, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+  #endif
+  i2c_master_init();
+  #if defined(I2C_USI_TWI)
+    bench_clock(HOST_ADDR(sclport), 1 << i2c_sclbitnr, 9);    // SCL: USITC toggelt PORTA4
+  #else
+    bench_clock(HOST_ADDR(sclddr), 1 << i2c_sclbitnr, 9);     // SCL: Open-Drain ueber DDR
+  #endif
+
+  i2c_start(SLAVE);
+  BENCH(MODUL, "i2c_write", 100, i2c_write(0x55));
+  i2c_stop();
+  BENCH(MODUL, "i2c_start+stop", 100, { i2c_start(SLAVE); i2c_stop(); });
+  BENCH(MODUL, "i2c_write_buf(32)", 10, i2c_write_buf(SLAVE, 0x40, buf, sizeof(buf)));
+  return 0;
+}
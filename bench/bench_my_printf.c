@@ -0,0 +1,39 @@
+/* -----------------------------------------------------
+                    bench_my_printf.c
+
+    Benchmark own_vfprintf (ueber own_fprintf) mit einer
+    Ausgabefunktion, die jedes Zeichen mit spi_out auf
+    den Bus schiebt: die Zeile zeigt die ausgegebenen
+    Bytes und die Takte fuer deren Ausgabe. Die Forma-
+    tierung selbst ist Rechenzeit und wird im Host-Build
+    nicht erfasst (siehe readme.txt).
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "my_printf.h"
+#include "usi_spi.h"
+
+static const char text[] PROGMEM = "Flash";
+
+void my_putchar(char c)
+{
+  GPIOR0= c;
+}
+
+static void sink(char c)
+{
+  spi_out(c);
+}
+
+int main(void)
+{
+  int16_t  v16 = -1234;
+  uint16_t u16 = 0xfb2e;                      // %x wie auf dem AVR 4-stellig (Host: int 32 Bit)
+  uint32_t v32 = 123456789;
+
+  spi_init();
+  BENCH("my_printf", "own_fprintf(%5d %lu %x %S) -> spi_out", 100, my_fprintf(sink, "%5d %lu %x %S", v16, v32, u16, text));
+  return 0;
+}
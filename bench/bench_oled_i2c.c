@@ -0,0 +1,60 @@
+/* -----------------------------------------------------
+                    bench_oled_i2c.c
+
+    Benchmark oled1306_i2c (I2C ueber i2c_sw), mit
+    oled_framebuffer = 1 (oled_fb) oled_flush nach einem
+    geaenderten Zeichen und fuer das ganze Fenster (8 x 2
+    Zeichen geaendert).
+    Ein simulierter Slave (host/host_i2c.c) quittiert
+    alle Bytes, sonst bricht i2c_write_buf in oled_flush
+    nach der Adresse ab.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "oled1306_i2c.h"
+#if !defined(BENCH_AVR)
+  #include "host_i2c.h"
+#endif
+
+#if (oled_framebuffer == 1)
+
+/* -------------------------------------------------------
+                      fill_window
+
+     schreibt alle Zeichen des Fensters neu (abwechselnd
+     zwei Zeichen, damit jedes Byte geaendert ist)
+   ------------------------------------------------------- */
+static void fill_window(uint8_t ch)
+{
+  uint8_t x, y;
+
+  for (y= 0; y< oled_fbwin_rows; y++)
+  {
+    gotoxy(oled_fbwin_x, oled_fbwin_y + y);
+    for (x= 0; x< oled_fbwin_cols; x++) oled_putchar(ch);
+  }
+}
+
+#endif
+
+int main(void)
+{
+  #if !defined(BENCH_AVR)
+    host_i2c_attach(ssd1306_addr, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+  #endif
+  ssd1306_init();
+  #if !defined(I2C_USI_TWI)
+    bench_clock(HOST_ADDR(sclddr), 1 << i2c_sclbitnr, 9);
+  #endif
+
+  #if (oled_framebuffer == 1)
+    BENCH("oled1306_i2c", "oled_putchar + oled_flush", 100, { gotoxy(0, 0); oled_putchar('A' + (bench_i & 1)); oled_flush(); });
+    BENCH("oled1306_i2c", "oled_flush (Fenster)",       10, { fill_window('A' + (bench_i & 1)); oled_flush(); });
+  #else
+    BENCH("oled1306_i2c", "oled_putchar", 100, { gotoxy(0, 0); oled_putchar('A'); });
+    BENCH("oled1306_i2c", "clrscr",         1, clrscr());
+  #endif
+  return 0;
+}
@@ -0,0 +1,33 @@
+/* -----------------------------------------------------
+                      bench_strip.c
+
+    Benchmark strip_render mit oled1306_spi (oled_strip-
+    out): ganzes Display (128 x 64, 8 Streifen) mit einer
+    Szene aus Linien, Rechteck und Text
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "oled1306_spi.h"
+#include "strip_render.h"
+
+static void scene(void)
+{
+  strip_rect(0, 0, 127, 63, 1);
+  strip_line(0, 0, 127, 63, 1);
+  strip_line(0, 63, 127, 0, 1);
+  strip_fillrect(40, 24, 87, 39, 2);
+  strip_prints(20, 28, "Streifen", 1);
+}
+
+int main(void)
+{
+  ssd1306_init();
+  strip_output= oled_stripout;
+  strip_draw= scene;
+
+  BENCH("strip_render", "strip_render",         1, strip_render());
+  BENCH("strip_render", "strip_renderrows(8)",  10, strip_renderrows(24, 31));
+  return 0;
+}
@@ -0,0 +1,72 @@
+/* -----------------------------------------------------
+                      bench_tft.c
+
+    Benchmark tftdisplay (USI-SPI)
+
+    Zum Vergleich vorher / nachher (Fensterfuellung mit
+    window_fill) enthaelt der Benchmark die fruehere
+    Fassung von clrscr (wrdata je Byte) und ein Rechteck
+    aus einzelnen putpixel-Aufrufen.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "tftdisplay.h"
+
+// in tftdisplay.c, nicht im Header
+void set_ram_address(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void wrdata(uint8_t data);
+
+/* -------------------------------------------------------
+                      clrscr_vorher
+
+     clrscr vor der Umstellung auf window_fill
+   ------------------------------------------------------- */
+static void clrscr_vorher(void)
+{
+  int      x,y;
+  uint8_t  colouthi, coloutlo;
+
+  set_ram_address(0,0,_xres-1,_yres-1);
+
+  colouthi = bkcolor >> 8;
+  coloutlo = bkcolor & 0xff;
+
+  dc_set();
+
+  for (y= 0; y< _yres; y++)
+  {
+    for (x= 0; x< _xres; x++)
+    {
+      wrdata(colouthi);
+      wrdata(coloutlo);
+    }
+  }
+}
+
+/* -------------------------------------------------------
+                     fillrect_vorher
+
+     Rechteck ohne fillrect: ein putpixel je Punkt
+   ------------------------------------------------------- */
+static void fillrect_vorher(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  int x, y;
+
+  for (y= y1; y<= y2; y++)
+    for (x= x1; x<= x2; x++) putpixel(x, y, color);
+}
+
+int main(void)
+{
+  lcd_init();
+
+  BENCH("tftdisplay", "putpixel",   1000, putpixel(bench_i & 0x7f, 20, 0xf800));
+  BENCH("tftdisplay", "lcd_putchar", 100, { gotoxy(0, 0); lcd_putchar('A'); });
+  BENCH("tftdisplay", "fillrect(32x32) vorher", 10, fillrect_vorher(0, 0, 31, 31, 0x07e0));
+  BENCH("tftdisplay", "fillrect(32x32)",  10, fillrect(0, 0, 31, 31, 0x07e0));
+  BENCH("tftdisplay", "clrscr vorher",     1, clrscr_vorher());
+  BENCH("tftdisplay", "clrscr",            1, clrscr());
+  return 0;
+}
@@ -0,0 +1,20 @@
+/* -----------------------------------------------------
+                     bench_tm16xx.c
+
+    Benchmark tm16xx (Bitbanging)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "tm16xx.h"
+
+int main(void)
+{
+  tm16_init();
+  bench_clock(HOST_ADDR(clkddr), 1 << bb_clkbitnr, 9);
+
+  BENCH("tm16xx", "tm16_setdez",  100, tm16_setdez(1234, 0));
+  BENCH("tm16xx", "tm16_setbmp",  100, tm16_setbmp(0, 0x55));
+  return 0;
+}
@@ -0,0 +1,24 @@
+/* -----------------------------------------------------
+                     bench_usi_spi.c
+
+    Benchmark usi_spi (Bytes aus dem RAM, 16-Bit Farb-
+    flaeche mit spi_fill16)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bench.h"
+#include "usi_spi.h"
+
+int main(void)
+{
+  static uint8_t buf[64];
+
+  spi_init();
+
+  BENCH("usi_spi", "spi_out",              100, spi_out(0x55));
+  BENCH("usi_spi", "spi_outbuf(64)",        10, spi_outbuf(buf, sizeof(buf)));
+  BENCH("usi_spi", "spi_fill16(32)",        10, spi_fill16(0xf800, 32));
+  BENCH("usi_spi", "spi_fill16(1024)",       1, spi_fill16(0xf800, 1024));
+  return 0;
+}
@@ -0,0 +1,34 @@
+/* -----------------------------------------------------
+                      size_font.c
+
+    Minimalprogramm fuer den Flashvergleich von
+    font8x8.c und dem komprimierten Zeichensatz
+    zfont8x8.c mit Decoder zfont.c (make size, siehe
+    readme.txt). Alle Bytes eines Zeichens werden ueber
+    font8x8_byte gelesen und auf GPIOR0 ausgegeben:
+
+      SIZE_NONE               : ohne Zeichensatz
+      font8x8_compressed = 0  : font8x8.c
+      font8x8_compressed = 1  : zfont8x8.c + zfont.c
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <stdint.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "font8x8.h"
+
+volatile uint8_t ch = 'A';
+
+int main(void)
+{
+#if defined(SIZE_NONE)
+  GPIOR0= ch;
+#else
+  uint8_t i;
+
+  for (i= 0; i< 8; i++) GPIOR0= font8x8_byte(ch, i);
+#endif
+  while(1);
+}
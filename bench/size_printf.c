@@ -0,0 +1,51 @@
+/* -----------------------------------------------------
+                     size_printf.c
+
+    Minimalprogramm fuer den Flashvergleich von
+    my_printf und avr-libc (make size, siehe readme.txt).
+    Alle Varianten formatieren dieselben Werte in einen
+    RAM-Puffer und geben das erste Zeichen auf PORTA aus,
+    damit nichts wegoptimiert wird (my_printf gibt %x
+    in Grossbuchstaben aus, avr-libc entspricht %X):
+
+      SIZE_NONE : ohne Formatierung (Grundbedarf)
+      SIZE_LIBC : sprintf_P aus avr-libc (vfprintf)
+      sonst     : my_sprintf (own_vfprintf)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <stdint.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#if defined(SIZE_LIBC)
+  #include <stdio.h>
+#elif !defined(SIZE_NONE)
+  #include "my_printf.h"
+
+  void my_putchar(char c)
+  {
+    GPIOR0= c;
+  }
+#endif
+
+static const char text[] PROGMEM = "Flash";
+
+volatile int16_t  v16 = -1234;
+volatile uint32_t v32 = 123456789;
+
+char buf[40];
+
+int main(void)
+{
+#if defined(SIZE_LIBC)
+  sprintf_P(buf, PSTR("%5d %lu %X %S"), v16, v32, v16, text);
+#elif defined(SIZE_NONE)
+  buf[0]= v16 + v32 + pgm_read_byte(&text[0]);
+#else
+  my_sprintf(buf, "%5d %lu %x %S", v16, v32, v16, text);
+#endif
+  PORTA= buf[0];
+  while(1);
+}
@@ -0,0 +1,563 @@
+/* ----------------------------------------------------------
+                         fontcomp.c
+
+     liest einen Zeichensatz (oder eine Bitmap) im Format
+     der Sourcedateien font5x7.c, font8x8.c, font8x8h.c und
+     erzeugt eine Sourcedatei mit einem komprimierten
+     Zeichensatz fuer zfont.c (Format siehe zfont.h)
+
+     Mit -a wird statt dessen ein Graustufen-Zeichensatz
+     (aafont_t, lcd_putchar_aa in tftdisplay.c) erzeugt:
+     die Zeichen (zeilenweise, 8 Pixel je Byte wie
+     font8x8.c) werden mit einem Flaechenfilter auf die
+     mit -x / -y angegebene Groesse skaliert.
+
+     Auf stderr wird ausgegeben, wieviele Bytes gespart
+     werden und wieviele Taktzyklen (geschaetzt) das
+     Dekodieren eines Zeichens benoetigt.
+
+     17.10.2026    agent
+   ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+
+#define MAXBYTES        65536
+#define MAXGLYPHS       256
+#define MAXBLOCKS       256             // zfont_getbyte: Blocknummer 8 Bit
+
+/* ----------------------------------------------------------
+   geschaetzte Taktzyklen von zfont_getbyte (avr-gcc -Os),
+   ermittelt durch Abzaehlen der Befehle:
+
+     CYC_CALL   : Aufruf, Vergleich mit dem gemerkten Block,
+                  Maskenbyte lesen
+     CYC_BIT    : je Maskenbit bis zum gesuchten Byte
+     CYC_LIT    : je gelesenem Literal
+     CYC_SEEK   : Suche ueber den Index
+     CYC_SKIP   : je uebersprungenem Block (ohne Literale)
+   ---------------------------------------------------------- */
+#define CYC_CALL        30
+#define CYC_BIT         7
+#define CYC_LIT         3
+#define CYC_SEEK        45
+#define CYC_SKIP        64
+#define CYC_PLAIN       5               // pgm_read_byte je Byte (unkomprimiert)
+
+/* ----------------------------------------------------------
+   Flashbedarf des Decoders zfont.o (einmal je Programm):
+   190 Bytes, uebersetzt fuer den ATtiny44 mit dem AVR-
+   Backend von LLVM (-Oz). Mit avr-gcc nachmessen: in
+   bench/ make size, Differenz font8x8_z - font8x8 (inkl.
+   Aufrufstelle)
+   ---------------------------------------------------------- */
+#define ZF_DECODER      190
+
+struct fontdata
+{
+  uint8_t  raw[MAXBYTES];             // unkomprimierte Bytes
+  int      anz;                       // Anzahl Bytes
+  int      bytes;                     // Bytes je Zeichen
+  int      glyphs;                    // Anzahl Zeichen
+  int      first;                     // erstes Zeichen
+};
+
+/* ----------------------------------------------------------
+                           readfile
+
+     liest die Datei vollstaendig in einen String
+   ---------------------------------------------------------- */
+char *readfile(const char *fname)
+{
+  FILE *f;
+  long len;
+  char *buf;
+
+  f= fopen(fname, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  len= ftell(f);
+  fseek(f, 0, SEEK_SET);
+  buf= malloc(len+1);
+  if (fread(buf, 1, len, f) != (size_t)len) len= 0;
+  buf[len]= 0;
+  fclose(f);
+  return buf;
+}
+
+/* ----------------------------------------------------------
+                         stripcomments
+
+     ersetzt C- und C++ Kommentare sowie Praeprozessor-
+     zeilen durch Leerzeichen (bedingte Teile eines
+     Zeichensatzes werden also immer mitgenommen)
+   ---------------------------------------------------------- */
+void stripcomments(char *s)
+{
+  int linestart= 1;
+
+  while (*s)
+  {
+    if (*s == '\n') linestart= 1;
+    else if (!isspace((unsigned char)*s))
+    {
+      if ((*s == '#') && (linestart))
+      {
+        while (*s && (*s != '\n')) *s++= ' ';
+        continue;
+      }
+      linestart= 0;
+    }
+
+    if ((s[0] == '/') && (s[1] == '/'))
+    {
+      while (*s && (*s != '\n')) *s++= ' ';
+    }
+    else if ((s[0] == '/') && (s[1] == '*'))
+    {
+      *s++= ' '; *s++= ' ';
+      while (*s && !((s[0] == '*') && (s[1] == '/'))) *s++= ' ';
+      if (*s) { *s++= ' '; *s++= ' '; }
+    }
+    else if (*s == '\'')                      // Zeichenkonstanten ueberspringen
+    {
+      s++;
+      if (*s == '\\') s++;
+      if (*s) s++;
+      if (*s == '\'') s++;
+    }
+    else s++;
+  }
+}
+
+/* ----------------------------------------------------------
+                           parsefont
+
+     liest die Werte der ersten Arrayinitialisierung. Jede
+     innerste {}-Gruppe ist ein Zeichen, ein flaches Array
+     (Bitmap) ist ein einziges "Zeichen".
+
+     Rueckgabe: 0 = Fehler
+   ---------------------------------------------------------- */
+int parsefont(char *s, struct fontdata *fd)
+{
+  int  depth, cnt, grp;
+  long v;
+  char *end;
+
+  s= strchr(s, '=');
+  if (!s) return 0;
+  s= strchr(s, '{');
+  if (!s) return 0;
+
+  fd->anz= 0;
+  fd->bytes= 0;
+  depth= 0;
+  cnt= 0;
+  grp= 0;
+
+  while (*s)
+  {
+    if (*s == '{')
+    {
+      depth++;
+      cnt= 0;
+      s++;
+    }
+    else if (*s == '}')
+    {
+      if (cnt)                                // Ende einer Zeichengruppe
+      {
+        if (fd->bytes == 0) fd->bytes= cnt;
+        if (cnt != fd->bytes)
+        {
+          fprintf(stderr, "\n Zeichen %d hat %d statt %d Bytes\n", grp, cnt, fd->bytes);
+          return 0;
+        }
+        grp++;
+      }
+      cnt= 0;
+      depth--;
+      s++;
+      if (depth == 0) break;
+    }
+    else if (isalpha((unsigned char)*s) || (*s == '_'))
+    {
+      while (isalnum((unsigned char)*s) || (*s == '_')) s++;   // Bezeichner ueberspringen
+    }
+    else if (isdigit((unsigned char)*s))
+    {
+      v= strtol(s, &end, 0);
+      if ((v < 0) || (v > 255) || (fd->anz >= MAXBYTES))
+      {
+        fprintf(stderr, "\n ungueltiger Wert oder zu viele Bytes\n");
+        return 0;
+      }
+      fd->raw[fd->anz++]= v;
+      cnt++;
+      s= end;
+    }
+    else s++;
+  }
+
+  if ((fd->bytes == 0) || (fd->anz % fd->bytes))
+  {
+    fprintf(stderr, "\n Anzahl Bytes (%d) passt nicht zu %d Bytes je Zeichen\n", fd->anz, fd->bytes);
+    return 0;
+  }
+  fd->glyphs= fd->anz / fd->bytes;
+  if (fd->first + fd->glyphs > MAXGLYPHS)
+  {
+    fprintf(stderr, "\n zu viele Zeichen\n");
+    return 0;
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------
+                           compress
+
+     komprimiert die Bytes in Bloecken zu 8 Bytes (Format
+     siehe zfont.h), traegt den Beginn jedes 8. Blocks in
+     index ein und schaetzt fuer jeden Block die Takte,
+     um seine 8 Bytes der Reihe nach zu lesen
+
+     Rueckgabe: Groesse der Daten in Bytes
+   ---------------------------------------------------------- */
+long compress(struct fontdata *fd, uint8_t *data, uint16_t *index, long *cycles)
+{
+  int  blocks, n, k, i, pos, lits;
+  long len, mpos;
+  uint8_t b, prev, mask;
+  long skip[MAXBLOCKS];
+
+  blocks= (fd->anz + 7) / 8;
+  len= 0;
+
+  for (n= 0; n< blocks; n++)
+  {
+    if ((n & 7) == 0) index[n >> 3]= len;
+    mpos= len++;
+    mask= 0;
+    prev= 0;
+    lits= 0;
+    for (k= 0; k< 8; k++)                     // Reihenfolge 7, 0, 1 .. 6
+    {
+      pos= n * 8 + ((k + 7) & 7);
+      b= (pos < fd->anz) ? fd->raw[pos] : prev;   // letzter Block: fehlende Bytes wiederholen
+      if (b == prev) mask |= 1 << k;
+      else
+      {
+        data[len++]= b;
+        lits++;
+      }
+      prev= b;
+    }
+    data[mpos]= mask;
+    skip[n]= CYC_SKIP + lits * CYC_LIT;
+
+    // Byte i liest die Maskenbits 0 .. (i+1) & 7
+    cycles[n]= CYC_SEEK;
+    for (i= 0; i< 8; i++)
+    {
+      cycles[n] += CYC_CALL;
+      for (k= 0; k <= ((i + 1) & 7); k++)
+      {
+        cycles[n] += CYC_BIT;
+        if (!(mask & (1 << k))) cycles[n] += CYC_LIT;
+      }
+    }
+  }
+
+  // Suche: vorhergehende Bloecke seit dem letzten Indexeintrag
+  for (n= 0; n< blocks; n++)
+    for (i= n & ~7; i< n; i++) cycles[n] += skip[i];
+
+  return len;
+}
+
+/* ----------------------------------------------------------
+                           aa_pixel
+
+     Graustufe (0..levels-1) des Zielpixels tx,ty eines auf
+     w x h Pixel skalierten Zeichens: Anteil der gesetzten
+     Quellpixel an der Flaeche, die das Zielpixel im Quell-
+     zeichen (8 x sh Pixel) ueberdeckt
+   ---------------------------------------------------------- */
+int aa_pixel(const uint8_t *glyph, int sh, int w, int h, int tx, int ty, int levels)
+{
+  double x0, x1, y0, y1, ox, oy, cov;
+  int    sx, sy;
+
+  x0= (double)tx * 8 / w;  x1= (double)(tx + 1) * 8 / w;
+  y0= (double)ty * sh / h; y1= (double)(ty + 1) * sh / h;
+
+  cov= 0.0;
+  for (sy= (int)y0; (sy < sh) && (sy < y1); sy++)
+  {
+    oy= ((sy + 1 < y1) ? sy + 1 : y1) - ((sy > y0) ? sy : y0);
+    for (sx= (int)x0; (sx < 8) && (sx < x1); sx++)
+    {
+      if (!(glyph[sy] & (0x80 >> sx))) continue;
+      ox= ((sx + 1 < x1) ? sx + 1 : x1) - ((sx > x0) ? sx : x0);
+      cov += ox * oy;
+    }
+  }
+  cov /= (x1 - x0) * (y1 - y0);
+  return (int)(cov * (levels - 1) + 0.5);
+}
+
+/* ----------------------------------------------------------
+                           aafont_out
+
+     gibt den Graustufen-Zeichensatz (Zeichen cfirst..clast,
+     bpp Bit je Pixel, w x h Pixel) als Sourcedatei aus
+
+     Rueckgabe: Groesse der Pixeldaten in Bytes
+   ---------------------------------------------------------- */
+long aafont_out(struct fontdata *fd, const char *name, const char *srcname,
+                int bpp, int w, int h, int cfirst, int clast)
+{
+  int  ch, x, y, rowbytes, shift, n;
+  long anz;
+  uint8_t b;
+  const uint8_t *glyph;
+
+  rowbytes= (w * bpp + 7) / 8;
+  anz= (long)(clast - cfirst + 1) * rowbytes * h;
+
+  printf("/* -------------------------------------------------");
+  printf("\n     %s.c", name);
+  printf("\n");
+  printf("\n     Graustufen-Zeichensatz fuer lcd_putchar_aa");
+  printf("\n     (tftdisplay.c, tft_aafont = %d), erzeugt mit", bpp);
+  printf("\n     fontcomp -n %s -a %d -x %d -y %d -c %d,%d %s", name, bpp, w, h, cfirst, clast, srcname);
+  printf("\n");
+  printf("\n     Zeichen  : %d..%d, %d x %d Pixel", cfirst, clast, w, h);
+  printf("\n     Groesse  : %ld Bytes", anz);
+  printf("\n   ------------------------------------------------- */");
+  printf("\n");
+  printf("\n#include \"tftdisplay.h\"");
+  printf("\n");
+  printf("\n// nur mit passendem tft_aafont (sonst fehlt %s beim Linken)", name);
+  printf("\n#if (tft_aafont == %d)", bpp);
+  printf("\n");
+  printf("\nstatic const uint8_t PROGMEM %s_bitmap[] = {", name);
+
+  for (ch= cfirst; ch <= clast; ch++)
+  {
+    glyph= &fd->raw[(ch - fd->first) * fd->bytes];
+    if (isprint(ch) && (ch != '\\')) printf("\n  // Ascii %d = '%c'", ch, ch);
+                                else printf("\n  // Ascii %d", ch);
+    for (y= 0; y< h; y++)
+    {
+      printf("\n  ");
+      b= 0; shift= 8; n= 0;
+      for (x= 0; x< w; x++)
+      {
+        shift -= bpp;
+        b |= aa_pixel(glyph, fd->bytes, w, h, x, y, 1 << bpp) << shift;
+        if (!shift)
+        {
+          printf("0x%.2x,", b);
+          n++;
+          b= 0; shift= 8;
+        }
+      }
+      if (n < rowbytes) printf("0x%.2x,", b);
+    }
+  }
+  printf("\n};");
+  printf("\n");
+  printf("\nconst aafont_t PROGMEM %s = { %d, %d, %d, %d, %s_bitmap };", name, w, h, cfirst, clast, name);
+  printf("\n");
+  printf("\n#endif");
+  printf("\n");
+
+  return anz;
+}
+
+/* ----------------------------------------------------------
+                           show_help
+     gibt Syntaxmeldung aus
+   ---------------------------------------------------------- */
+void help_show(void)
+{
+  printf("  \nfontcomp 0.12");
+  printf("  \n Syntax: fontcomp [Optionen] font.c > font_z.c");
+  printf("  \n    -n name      | Name des erzeugten Zeichensatzes (Standard: zfont)");
+  printf("  \n    -f value     | Code des ersten Zeichens (Standard: 32)");
+  printf("  \n    -a value     | Graustufen-Zeichensatz (aafont_t) mit value (2, 4)");
+  printf("  \n                 | Bit je Pixel erzeugen, Eingabe zeilenweise wie");
+  printf("  \n                 | font8x8.c");
+  printf("  \n    -x value     | -a: Zeichenbreite in Pixel (Standard: 12)");
+  printf("  \n    -y value     | -a: Zeichenhoehe in Pixel (Standard: 12)");
+  printf("  \n    -c von,bis   | -a: nur die Zeichen von..bis ausgeben");
+  printf("  \n    -h           | diese Anzeige (Help)");
+  printf("  \n");
+}
+
+/* ---------------------------------------------------------------------------
+                                    M A I N
+   --------------------------------------------------------------------------- */
+int main (int argc, char **argv)
+{
+  static struct fontdata  fd;
+  static uint8_t          data[MAXBYTES * 9 / 8 + 1];
+  static uint16_t         index[MAXBLOCKS / 8];
+  static long             cycles[MAXBLOCKS];
+
+  char  name[64] = "zfont";
+  char  *src;
+  int   c, g, blocks, idxanz;
+  int   aabits, aaw, aah, cfirst, clast;
+  long  len, csum, cmax, zsize;
+
+  fd.first= 32;
+  aabits= 0; aaw= 12; aah= 12;
+  cfirst= -1; clast= -1;
+
+  // Kommandozeile auswerten
+  opterr= 0;
+
+  while ((c = getopt (argc, argv, "hn:f:a:x:y:c:")) != -1)
+  {
+    switch (c)
+    {
+      case 'n' : strncpy(name, optarg, sizeof(name)-1); break;
+      case 'f' : fd.first= atoi(optarg); break;
+      case 'a' : aabits= atoi(optarg); break;
+      case 'x' : aaw= atoi(optarg); break;
+      case 'y' : aah= atoi(optarg); break;
+      case 'c' : if (sscanf(optarg, "%d,%d", &cfirst, &clast) != 2) cfirst= -2; break;
+      case 'h' :
+      {
+        help_show();
+        return -1;
+      }
+      default :
+      {
+        fprintf(stderr, "Unbekannte Option oder fehlender Parameter.\n");
+        help_show();
+        return 1;
+      }
+    }
+  }
+
+  if (optind >= argc)
+  {
+    help_show();
+    return -1;
+  }
+
+  src= readfile(argv[optind]);
+  if (!src)
+  {
+    fprintf(stderr, "\n Datei %s kann nicht gelesen werden\n", argv[optind]);
+    return 1;
+  }
+  stripcomments(src);
+  if (!parsefont(src, &fd)) return 1;
+
+  if (aabits)
+  {
+    if (cfirst == -1) { cfirst= fd.first; clast= fd.first + fd.glyphs - 1; }
+    if ((aabits != 2) && (aabits != 4))
+    {
+      fprintf(stderr, "\n -a: nur 2 oder 4 Bit je Pixel\n");
+      return 1;
+    }
+    if ((cfirst < fd.first) || (clast < cfirst) || (clast >= fd.first + fd.glyphs) ||
+        (aaw < 1) || (aaw > 255) || (aah < 1) || (aah > 255))
+    {
+      fprintf(stderr, "\n ungueltige Zeichengroesse oder Zeichen ausserhalb von %d..%d\n",
+              fd.first, fd.first + fd.glyphs - 1);
+      return 1;
+    }
+    zsize= aafont_out(&fd, name, argv[optind], aabits, aaw, aah, cfirst, clast);
+    fprintf(stderr, "\n %s: %d Zeichen, %d x %d Pixel, %d Bit je Pixel: %ld Bytes\n",
+            name, clast - cfirst + 1, aaw, aah, aabits, zsize);
+    free(src);
+    return 0;
+  }
+
+  blocks= (fd.anz + 7) / 8;
+  if (blocks > MAXBLOCKS)                     // Blocknummer in zfont_getbyte: 8 Bit
+  {
+    fprintf(stderr, "\n zu viele Bytes (max. %d)\n", MAXBLOCKS * 8);
+    return 1;
+  }
+  len= compress(&fd, data, index, cycles);
+  idxanz= (blocks + 7) / 8;
+  zsize= len + idxanz * 2 + 4;
+
+  csum= 0; cmax= 0;
+  for (g= 0; g< blocks; g++)
+  {
+    csum += cycles[g];
+    if (cycles[g] > cmax) cmax= cycles[g];
+  }
+
+  // ---------------- Sourcedatei ausgeben ----------------
+  printf("/* -------------------------------------------------");
+  printf("\n     %s.c", name);
+  printf("\n");
+  printf("\n     komprimierter Zeichensatz fuer zfont.c,");
+  printf("\n     erzeugt mit fontcomp aus %s", argv[optind]);
+  printf("\n");
+  if (fd.bytes == 8)
+    printf("\n     Zeichen       : %d..%d (Block n = Zeichen - %d)", fd.first, fd.first + fd.glyphs - 1, fd.first);
+  else
+    printf("\n     Bytes         : %d (Block n = Position / 8)", fd.anz);
+  printf("\n     unkomprimiert : %d Bytes", fd.anz);
+  printf("\n     komprimiert   : %ld Bytes (inkl. Index)", zsize);
+  printf("\n   ------------------------------------------------- */");
+  printf("\n");
+  printf("\n#include \"zfont.h\"");
+  printf("\n");
+  printf("\nstatic const uint16_t PROGMEM %s_index[] = {", name);
+  for (g= 0; g< idxanz; g++)
+  {
+    if (!(g % 8)) printf("\n  ");
+    printf("%5d", index[g]);
+    if (g < idxanz-1) printf(", ");
+  }
+  printf("\n};");
+  printf("\n");
+  printf("\nstatic const uint8_t PROGMEM %s_data[] = {", name);
+  for (g= 0; g< len; g++)
+  {
+    if (!(g % 12)) printf("\n  ");
+    printf("0x%.2x", data[g]);
+    if (g < len - 1) printf(", ");
+  }
+  printf("\n};");
+  printf("\n");
+  printf("\nconst zfont_t PROGMEM %s = { %s_index, %s_data };", name, name, name);
+  printf("\n");
+
+  // ---------------- Bericht ----------------
+  if (fd.bytes == 8)
+    fprintf(stderr, "\n %s: %d Zeichen a 8 Bytes", name, fd.glyphs);
+  else
+    fprintf(stderr, "\n %s: %d Bytes, %d Bloecke a 8 Bytes", name, fd.anz, blocks);
+  fprintf(stderr, "\n   unkomprimiert     : %6d Bytes", fd.anz);
+  fprintf(stderr, "\n   komprimiert       : %6ld Bytes (%ld Daten, %d Index, 4 Beschreibung)",
+          zsize, len, idxanz * 2);
+  fprintf(stderr, "\n   Tabellen gespart  : %6ld Bytes (%.1f %%)",
+          fd.anz - zsize, 100.0 * (fd.anz - zsize) / fd.anz);
+  fprintf(stderr, "\n   Decoder zfont.o   : %6d Bytes (einmal je Programm)", ZF_DECODER);
+  fprintf(stderr, "\n   netto             : %6ld Bytes (%s)", fd.anz - zsize - ZF_DECODER,
+          (fd.anz - zsize > ZF_DECODER) ? "lohnt sich" : "lohnt sich nicht, Decoder groesser als die Ersparnis");
+  fprintf(stderr, "\n   Takte je Block    : %6ld Mittel, %ld max. (geschaetzt, 8 Bytes der Reihe nach)",
+          csum / blocks, cmax);
+  fprintf(stderr, "\n   dto. unkomprimiert: %6d", 8 * CYC_PLAIN);
+  fprintf(stderr, "\n");
+
+  free(src);
+  return 0;
+}
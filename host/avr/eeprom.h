@@ -0,0 +1,91 @@
+/* -----------------------------------------------------
+                      avr/eeprom.h
+
+    Host-Build: EEPROM-Zugriffe laufen wie bei avr-libc
+    ueber EEAR / EEDR / EECR, der Inhalt steht in
+    host_eeprom[] (siehe host_hal.h)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_avr_eeprom
+  #define in_host_avr_eeprom
+
+  #include <stddef.h>
+  #include <avr/io.h>
+
+  #define EEMEM
+  #define eeprom_is_ready()         bit_is_clear(EECR, EEPE)
+  #define eeprom_busy_wait()        do { } while (!eeprom_is_ready())
+
+  static inline uint8_t eeprom_read_byte(const uint8_t *p)
+  {
+    eeprom_busy_wait();
+    EEAR= (uint16_t)(size_t)p;
+    EECR |= (1 << EERE);
+    return EEDR;
+  }
+
+  static inline void eeprom_write_byte(uint8_t *p, uint8_t value)
+  {
+    eeprom_busy_wait();
+    EECR= 0;                                        // Loeschen und Schreiben
+    EEAR= (uint16_t)(size_t)p;
+    EEDR= value;
+    EECR |= (1 << EEMPE);
+    EECR |= (1 << EEPE);
+  }
+
+  static inline void eeprom_update_byte(uint8_t *p, uint8_t value)
+  {
+    if (eeprom_read_byte(p) != value) eeprom_write_byte(p, value);
+  }
+
+  static inline uint16_t eeprom_read_word(const uint16_t *p)
+  {
+    const uint8_t *b= (const uint8_t *)p;
+
+    return eeprom_read_byte(b) | (eeprom_read_byte(b + 1) << 8);
+  }
+
+  static inline void eeprom_write_word(uint16_t *p, uint16_t value)
+  {
+    uint8_t *b= (uint8_t *)p;
+
+    eeprom_write_byte(b, value & 0xff);
+    eeprom_write_byte(b + 1, value >> 8);
+  }
+
+  static inline void eeprom_update_word(uint16_t *p, uint16_t value)
+  {
+    uint8_t *b= (uint8_t *)p;
+
+    eeprom_update_byte(b, value & 0xff);
+    eeprom_update_byte(b + 1, value >> 8);
+  }
+
+  static inline void eeprom_read_block(void *dst, const void *src, size_t n)
+  {
+    uint8_t *d= (uint8_t *)dst;
+    const uint8_t *s= (const uint8_t *)src;
+
+    while (n--) *d++= eeprom_read_byte(s++);
+  }
+
+  static inline void eeprom_write_block(const void *src, void *dst, size_t n)
+  {
+    const uint8_t *s= (const uint8_t *)src;
+    uint8_t *d= (uint8_t *)dst;
+
+    while (n--) eeprom_write_byte(d++, *s++);
+  }
+
+  static inline void eeprom_update_block(const void *src, void *dst, size_t n)
+  {
+    const uint8_t *s= (const uint8_t *)src;
+    uint8_t *d= (uint8_t *)dst;
+
+    while (n--) eeprom_update_byte(d++, *s++);
+  }
+
+#endif
@@ -0,0 +1,24 @@
+/* -----------------------------------------------------
+                      avr/interrupt.h
+
+    Host-Build: ISRs werden zu normalen Funktionen, die
+    ein Test direkt aufrufen kann. sei / cli setzen das
+    I-Bit in SREG.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_avr_interrupt
+  #define in_host_avr_interrupt
+
+  #include <avr/io.h>
+
+  #define ISR(vect, ...)        void vect(void); void vect(void)
+  #define EMPTY_INTERRUPT(vect) void vect(void) { }
+  #define ISR_NOBLOCK
+  #define ISR_BLOCK
+
+  #define sei()                 (SREG |= (1 << SREG_I))
+  #define cli()                 (SREG &= ~(1 << SREG_I))
+
+#endif
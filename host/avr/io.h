@@ -0,0 +1,326 @@
+/* -----------------------------------------------------
+                        avr/io.h
+
+    Registerdefinitionen des ATtiny44 fuer den Host-
+    Build (siehe host_hal.h). Die Adressen entsprechen
+    den I/O-Adressen des Datenblatts.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_avr_io
+  #define in_host_avr_io
+
+  #include <stdint.h>
+  #include "host_hal.h"
+
+  #ifndef __AVR_ATtiny44__
+    #define __AVR_ATtiny44__      1
+  #endif
+
+  #define _SFR_IO8(a)           (*host_reg(a))
+  #define _SFR_IO16(a)          (*host_reg16(a))
+  #define _BV(b)                (1 << (b))
+  #define bit_is_set(r,b)       ((r) & _BV(b))
+  #define bit_is_clear(r,b)     (!((r) & _BV(b)))
+  #define loop_until_bit_is_set(r,b)    do { } while (bit_is_clear(r,b))
+  #define loop_until_bit_is_clear(r,b)  do { } while (bit_is_set(r,b))
+
+  #define RAMSTART              0x60
+  #define RAMEND                0x15f
+  #define FLASHEND              0xfff
+  #define E2END                 0xff
+
+  // ---------------- Register ----------------
+
+  #define SREG                  _SFR_IO8(0x3f)
+  #define SPH                   _SFR_IO8(0x3e)
+  #define SPL                   _SFR_IO8(0x3d)
+  #define OCR0B                 _SFR_IO8(0x3c)
+  #define GIMSK                 _SFR_IO8(0x3b)
+  #define GIFR                  _SFR_IO8(0x3a)
+  #define TIMSK0                _SFR_IO8(0x39)
+  #define TIFR0                 _SFR_IO8(0x38)
+  #define SPMCSR                _SFR_IO8(0x37)
+  #define OCR0A                 _SFR_IO8(0x36)
+  #define MCUCR                 _SFR_IO8(0x35)
+  #define MCUSR                 _SFR_IO8(0x34)
+  #define TCCR0B                _SFR_IO8(0x33)
+  #define TCNT0                 _SFR_IO8(0x32)
+  #define OSCCAL                _SFR_IO8(0x31)
+  #define TCCR0A                _SFR_IO8(0x30)
+  #define TCCR1A                _SFR_IO8(0x2f)
+  #define TCCR1B                _SFR_IO8(0x2e)
+  #define TCNT1                 _SFR_IO16(0x2c)
+  #define TCNT1H                _SFR_IO8(0x2d)
+  #define TCNT1L                _SFR_IO8(0x2c)
+  #define OCR1A                 _SFR_IO16(0x2a)
+  #define OCR1AH                _SFR_IO8(0x2b)
+  #define OCR1AL                _SFR_IO8(0x2a)
+  #define OCR1B                 _SFR_IO16(0x28)
+  #define OCR1BH                _SFR_IO8(0x29)
+  #define OCR1BL                _SFR_IO8(0x28)
+  #define DWDR                  _SFR_IO8(0x27)
+  #define CLKPR                 _SFR_IO8(0x26)
+  #define ICR1                  _SFR_IO16(0x24)
+  #define ICR1H                 _SFR_IO8(0x25)
+  #define ICR1L                 _SFR_IO8(0x24)
+  #define GTCCR                 _SFR_IO8(0x23)
+  #define TCCR1C                _SFR_IO8(0x22)
+  #define WDTCSR                _SFR_IO8(0x21)
+  #define PCMSK1                _SFR_IO8(0x20)
+  #define EEAR                  _SFR_IO16(0x1e)
+  #define EEARH                 _SFR_IO8(0x1f)
+  #define EEARL                 _SFR_IO8(0x1e)
+  #define EEDR                  _SFR_IO8(0x1d)
+  #define EECR                  _SFR_IO8(0x1c)
+  #define PORTA                 _SFR_IO8(0x1b)
+  #define DDRA                  _SFR_IO8(0x1a)
+  #define PINA                  _SFR_IO8(0x19)
+  #define PORTB                 _SFR_IO8(0x18)
+  #define DDRB                  _SFR_IO8(0x17)
+  #define PINB                  _SFR_IO8(0x16)
+  #define GPIOR2                _SFR_IO8(0x15)
+  #define GPIOR1                _SFR_IO8(0x14)
+  #define GPIOR0                _SFR_IO8(0x13)
+  #define PCMSK0                _SFR_IO8(0x12)
+  #define USIBR                 _SFR_IO8(0x10)
+  #define USIDR                 _SFR_IO8(0x0f)
+  #define USISR                 _SFR_IO8(0x0e)
+  #define USICR                 _SFR_IO8(0x0d)
+  #define TIMSK1                _SFR_IO8(0x0c)
+  #define TIFR1                 _SFR_IO8(0x0b)
+  #define ACSR                  _SFR_IO8(0x08)
+  #define ADMUX                 _SFR_IO8(0x07)
+  #define ADCSRA                _SFR_IO8(0x06)
+  #define ADC                   _SFR_IO16(0x04)
+  #define ADCW                  _SFR_IO16(0x04)
+  #define ADCH                  _SFR_IO8(0x05)
+  #define ADCL                  _SFR_IO8(0x04)
+  #define ADCSRB                _SFR_IO8(0x03)
+  #define DIDR0                 _SFR_IO8(0x01)
+  #define PRR                   _SFR_IO8(0x00)
+
+  // ---------------- Bits ----------------
+
+  // Ports
+  #define PA0   0
+  #define PA1   1
+  #define PA2   2
+  #define PA3   3
+  #define PA4   4
+  #define PA5   5
+  #define PA6   6
+  #define PA7   7
+  #define PB0   0
+  #define PB1   1
+  #define PB2   2
+  #define PB3   3
+
+  #define PORTA0 0
+  #define PORTA1 1
+  #define PORTA2 2
+  #define PORTA3 3
+  #define PORTA4 4
+  #define PORTA5 5
+  #define PORTA6 6
+  #define PORTA7 7
+  #define PORTB0 0
+  #define PORTB1 1
+  #define PORTB2 2
+  #define PORTB3 3
+  #define DDA0  0
+  #define DDA1  1
+  #define DDA2  2
+  #define DDA3  3
+  #define DDA4  4
+  #define DDA5  5
+  #define DDA6  6
+  #define DDA7  7
+  #define DDB0  0
+  #define DDB1  1
+  #define DDB2  2
+  #define DDB3  3
+  #define PINA0 0
+  #define PINA1 1
+  #define PINA2 2
+  #define PINA3 3
+  #define PINA4 4
+  #define PINA5 5
+  #define PINA6 6
+  #define PINA7 7
+  #define PINB0 0
+  #define PINB1 1
+  #define PINB2 2
+  #define PINB3 3
+
+  // SREG
+  #define SREG_I 7
+
+  // GIMSK, GIFR, PCMSKx, MCUCR
+  #define INT0    6
+  #define PCIE1   5
+  #define PCIE0   4
+  #define INTF0   6
+  #define PCIF1   5
+  #define PCIF0   4
+  #define PCINT0  0
+  #define PCINT1  1
+  #define PCINT2  2
+  #define PCINT3  3
+  #define PCINT4  4
+  #define PCINT5  5
+  #define PCINT6  6
+  #define PCINT7  7
+  #define PCINT8  0
+  #define PCINT9  1
+  #define PCINT10 2
+  #define PCINT11 3
+  #define BODS    7
+  #define PUD     6
+  #define SE      5
+  #define SM1     4
+  #define SM0     3
+  #define BODSE   2
+  #define ISC01   1
+  #define ISC00   0
+  #define WDRF    3
+  #define BORF    2
+  #define EXTRF   1
+  #define PORF    0
+
+  // Timer 0
+  #define COM0A1  7
+  #define COM0A0  6
+  #define COM0B1  5
+  #define COM0B0  4
+  #define WGM01   1
+  #define WGM00   0
+  #define FOC0A   7
+  #define FOC0B   6
+  #define WGM02   3
+  #define CS02    2
+  #define CS01    1
+  #define CS00    0
+  #define OCIE0B  2
+  #define OCIE0A  1
+  #define TOIE0   0
+  #define OCF0B   2
+  #define OCF0A   1
+  #define TOV0    0
+
+  // Timer 1
+  #define COM1A1  7
+  #define COM1A0  6
+  #define COM1B1  5
+  #define COM1B0  4
+  #define WGM11   1
+  #define WGM10   0
+  #define ICNC1   7
+  #define ICES1   6
+  #define WGM13   4
+  #define WGM12   3
+  #define CS12    2
+  #define CS11    1
+  #define CS10    0
+  #define FOC1A   7
+  #define FOC1B   6
+  #define ICIE1   5
+  #define OCIE1B  2
+  #define OCIE1A  1
+  #define TOIE1   0
+  #define ICF1    5
+  #define OCF1B   2
+  #define OCF1A   1
+  #define TOV1    0
+
+  // GTCCR, CLKPR, WDTCSR
+  #define TSM     7
+  #define PSR10   0
+  #define CLKPCE  7
+  #define CLKPS3  3
+  #define CLKPS2  2
+  #define CLKPS1  1
+  #define CLKPS0  0
+  #define WDIF    7
+  #define WDIE    6
+  #define WDP3    5
+  #define WDCE    4
+  #define WDE     3
+  #define WDP2    2
+  #define WDP1    1
+  #define WDP0    0
+
+  // EEPROM
+  #define EEPM1   5
+  #define EEPM0   4
+  #define EERIE   3
+  #define EEMPE   2
+  #define EEPE    1
+  #define EERE    0
+
+  // USI
+  #define USISIF  7
+  #define USIOIF  6
+  #define USIPF   5
+  #define USIDC   4
+  #define USICNT3 3
+  #define USICNT2 2
+  #define USICNT1 1
+  #define USICNT0 0
+  #define USISIE  7
+  #define USIOIE  6
+  #define USIWM1  5
+  #define USIWM0  4
+  #define USICS1  3
+  #define USICS0  2
+  #define USICLK  1
+  #define USITC   0
+
+  // Analogkomparator, ADC
+  #define ACD     7
+  #define ACBG    6
+  #define ACO     5
+  #define ACI     4
+  #define ACIE    3
+  #define ACIC    2
+  #define ACIS1   1
+  #define ACIS0   0
+  #define REFS1   7
+  #define REFS0   6
+  #define MUX5    5
+  #define MUX4    4
+  #define MUX3    3
+  #define MUX2    2
+  #define MUX1    1
+  #define MUX0    0
+  #define ADEN    7
+  #define ADSC    6
+  #define ADATE   5
+  #define ADIF    4
+  #define ADIE    3
+  #define ADPS2   2
+  #define ADPS1   1
+  #define ADPS0   0
+  #define BIN     7
+  #define ACME    6
+  #define ADLAR   4
+  #define ADTS2   2
+  #define ADTS1   1
+  #define ADTS0   0
+  #define ADC7D   7
+  #define ADC6D   6
+  #define ADC5D   5
+  #define ADC4D   4
+  #define ADC3D   3
+  #define ADC2D   2
+  #define ADC1D   1
+  #define ADC0D   0
+
+  // PRR
+  #define PRTIM1  3
+  #define PRTIM0  2
+  #define PRUSI   1
+  #define PRADC   0
+
+#endif
@@ -0,0 +1,33 @@
+/* -----------------------------------------------------
+                      avr/pgmspace.h
+
+    Host-Build: Flash und RAM sind derselbe Adressraum,
+    Lesezugriffe sind normale Zeigerzugriffe.
+    pgm_read_word liest mit dem Typ des Zeigers, damit
+    auch im Flash abgelegte Zeiger (64 Bit) gelesen
+    werden koennen.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_avr_pgmspace
+  #define in_host_avr_pgmspace
+
+  #include <stdint.h>
+  #include <string.h>
+
+  #define PROGMEM
+  #define PGM_P                 const char *
+  #define PSTR(s)               ((const char *)(s))
+
+  #define pgm_read_byte(a)      (*(const uint8_t *)(a))
+  #define pgm_read_word(a)      (*(a))
+  #define pgm_read_dword(a)     (*(const uint32_t *)(a))
+
+  #define memcpy_P              memcpy
+  #define strlen_P              strlen
+  #define strcpy_P              strcpy
+
+  typedef char prog_char;
+
+#endif
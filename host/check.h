@@ -0,0 +1,36 @@
+/* -----------------------------------------------------
+                         check.h
+
+    Pruefrahmen fuer die Tests in host/ (make check):
+    CHECK(bedingung, text) zaehlt Fehler und gibt sie
+    mit Datei / Zeile aus, check_done() gibt das Ergeb-
+    nis aus und liefert den Rueckgabewert fuer main.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_check
+  #define in_host_check
+
+  #include <stdio.h>
+
+  static int check_cnt  = 0;
+  static int check_fail = 0;
+
+  #define CHECK(bed, text)                                        \
+    {                                                             \
+      check_cnt++;                                                \
+      if (!(bed))                                                 \
+      {                                                           \
+        check_fail++;                                             \
+        printf("  FEHLER %s:%d: %s\n", __FILE__, __LINE__, text); \
+      }                                                           \
+    }
+
+  static inline int check_done(const char *name)
+  {
+    printf("%-24s: %d Pruefungen, %d Fehler\n", name, check_cnt, check_fail);
+    return check_fail ? 1 : 0;
+  }
+
+#endif
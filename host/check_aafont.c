@@ -0,0 +1,200 @@
+/* -----------------------------------------------------
+                     check_aafont.c
+
+    Test von lcd_putchar_aa (tftdisplay.c) mit einem
+    Graustufen-Zeichensatz:
+
+      aafont   : aafont10d.c, 2 Bit je Pixel, 10 Pixel
+                 breit (3 Bytes je Zeile, 2 Fuellpixel)
+      aafont_4 : mit fontcomp -a 4 erzeugt (bin/aafont9x12.c),
+                 9 Pixel breit (5 Bytes je Zeile, 1 Fuell-
+                 pixel)
+
+    Die Bytes auf dem SPI werden an den steigenden Flan-
+    ken von USCK (PA4) aus dem MSB von USIDR mitgeschnit-
+    ten. Geprueft werden fuer alle Zeichen:
+
+      - outmode 0: Pixel zeilenweise von links oben, Farbe
+        = Mischfarbe der Stufe aus dem Zeichensatz
+      - outmode 3: dieselben Pixel in umgekehrter Reihen-
+        folge (von rechts unten, Fuellpixel am Zeilenende
+        verworfen) in einem gespiegelten Fenster
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_hal.h"
+#include "tftdisplay.h"
+
+#ifndef AAFONT
+  #include "aafont10d.h"
+  #define AAFONT          aafont10d
+#else
+  extern const aafont_t AAFONT;
+#endif
+
+#define MAXPIX          (20 * 20)
+
+static uint8_t  pina;                           // I/O-Adresse von PINA
+static uint8_t  usidr;                          // I/O-Adresse von USIDR
+static uint8_t  lastsck;
+static uint8_t  bitn, shift, dc;                // aktuelles Byte auf dem SPI
+
+static uint16_t col[2];                         // Spaltenadresse des letzten Fensters
+static uint8_t  parn;                           // Parameterbytes nach coladdr
+static uint8_t  cmd;                            // letztes Kommando
+static uint8_t  hibyte, hi;
+static uint16_t pix[MAXPIX];                    // Pixel nach writereg
+static uint16_t pixanz;
+
+/* -------------------------------------------------------
+                        spi_byte
+
+     wertet ein gesendetes Byte aus (dc = 0: Kommando)
+   ------------------------------------------------------- */
+static void spi_byte(uint8_t b)
+{
+  if (!dc)
+  {
+    cmd= b;
+    parn= 0; hi= 0;
+    if (cmd == writereg) pixanz= 0;
+    return;
+  }
+  if (cmd == coladdr)
+  {
+    if (parn & 1) col[parn >> 1] |= b;
+             else col[parn >> 1]= b << 8;
+    parn++;
+    return;
+  }
+  if (cmd != writereg) return;
+  if (!hi) { hibyte= b; hi= 1; return; }
+  hi= 0;
+  if (pixanz < MAXPIX) pix[pixanz]= (hibyte << 8) | b;
+  pixanz++;
+}
+
+/* -------------------------------------------------------
+                        sck_hook
+
+     steigende Flanke an USCK: Bit aus dem MSB von USIDR
+     (host_pinhook)
+   ------------------------------------------------------- */
+static void sck_hook(void)
+{
+  uint8_t sck;
+
+  sck= host_pin(pina) & (1 << PA4);
+  if (sck == lastsck) return;
+  lastsck= sck;
+  if (!sck) return;
+
+  if (!bitn) dc= host_pin(pina) & (1 << PA0);
+  shift= (shift << 1) | (host_io[usidr] >> 7);
+  if (++bitn == 8)
+  {
+    bitn= 0;
+    spi_byte(shift);
+  }
+}
+
+/* -------------------------------------------------------
+                        level
+
+     Stufe des Pixels x,y von Zeichen ch aus dem
+     Zeichensatz
+   ------------------------------------------------------- */
+static uint8_t level(uint8_t ch, uint8_t x, uint8_t y)
+{
+  uint8_t  rowbytes, b;
+  uint16_t bit;
+
+  rowbytes= (AAFONT.width * tft_aafont + 7) / 8;
+  b= AAFONT.bitmap[((ch - AAFONT.first) * AAFONT.height + y) * rowbytes + x * tft_aafont / 8];
+  bit= (x * tft_aafont) % 8;
+  return (b >> (8 - tft_aafont - bit)) & ((1 << tft_aafont) - 1);
+}
+
+/* -------------------------------------------------------
+                        mix
+
+     erwartete Farbe der Stufe v (Mischung bkcolor ..
+     textcolor je Farbkomponente)
+   ------------------------------------------------------- */
+static uint16_t mix(uint8_t v)
+{
+  int16_t m, r, g, b;
+
+  m= (1 << tft_aafont) - 1;
+  r= (bkcolor >> 11)         + ((textcolor >> 11)         - (bkcolor >> 11))         * v / m;
+  g= ((bkcolor >> 5) & 0x3f) + (((textcolor >> 5) & 0x3f) - ((bkcolor >> 5) & 0x3f)) * v / m;
+  b= (bkcolor & 0x1f)        + ((textcolor & 0x1f)        - (bkcolor & 0x1f))        * v / m;
+  return (r << 11) | (g << 5) | b;
+}
+
+int main(void)
+{
+  uint8_t  ch, x, y, w, h, mode;
+  uint16_t i, n, fehler[2], stufen;
+
+  pina= HOST_ADDR(PINA);
+  usidr= HOST_ADDR(USIDR);
+  lcd_init();
+  host_sync();
+  lastsck= host_pin(pina) & (1 << PA4);
+  host_pinhook= sck_hook;
+
+  textcolor= rgbfromvalue(0xff, 0xc0, 0x20);
+  bkcolor= rgbfromvalue(0x10, 0x20, 0x80);
+  lcd_setaafont(&AAFONT);
+  w= AAFONT.width;
+  h= AAFONT.height;
+  n= w * h;
+  CHECK(n <= MAXPIX, "Zeichen zu gross fuer den Test");
+  CHECK((w * tft_aafont) % 8, "Zeichenbreite ohne Fuellpixel, Sprung bei outmode 3 ungeprueft");
+
+  fehler[0]= 0; fehler[1]= 0;
+  stufen= 0;
+  for (ch= AAFONT.first; ch <= AAFONT.last; ch++)
+  {
+    for (mode= 0; mode< 2; mode++)
+    {
+      outmode= (mode) ? 3 : 0;
+      aktxp= 20; aktyp= 30;
+      pixanz= 0;
+      lcd_putchar_aa(ch);
+      host_sync();
+      if ((pixanz != n) || (col[0] != ((mode) ? _xres-20-w : 20)) || (col[1] != col[0] + w - 1))
+      {
+        fehler[mode]++;
+        continue;
+      }
+      for (y= 0; y< h; y++)
+      {
+        for (x= 0; x< w; x++)
+        {
+          i= y * w + x;
+          if (mode) i= n - 1 - i;
+          if (pix[i] != mix(level(ch, x, y))) fehler[mode]++;
+          if (!mode) stufen |= 1 << level(ch, x, y);
+        }
+      }
+    }
+  }
+  outmode= 0;
+  CHECK(fehler[0] == 0, "outmode 0: Fenster oder Pixel falsch");
+  CHECK(fehler[1] == 0, "outmode 3: Fenster oder Pixel falsch");
+  CHECK(stufen == (1 << (1 << tft_aafont)) - 1, "nicht alle Stufen im Zeichensatz verwendet");
+
+  // Zeichen ausserhalb des Zeichensatzes: nur Cursor weiter
+  aktxp= 0; aktyp= 0;
+  pixanz= 0;
+  lcd_putchar_aa(AAFONT.last + 1);
+  host_sync();
+  CHECK((pixanz == 0) && (aktxp == w), "Zeichen ausserhalb des Zeichensatzes");
+
+  return check_done((tft_aafont == 4) ? "aafont (4 Bit)" : "aafont (2 Bit)");
+}
@@ -0,0 +1,165 @@
+/* -----------------------------------------------------
+                    check_i2c_async.c
+
+    Test i2c_async gegen den Slave aus host_i2c.c
+
+    Timer1 wird hier nachgebildet: solange OCIE1A und
+    das I-Bit gesetzt sind, wird TIM1_COMPA_vect alle
+    I2CAS_TICKS + 1 Takte aufgerufen. Das Hauptprogramm
+    zaehlt waehrend des Transfers freie Takte.
+
+    Die Registerzugriffe der ISR zaehlen je 1 Takt, fuer
+    Einsprung, Sichern der Register (der Callback
+    i2c_async_ready erzwingt das Sichern aller call-
+    clobbered Register) und Sprungverteiler werden
+    ISR_OVH Takte je Aufruf angenommen. Die freien Takte
+    sind damit eine Schaetzung, keine Messung auf dem
+    ATtiny44.
+
+    Danach wird Clockstretching geprueft: der Slave
+    haelt SCL vor dem 8. Datentakt, vor dem ACK-Takt
+    und nach dem ACK, jeweils kuerzer als das Timeout.
+    Ein Stretching laenger als i2c_async_stretchmax
+    Ticks muss die Queue verwerfen.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_i2c.h"
+#include "i2c_async.h"
+
+#define SLAVE       0x78
+#define FILLANZ     1024
+
+// Einsprung + reti 8, push / pop von 15 Registern 60, Sprungverteiler 12
+#define ISR_OVH     80
+
+// wie in i2c_async.c
+#define PERIOD      ( (F_CPU) / (2ul * (i2c_async_clk)) )
+
+void TIM1_COMPA_vect(void);
+
+static void (*slavetick)(void);
+static uint32_t next_compare;
+static uint8_t  in_isr = 0;
+static uint32_t isr_calls = 0;
+
+/* -------------------------------------------------------
+                        timer1_tick
+
+     Compare-Match von Timer1 (host_tickhook)
+   ------------------------------------------------------- */
+static void timer1_tick(void)
+{
+  if (slavetick) slavetick();
+  if (in_isr) return;
+  while (host_cycles >= next_compare)
+  {
+    next_compare += PERIOD;
+    if ((host_io[0x3f] & (1 << SREG_I)) && (host_io[0x0c] & (1 << OCIE1A)))
+    {
+      in_isr= 1;
+      isr_calls++;
+      TIM1_COMPA_vect();
+      host_addcycles(ISR_OVH);
+      in_isr= 0;
+    }
+  }
+}
+
+/* -------------------------------------------------------
+                      stretch_write
+
+     schreibt 4 Bytes ab Register 0x40, der Slave haelt
+     SCL nach dem Takt bit fuer stretch Takte
+
+     Rueckgabe: Dauer des Transfers in Takten
+   ------------------------------------------------------- */
+static uint32_t stretch_write(uint8_t bit, uint32_t stretch, const uint8_t *out)
+{
+  uint32_t t0;
+  uint8_t  i;
+
+  memset(&host_i2c_mem[0x40], 0, 4);
+  host_i2c_reset();
+  host_i2c_stretchbit= bit;
+  host_i2c_stretch= stretch;
+
+  i2c_async_start(SLAVE);
+  i2c_async_write(0x40);
+  for (i= 0; i< 4; i++) i2c_async_write(out[i]);
+  i2c_async_stop();
+
+  t0= host_cycles;
+  while (i2c_async_busy()) host_addcycles(1);
+
+  host_i2c_stretch= 0;
+  host_i2c_stretchbit= 9;
+  return host_cycles - t0;
+}
+
+int main(void)
+{
+  static const uint8_t out[4] = { 0x5a, 0xc3, 0x01, 0xfe };
+  static const uint8_t bits[3] = { 7, 8, 9 };
+  uint32_t t0, busy, frei;
+  uint16_t i;
+  uint8_t  ok;
+
+  host_i2c_attach(SLAVE, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+  slavetick= host_tickhook;
+  host_tickhook= timer1_tick;
+  memset(host_i2c_mem, 0, sizeof(host_i2c_mem));
+
+  i2c_async_init();
+  next_compare= host_cycles + PERIOD;
+
+  // Transfer wie beim Loeschen eines SSD1306: Steuerbyte, 1024 Fuellbytes
+  i2c_async_start(SLAVE);
+  i2c_async_write(0x00);
+  i2c_async_fill(0xaa, FILLANZ);
+  i2c_async_stop();
+
+  t0= host_cycles;
+  frei= 0;
+  while (i2c_async_busy())
+  {
+    host_addcycles(1);                        // ein Takt Rechenzeit des Hauptprogramms
+    frei++;
+  }
+  busy= host_cycles - t0;
+
+  CHECK(host_i2c_starts == 1 && host_i2c_stops == 1, "Start / Stop");
+  CHECK(host_i2c_bytes == FILLANZ + 2, "Anzahl Bytes auf dem Bus");
+  ok= 1;
+  for (i= 0; i< 256; i++) if (host_i2c_mem[i] != 0xaa) ok= 0;
+  CHECK(ok, "Fuellbytes nicht im Slave");
+  CHECK(i2c_async_nackcnt == 0, "NACK gezaehlt");
+  CHECK(host_i2c_tlow >= (uint32_t)(4.7e-6 * F_CPU), "tLOW < 4,7 us");
+
+  printf("  %u Bytes in %lu Takten (%lu Interrupts), frei fuer das Hauptprogramm: %lu Takte = %.1f%%\n",
+         FILLANZ + 2, (unsigned long)busy, (unsigned long)isr_calls,
+         (unsigned long)frei, 100.0 * frei / busy);
+  CHECK(frei * 10 > busy * 4, "weniger als 40% Rechenzeit frei");
+
+  // Clockstretching ueber 3 Ticks vor dem 8. Takt, vor und nach dem ACK
+  for (i= 0; i< 3; i++)
+  {
+    busy= stretch_write(bits[i], 3 * PERIOD, out);
+    if (memcmp(&host_i2c_mem[0x40], out, 4)) printf("  Stretching nach Takt %u:\n", bits[i]);
+    CHECK(host_i2c_bytes == 6 && host_i2c_stops == 1, "Stretching: Bytes / Stop");
+    CHECK(memcmp(&host_i2c_mem[0x40], out, 4) == 0, "Stretching: Daten falsch");
+    CHECK(i2c_async_nackcnt == 0 && i2c_async_errcnt == 0, "Stretching: NACK oder Abbruch gezaehlt");
+    CHECK(busy >= 6 * 3 * PERIOD, "Stretching: Master hat nicht gewartet");
+  }
+
+  // Stretching laenger als das Timeout: Queue wird verworfen, Bus frei
+  stretch_write(9, (i2c_async_stretchmax + 10ul) * PERIOD, out);
+  host_addcycles((i2c_async_stretchmax + 10ul) * PERIOD);
+  CHECK(i2c_async_errcnt == 1, "Timeout: nicht gezaehlt");
+  CHECK(i2c_is_sda() && i2c_is_scl(), "Timeout: Bus nicht freigegeben");
+
+  return check_done("i2c_async");
+}
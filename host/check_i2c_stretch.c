@@ -0,0 +1,111 @@
+/* -----------------------------------------------------
+                   check_i2c_stretch.c
+
+    Test Clockstretching und Bus-Recovery von i2c_sw
+    (Bitbanging bzw. USI mit I2C_USI_TWI) gegen den Slave
+    aus host_i2c.c:
+
+      - Slave haelt SCL nach jedem ACK kuerzer als
+        I2C_STRETCH_US: Transfer vollstaendig
+      - Slave haelt SCL laenger: I2C_ERR_TIMEOUT, danach
+        keine weiteren Takte bis zur naechsten Start-
+        condition
+      - Slave haelt SDA fest und gibt es erst nach einigen
+        Takten frei: i2c_start taktet den Bus frei
+      - SDA bleibt low: I2C_ERR_BUS
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_i2c.h"
+#include "i2c_sw.h"
+
+#if defined(I2C_USI_TWI)
+  #define NAME    "i2c_stretch_usi"
+#else
+  #define NAME    "i2c_stretch"
+#endif
+
+#define SLAVE     0xd0
+#define SDAMASK   (1 << i2c_sdabitnr)
+#define SCLMASK   (1 << i2c_sclbitnr)
+
+static void (*slavehook)(void);
+static uint8_t stuck = 0;                   // Takte, bis der Slave SDA freigibt (0xff: nie)
+static uint8_t lastscl = 1;
+static uint32_t sclclocks = 0;              // steigende Flanken SCL
+
+/* -------------------------------------------------------
+                        bus_hook
+
+     zaehlt SCL-Takte und gibt ein festgehaltenes SDA
+     nach stuck Takten frei
+   ------------------------------------------------------- */
+static void bus_hook(void)
+{
+  uint8_t scl;
+
+  if (slavehook) slavehook();
+  scl= (host_pin(HOST_ADDR(sdapin)) & SCLMASK) ? 1 : 0;
+  if (scl && !lastscl)
+  {
+    sclclocks++;
+    if (stuck && (stuck != 0xff) && !--stuck) host_extpin(HOST_ADDR(sdapin), SDAMASK, 1);
+  }
+  lastscl= scl;
+}
+
+int main(void)
+{
+  static const uint8_t out[4] = { 0x11, 0x22, 0x33, 0x44 };
+  uint32_t t0, clk;
+  uint8_t  ack;
+
+  host_i2c_attach(SLAVE, HOST_ADDR(sdapin), SDAMASK, SCLMASK);
+  slavehook= host_pinhook;
+  host_pinhook= bus_hook;
+  i2c_master_init();
+
+  // Stretching 50 us je Byte (kuerzer als I2C_STRETCH_US)
+  host_i2c_stretch= 50ul * (F_CPU / 1000000ul);
+  host_sync();
+  t0= host_cycles;
+  CHECK(i2c_write_buf(SLAVE, 0x20, out, 4), "Stretching: kein Acknowledge");
+  CHECK(i2c_error == I2C_OK, "Stretching: i2c_error");
+  CHECK(memcmp(&host_i2c_mem[0x20], out, 4) == 0, "Stretching: Daten falsch");
+  CHECK(host_cycles - t0 >= 6 * host_i2c_stretch, "Stretching: Master hat nicht gewartet");
+
+  // Stretching laenger als I2C_STRETCH_US: der Slave haelt SCL nach dem
+  // ACK der Adresse, das naechste Byte laeuft in den Timeout
+  host_i2c_stretch= (I2C_STRETCH_US + 500ul) * (F_CPU / 1000000ul);
+  CHECK(i2c_start(SLAVE), "Timeout: Adresse nicht quittiert");
+  ack= i2c_write(0x20);
+  CHECK(!ack, "Timeout: Acknowledge gemeldet");
+  CHECK(i2c_error == I2C_ERR_TIMEOUT, "Timeout: i2c_error");
+  clk= sclclocks;
+  CHECK(!i2c_write(0x55), "Timeout: i2c_write nach Timeout");
+  CHECK(i2c_read(1) == 0xff, "Timeout: i2c_read nach Timeout");
+  CHECK(sclclocks == clk, "Timeout: Takte nach Timeout");
+  host_addcycles(host_i2c_stretch);         // Slave gibt SCL frei
+  host_i2c_stretch= 0;
+  i2c_stop();
+
+  // SDA festgehalten, Freigabe nach 5 Takten
+  host_extpin(HOST_ADDR(sdapin), SDAMASK, 0);
+  stuck= 5;
+  ack= i2c_start(SLAVE);
+  CHECK(ack, "Recovery: Bus nicht freigetaktet");
+  CHECK(i2c_error == I2C_OK, "Recovery: i2c_error");
+  i2c_stop();
+
+  // SDA bleibt low
+  host_extpin(HOST_ADDR(sdapin), SDAMASK, 0);
+  stuck= 0xff;
+  ack= i2c_start(SLAVE);
+  CHECK(!ack, "Bus blockiert: Acknowledge gemeldet");
+  CHECK(i2c_error == I2C_ERR_BUS, "Bus blockiert: i2c_error");
+
+  return check_done(NAME);
+}
@@ -0,0 +1,52 @@
+/* -----------------------------------------------------
+                     check_i2c_sw.c
+
+    Test i2c_sw (Bitbanging bzw. USI mit I2C_USI_TWI)
+    gegen den Slave aus host_i2c.c: Schreiben, Lesen,
+    fehlendes Acknowledge
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_i2c.h"
+#include "i2c_sw.h"
+
+#if defined(I2C_USI_TWI)
+  #define NAME    "i2c_sw_usi"
+#else
+  #define NAME    "i2c_sw"
+#endif
+
+#define SLAVE     0xd0
+
+int main(void)
+{
+  static const uint8_t out[5] = { 0x12, 0x00, 0xff, 0xa5, 0x5a };
+  uint8_t in[5];
+
+  host_i2c_attach(SLAVE, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+  i2c_master_init();
+
+  CHECK(i2c_write_buf(SLAVE, 0x10, out, 5), "write_buf ohne Acknowledge");
+  CHECK(memcmp(&host_i2c_mem[0x10], out, 5) == 0, "write_buf: falsche Daten im Slave");
+  CHECK(host_i2c_starts == 1 && host_i2c_stops == 1, "write_buf: Start / Stop");
+  CHECK(host_i2c_bytes == 7, "write_buf: Anzahl Bytes");
+
+  memset(in, 0, 5);
+  host_i2c_reset();
+  CHECK(i2c_read_buf(SLAVE, 0x10, in, 5), "read_buf ohne Acknowledge");
+  CHECK(memcmp(in, out, 5) == 0, "read_buf: falsche Daten");
+  CHECK(host_i2c_starts == 2 && host_i2c_stops == 1, "read_buf: Repeated Start / Stop");
+
+  host_i2c_nack= 1;
+  CHECK(!i2c_write_buf(SLAVE, 0x10, out, 5), "NACK nicht erkannt");
+  CHECK(i2c_error == I2C_ERR_NACK, "NACK: i2c_error");
+  host_i2c_nack= 0;
+
+  CHECK(i2c_start(SLAVE + 2) == 0, "falsche Adresse quittiert");
+  i2c_stop();
+
+  return check_done(NAME);
+}
@@ -0,0 +1,121 @@
+/* -----------------------------------------------------
+                    check_i2c_timing.c
+
+    Test der SCL-Zeiten von i2c_sw (Bitbanging bzw. USI
+    mit I2C_USI_TWI) fuer I2C_BUS_HZ und F_CPU
+
+    Im Host-Build kostet jeder Registerzugriff 1 Takt,
+    die Zeiten des Slaves aus host_i2c.c sind daher
+    nicht die des AVR. Geprueft wird deshalb zweierlei:
+
+      - AVR: mit den Taktzyklen der Bitschleifen aus dem
+        Listing (Tabelle in i2c_sw.h, hier unabhaengig
+        davon eingetragen) halten Wartezeit plus Schleife
+        tLOW / tHIGH ein, der Bustakt liegt nicht ueber
+        I2C_BUS_HZ und I2C_OVH_LOW / I2C_OVH_HIGH ent-
+        sprechen der schnelleren Schleife. Ausgegeben wird
+        der erreichte Bustakt.
+
+      - Host: die Schleifen enthalten noch die Port-
+        zugriffe, fuer die gezaehlt wurde. Aendert sich
+        eine Schleife, schlaegt der Test fehl und die
+        Tabelle in i2c_sw.h ist neu abzuzaehlen.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "check.h"
+#include "host_i2c.h"
+#include "i2c_sw.h"
+
+#if defined(I2C_USI_TWI)
+  #if (I2C_BUS_HZ == 1000000)
+    #define NAME  "i2c_timing_usi_1m"
+  #else
+    #define NAME  "i2c_timing_usi"
+  #endif
+
+  // AVR-Takte der Bitschleife neben den Wartezeiten (usi_transfer)
+  #define W_LOW     9
+  #define W_HIGH    3
+  #define R_LOW     9
+  #define R_HIGH    3
+
+  // Host: kleinste Anzahl Registerzugriffe von Flanke zu Flanke beim
+  // Schreiben bzw. Lesen (USISR, USICR / PIN, USICR)
+  #define H_LOW     2
+  #define H_HIGH    2
+  #define H_RLOW    2
+  #define H_RHIGH   2
+#else
+  #if (I2C_BUS_HZ == 1000000)
+    #define NAME  "i2c_timing_1m"
+  #elif (I2C_BUS_HZ == 400000)
+    #define NAME  "i2c_timing_400k"
+  #else
+    #define NAME  "i2c_timing"
+  #endif
+
+  // AVR-Takte der Bitschleifen neben den Wartezeiten (kuerzerer Pfad)
+  #define W_LOW     10                    // i2c_write_nack
+  #define W_HIGH    8
+  #define R_LOW     4                     // i2c_read
+  #define R_HIGH    10
+
+  // Host: kleinste Anzahl Registerzugriffe von Flanke zu Flanke beim
+  // Schreiben bzw. Lesen eines Bytes mit ACK-Bit ("|=" / "&=" zaehlen
+  // mit Lesen und Schreiben doppelt, die Flanke liegt im Schreibzugriff)
+  #define H_LOW     3
+  #define H_HIGH    2
+  #define H_RLOW    2
+  #define H_RHIGH   2
+#endif
+
+#define SLAVE     0xd0
+
+#define MIN(a, b)   ( ((a) < (b)) ? (a) : (b) )
+
+int main(void)
+{
+  static uint8_t buf[8];
+  uint32_t wlow, whigh, per;
+
+  host_i2c_attach(SLAVE, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+  i2c_master_init();
+
+  // Host: erst nur schreiben, dann lesen (mit Adressbytes, also beide Schleifen)
+
+  CHECK(i2c_write_buf(SLAVE, 0x10, buf, sizeof(buf)), "write_buf ohne Acknowledge");
+  wlow= host_i2c_tlow;
+  whigh= host_i2c_thigh;
+  printf("  Host, schreiben: %lu / %lu Registerzugriffe neben den Wartezeiten\n",
+         (unsigned long)(wlow - I2C_TLOW_DEL), (unsigned long)(whigh - I2C_THIGH_DEL));
+  CHECK(wlow == I2C_TLOW_DEL + H_LOW, "low-Phase der Schreibschleife geaendert, I2C_OVH_LOW neu abzaehlen");
+  CHECK(whigh == I2C_THIGH_DEL + H_HIGH, "high-Phase der Schreibschleife geaendert, I2C_OVH_HIGH neu abzaehlen");
+
+  host_i2c_reset();
+  CHECK(i2c_read_buf(SLAVE, 0x10, buf, sizeof(buf)), "read_buf ohne Acknowledge");
+  printf("  Host, lesen    : %lu / %lu Registerzugriffe neben den Wartezeiten\n",
+         (unsigned long)(host_i2c_tlow - I2C_TLOW_DEL), (unsigned long)(host_i2c_thigh - I2C_THIGH_DEL));
+  CHECK(host_i2c_tlow == I2C_TLOW_DEL + H_RLOW, "low-Phase der Leseschleife geaendert, I2C_OVH_LOW neu abzaehlen");
+  CHECK(host_i2c_thigh == I2C_THIGH_DEL + H_RHIGH, "high-Phase der Leseschleife geaendert, I2C_OVH_HIGH neu abzaehlen");
+
+  // AVR: Zeiten aus Wartezeit und Listing
+
+  CHECK(I2C_OVH_LOW == MIN(W_LOW, R_LOW), "I2C_OVH_LOW passt nicht zum Listing");
+  CHECK(I2C_OVH_HIGH == MIN(W_HIGH, R_HIGH), "I2C_OVH_HIGH passt nicht zum Listing");
+
+  CHECK(I2C_TLOW_DEL + MIN(W_LOW, R_LOW) >= I2C_TLOW_MIN, "tLOW kleiner als Spezifikation");
+  CHECK(I2C_THIGH_DEL + MIN(W_HIGH, R_HIGH) >= I2C_THIGH_MIN, "tHIGH kleiner als Spezifikation");
+
+  per= I2C_TLOW_DEL + I2C_THIGH_DEL + MIN(W_LOW + W_HIGH, R_LOW + R_HIGH);
+  CHECK(per >= I2C_PERIOD_CYCLES, "Bustakt groesser als I2C_BUS_HZ");
+
+  printf("  F_CPU %lu, I2C_BUS_HZ %lu: tLOW %lu, tHIGH %lu Takte, AVR schreiben %.0f Hz, lesen %.0f Hz\n",
+         (unsigned long)F_CPU, (unsigned long)I2C_BUS_HZ,
+         (unsigned long)(I2C_TLOW_DEL + I2C_OVH_LOW), (unsigned long)(I2C_THIGH_DEL + I2C_OVH_HIGH),
+         (double)F_CPU / (I2C_TLOW_DEL + I2C_THIGH_DEL + W_LOW + W_HIGH),
+         (double)F_CPU / (I2C_TLOW_DEL + I2C_THIGH_DEL + R_LOW + R_HIGH));
+
+  return check_done(NAME);
+}
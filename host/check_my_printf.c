@@ -0,0 +1,184 @@
+/* -----------------------------------------------------
+                    check_my_printf.c
+
+    Test von bcd_conv.c und der Zahlenausgabe von
+    my_printf.c gegen sprintf der C-Bibliothek des PCs:
+
+      - bcd_dig16 fuer alle 16-Bit Werte und anz = 1..5
+      - bcd_dig32 fuer die Grenzwerte aller Zehnerpotenzen
+        und in Schritten von 9973 ueber den 32-Bit Bereich,
+        anz = 1..10
+      - bcd_8bit fuer 0..99
+      - own_sprintf %d, %u, %05d, %6d, %k (1..3 Nachkomma-
+        stellen) fuer alle 16-Bit Werte, %ld / %lu wie
+        bcd_dig32
+      - mit printf_long_enable=0 (make check: my_printf_16)
+        %ld / %lx: das long wird gelesen und gekuerzt. Auf
+        dem PC belegen int und long je einen Platz in der
+        Argumentliste, ob ein long vollstaendig gelesen
+        wird, zeigt sich erst auf dem AVR
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "bcd_conv.h"
+#include "my_printf.h"
+
+#define STEP32      9973ul
+
+static uint32_t fehler;
+
+void my_putchar(char c)
+{
+  (void)c;
+}
+
+/* -------------------------------------------------------
+                        dig_ok
+
+     vergleicht die Ziffern von bcd_dig16 / bcd_dig32 mit
+     value % 10^anz
+   ------------------------------------------------------- */
+static uint8_t dig_ok(uint32_t value, const uint8_t *dig, uint8_t anz)
+{
+  int8_t i;
+
+  for (i= anz - 1; i >= 0; i--)
+  {
+    if (dig[i] != value % 10) return 0;
+    value /= 10;
+  }
+  return 1;
+}
+
+/* -------------------------------------------------------
+                        cmp
+
+     vergleicht die Ausgabe von own_sprintf mit soll,
+     gibt die ersten Abweichungen aus
+   ------------------------------------------------------- */
+static void cmp(const char *ist, const char *soll)
+{
+  if (strcmp(ist, soll) == 0) return;
+  if (fehler < 5) printf("  \"%s\" statt \"%s\"\n", ist, soll);
+  fehler++;
+}
+
+/* -------------------------------------------------------
+                        check32
+
+     bcd_dig32, %ld und %lu fuer einen 32-Bit Wert
+   ------------------------------------------------------- */
+static void check32(uint32_t v, uint32_t *digfehler)
+{
+  uint8_t dig[10], anz;
+  #if (printf_long_enable == 1)
+    char  ist[24], soll[24];
+  #endif
+
+  for (anz= 1; anz <= 10; anz++)
+  {
+    memset(dig, 0xff, sizeof(dig));
+    bcd_dig32(v, dig, anz);
+    if (!dig_ok(v, dig, anz)) (*digfehler)++;
+  }
+  #if (printf_long_enable == 1)
+    own_sprintf(ist, (const uint8_t *)"%lu", (long)v);
+    sprintf(soll, "%lu", (unsigned long)v);
+    cmp(ist, soll);
+    own_sprintf(ist, (const uint8_t *)"%ld", (long)(int32_t)v);
+    sprintf(soll, "%ld", (long)(int32_t)v);
+    cmp(ist, soll);
+  #endif
+}
+
+int main(void)
+{
+  static const uint32_t pow10[]=
+    { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+  uint8_t  dig[10], anz, k;
+  uint32_t v, digfehler;
+  int32_t  i;
+  char     ist[24], soll[24];
+
+  // bcd_8bit
+  digfehler= 0;
+  for (v= 0; v< 100; v++)
+    if (bcd_8bit(v) != (((v / 10) << 4) | (v % 10))) digfehler++;
+  CHECK(digfehler == 0, "bcd_8bit");
+
+  // bcd_dig16, alle Werte
+  digfehler= 0;
+  for (v= 0; v< 0x10000; v++)
+  {
+    for (anz= 1; anz <= 5; anz++)
+    {
+      memset(dig, 0xff, sizeof(dig));
+      bcd_dig16(v, dig, anz);
+      if (!dig_ok(v, dig, anz)) digfehler++;
+    }
+  }
+  CHECK(digfehler == 0, "bcd_dig16");
+
+  // bcd_dig32, %ld, %lu
+  fehler= 0;
+  digfehler= 0;
+  for (k= 0; k< 10; k++)
+  {
+    check32(pow10[k] - 1, &digfehler);
+    check32(pow10[k], &digfehler);
+    check32(pow10[k] + 1, &digfehler);
+  }
+  check32(0xffffffff, &digfehler);
+  check32(0x7fffffff, &digfehler);
+  check32(0x80000000, &digfehler);
+  for (v= 0; v <= 0xffffffff - STEP32; v += STEP32) check32(v, &digfehler);
+  CHECK(digfehler == 0, "bcd_dig32");
+  #if (printf_long_enable == 1)
+    CHECK(fehler == 0, "%ld / %lu");
+  #else
+    // 16 Bit: long gekuerzt, die folgenden Argumente stimmen
+    own_sprintf(ist, (const uint8_t *)"%ld|%d|%lx|%u", 70000l, -5, 0x12345678l, 7);
+    CHECK(strcmp(ist, "4464|-5|5678|7") == 0, "%ld / %lx ohne printf_long_enable");
+  #endif
+
+  // %d, %u, Feldbreite, %k
+  fehler= 0;
+  for (i= -32768; i <= 32767; i++)
+  {
+    own_sprintf(ist, (const uint8_t *)"%d", (int)i);
+    sprintf(soll, "%d", (int)i);
+    cmp(ist, soll);
+
+    own_sprintf(ist, (const uint8_t *)"%u", (unsigned)(uint16_t)i);
+    sprintf(soll, "%u", (unsigned)(uint16_t)i);
+    cmp(ist, soll);
+
+    own_sprintf(ist, (const uint8_t *)"%05d|%6d", (int)i, (int)i);
+    sprintf(soll, "%05d|%6d", (int)i, (int)i);
+    cmp(ist, soll);
+
+    for (k= 1; k <= 3; k++)
+    {
+      printfkomma= k;
+      own_sprintf(ist, (const uint8_t *)"%k", (int)i);
+      v= (i < 0) ? -i : i;
+      sprintf(soll, "%s%lu.%0*lu", (i < 0) ? "-" : "", (unsigned long)(v / pow10[k]),
+              k, (unsigned long)(v % pow10[k]));
+      cmp(ist, soll);
+    }
+  }
+  printfkomma= 1;
+  CHECK(fehler == 0, "%d / %u / %05d / %6d / %k");
+
+  own_sprintf(ist, (const uint8_t *)"%.3k|%8.2k|%3d", 5, -1234, 12345);
+  CHECK(strcmp(ist, "0.005|  -12.34|12345") == 0, "%.3k / %8.2k / Feldbreite zu klein");
+
+  #if (printf_long_enable == 1)
+    return check_done("my_printf");
+  #else
+    return check_done("my_printf_16");
+  #endif
+}
@@ -0,0 +1,70 @@
+/* -----------------------------------------------------
+                     check_oled_fb.c
+
+    Test des Framebuffers von oled1306_i2c.c (oled_fb-
+    win_x/y = 0, 8 x 2 Zeichen) gegen den Slave aus
+    host_i2c.c
+
+    Direkte Ausgaben, die teilweise im Fenster liegen
+    (doublechar an Spalte 7, Bitmap ab Pixelspalte 56),
+    muessen im Puffer landen: ein danach in dieselbe
+    Zelle geschriebenes Leerzeichen muss von oled_flush
+    gesendet werden.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "check.h"
+#include "host_i2c.h"
+#include "oled1306_i2c.h"
+
+static const uint8_t img[] PROGMEM =
+  { 16, 8, BMP_PAGER,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+int main(void)
+{
+  host_i2c_attach(ssd1306_addr, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+
+  ssd1306_init();
+  clrscr();
+  oled_flush();
+
+  // Leerzeichen in eine unveraenderte Zelle: kein Bustransfer
+  gotoxy(7, 0);
+  oled_putchar(' ');
+  host_i2c_reset();
+  oled_flush();
+  CHECK(host_i2c_bytes == 0, "unveraenderte Zelle gesendet");
+
+  // doppelt grosses Zeichen ueber den rechten Fensterrand (direkt gesendet)
+  doublechar= 1;
+  gotoxy(7, 0);
+  oled_putchar('A');
+  doublechar= 0;
+
+  gotoxy(7, 0);
+  oled_putchar(' ');
+  host_i2c_reset();
+  oled_flush();
+  CHECK(host_i2c_bytes > 0, "doublechar: Zelle im Fenster nicht im Framebuffer");
+
+  // Bitmap ueber den rechten Fensterrand
+  oled_blit_P(56, 1, img);
+
+  gotoxy(7, 1);
+  oled_putchar(' ');
+  host_i2c_reset();
+  oled_flush();
+  CHECK(host_i2c_bytes > 0, "oled_blit_P: Zelle im Fenster nicht im Framebuffer");
+
+  // nach dem Flush entspricht der Puffer dem Display
+  gotoxy(7, 1);
+  oled_putchar(' ');
+  host_i2c_reset();
+  oled_flush();
+  CHECK(host_i2c_bytes == 0, "Zelle nach oled_flush erneut gesendet");
+
+  return check_done("oled_fb");
+}
@@ -0,0 +1,55 @@
+/* -----------------------------------------------------
+                       check_rtc.c
+
+    Test rtc_i2c gegen den Slave aus host_i2c.c: Lesen
+    des Datums in einer Transaktion, fehlende Antwort
+    des Bausteins, Dauer der Transaktion
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "check.h"
+#include "host_i2c.h"
+#include "rtc_i2c.h"
+
+int main(void)
+{
+  static const uint8_t regs[7] = { 0x56, 0x34, 0x12, 0x02, 0x11, 0x04, 0x17 };
+  struct my_datum date;
+  uint32_t t0;
+  uint8_t  i;
+
+  host_i2c_attach(rtc_addr, HOST_ADDR(sdapin), 1 << i2c_sdabitnr, 1 << i2c_sclbitnr);
+  for (i= 0; i< 7; i++) host_i2c_mem[i]= regs[i];
+  i2c_master_init();
+
+  // 11.04.2017 12:34:56, Dienstag
+  host_sync();
+  t0= host_cycles;
+  date= rtc_readdate();
+  host_sync();
+  CHECK(date.sek == 0x56 && date.min == 0x34 && date.std == 0x12, "Uhrzeit falsch");
+  CHECK(date.tag == 0x11 && date.monat == 0x04 && date.jahr == 0x17, "Datum falsch");
+  CHECK(date.dow == 2, "Wochentag falsch");
+  CHECK(host_i2c_starts == 2 && host_i2c_stops == 1, "keine einzelne Transaktion");
+  printf("  rtc_readdate: %lu Bytes auf dem Bus, %lu Takte (min.) = %.0f us bei %lu Hz I2C\n",
+         (unsigned long)host_i2c_bytes, (unsigned long)(host_cycles - t0),
+         (host_cycles - t0) * 1e6 / F_CPU, (unsigned long)I2C_BUS_HZ);
+
+  // zum Vergleich: Register einzeln lesen (vor der Umstellung auf i2c_read_buf)
+  host_sync();
+  t0= host_cycles;
+  for (i= 0; i< 7; i++) rtc_read(i);
+  host_sync();
+  printf("  7 x rtc_read  : %lu Takte (min.) = %.0f us\n",
+         (unsigned long)(host_cycles - t0), (host_cycles - t0) * 1e6 / F_CPU);
+
+  // Baustein antwortet nicht: keine Zufallswerte aus dem Puffer
+  host_i2c_nack= 1;
+  date= rtc_readdate();
+  CHECK(i2c_error == I2C_ERR_NACK, "NACK: i2c_error");
+  CHECK(!date.sek && !date.min && !date.std && !date.tag && !date.monat && !date.jahr && !date.dow,
+        "NACK: Datum nicht 0");
+
+  return check_done("rtc");
+}
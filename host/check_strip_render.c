@@ -0,0 +1,235 @@
+/* -----------------------------------------------------
+                   check_strip_render.c
+
+    Test von strip_render.c: eine Szene wird Streifen
+    fuer Streifen gerendert und Page fuer Page mit der-
+    selben Szene verglichen, die ohne Streifen in einen
+    kompletten Bildspeicher gezeichnet wurde (Punkt fuer
+    Punkt, Linien mit demselben Bresenham ohne Abbruch
+    am Streifenende). Die Szene enthaelt Ausgaben ueber
+    Streifengrenzen und Displayraender, Invertieren und
+    Text ueber einer Flaeche.
+
+    Ausserdem: Hintergrund strip_bkcolor, Teilaktuali-
+    sierung mit strip_renderrows und strip_render ohne
+    Ausgabefunktion.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "strip_render.h"
+
+#define PAGES       (strip_yres / 8)
+
+static uint8_t ref[PAGES][strip_xres];        // Bildspeicher ohne Streifen
+static uint8_t got[PAGES][strip_xres];        // von strip_output empfangen
+static uint8_t pagecnt[PAGES];
+static uint8_t outanz, badwidth, drawanz;
+static uint8_t useref;                        // 1: Szene in ref zeichnen
+
+/* -------------------------------------------------------
+                        output
+
+     strip_output: empfangene Pages aufzeichnen
+   ------------------------------------------------------- */
+static void output(uint8_t page, uint8_t *buf, uint8_t width)
+{
+  outanz++;
+  if (width != strip_xres) badwidth++;
+  if (page >= PAGES) return;
+  pagecnt[page]++;
+  memcpy(got[page], buf, strip_xres);
+}
+
+/* -------------------------------------------------------
+            Referenz: Zeichnen in den Bildspeicher
+   ------------------------------------------------------- */
+static void r_pix(int16_t x, int16_t y, uint8_t col)
+{
+  uint8_t *p, mask;
+
+  if ((x < 0) || (x >= strip_xres) || (y < 0) || (y >= strip_yres)) return;
+  p= &ref[y >> 3][x];
+  mask= 1 << (y & 7);
+  if (col == 1)      *p |= mask;
+  else if (col == 0) *p &= ~mask;
+  else               *p ^= mask;
+}
+
+static void r_fillrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  int16_t x, y, tmp;
+
+  if (x1 > x2) { tmp= x1; x1= x2; x2= tmp; }
+  if (y1 > y2) { tmp= y1; y1= y2; y2= tmp; }
+  for (y= y1; y <= y2; y++)
+    for (x= x1; x <= x2; x++) r_pix(x, y, col);
+}
+
+static void r_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  int16_t dx, dy, sx, err, e2, tmp;
+
+  if ((y1 == y2) || (x1 == x2)) { r_fillrect(x1, y1, x2, y2, col); return; }
+  if (y1 > y2)
+  {
+    tmp= x1; x1= x2; x2= tmp;
+    tmp= y1; y1= y2; y2= tmp;
+  }
+  dx= x2 - x1;
+  sx= 1;
+  if (dx < 0) { dx= -dx; sx= -1; }
+  dy= y1 - y2;
+  err= dx + dy;
+  for (;;)
+  {
+    r_pix(x1, y1, col);
+    if ((x1 == x2) && (y1 == y2)) break;
+    e2= 2 * err;
+    if (e2 >= dy) { err += dy; x1 += sx; }
+    if (e2 <= dx) { err += dx; y1++; }
+  }
+}
+
+static int16_t r_putchar(int16_t x, int16_t y, uint8_t ch, uint8_t col)
+{
+  uint8_t i, r, b;
+
+  if ((ch < 32) || (ch > lastascii)) ch= 92;
+  for (i= 0; i< 5; i++)
+  {
+    b= font5x7_byte(ch, i);
+    for (r= 0; r< 8; r++)
+      if (b & (1 << r)) r_pix(x + i, y + r, col);
+  }
+  return x + strip_fontx;
+}
+
+/* -------------------------------------------------------
+     Zeichenfunktionen der Szene: strip_... oder Referenz
+   ------------------------------------------------------- */
+static void d_pix(int16_t x, int16_t y, uint8_t col)
+{
+  if (useref) r_pix(x, y, col); else strip_putpixel(x, y, col);
+}
+
+static void d_fillrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  if (useref) r_fillrect(x1, y1, x2, y2, col); else strip_fillrect(x1, y1, x2, y2, col);
+}
+
+static void d_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  if (!useref) { strip_rect(x1, y1, x2, y2, col); return; }
+  r_fillrect(x1, y1, x2, y1, col);
+  r_fillrect(x1, y2, x2, y2, col);
+  r_fillrect(x1, y1, x1, y2, col);
+  r_fillrect(x2, y1, x2, y2, col);
+}
+
+static void d_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  if (useref) r_line(x1, y1, x2, y2, col); else strip_line(x1, y1, x2, y2, col);
+}
+
+static void d_string(int16_t x, int16_t y, char *s, uint8_t col)
+{
+  if (!useref) { strip_putstring(x, y, s, col); return; }
+  while (*s) x= r_putchar(x, y, *s++, col);
+}
+
+/* -------------------------------------------------------
+                        scene
+
+     strip_draw
+   ------------------------------------------------------- */
+static void scene(void)
+{
+  drawanz++;
+  d_rect(0, 0, strip_xres-1, strip_yres-1, 1);
+  d_fillrect(10, 5, 60, 20, 1);
+  d_string(12, 9, "Hallo", 2);                // ueber Flaeche und Streifengrenze
+  d_line(-10, 70, 140, -5, 2);                // flach, ueber alle Raender
+  d_line(20, 0, 31, strip_yres-1, 1);         // steil
+  d_line(120, 3, 5, 60, 0);
+  d_string(100, strip_yres-4, "xyz", 1);      // rechts und unten abgeschnitten
+  d_string(-3, 30, "T\x01~", 1);              // links abgeschnitten, Ersatzzeichen
+  d_pix(strip_xres-1, strip_yres-1, 2);
+  d_pix(-1, 5, 1);
+}
+
+/* -------------------------------------------------------
+                        render
+
+     zeichnet die Referenz mit Hintergrund bk und rendert
+     die Pages y1..y2 mit strip_renderrows
+   ------------------------------------------------------- */
+static void render(uint8_t bk, uint8_t y1, uint8_t y2)
+{
+  memset(ref, bk ? 0xff : 0x00, sizeof(ref));
+  useref= 1;
+  scene();
+  useref= 0;
+
+  memset(got, 0x55, sizeof(got));
+  memset(pagecnt, 0, sizeof(pagecnt));
+  outanz= 0;
+  badwidth= 0;
+  drawanz= 0;
+  strip_bkcolor= bk;
+  strip_renderrows(y1, y2);
+}
+
+/* -------------------------------------------------------
+                        pages_ok
+
+     Pages p1..p2 je einmal gesendet und gleich der
+     Referenz, die anderen nicht gesendet
+   ------------------------------------------------------- */
+static uint8_t pages_ok(uint8_t p1, uint8_t p2)
+{
+  uint8_t p;
+
+  for (p= 0; p< PAGES; p++)
+  {
+    if ((p < p1) || (p > p2))
+    {
+      if (pagecnt[p]) return 0;
+      continue;
+    }
+    if (pagecnt[p] != 1) return 0;
+    if (memcmp(got[p], ref[p], strip_xres))
+    {
+      printf("  Page %u weicht ab\n", p);
+      return 0;
+    }
+  }
+  return !badwidth;
+}
+
+int main(void)
+{
+  strip_output= output;
+  strip_draw= scene;
+
+  render(0, 0, strip_yres-1);
+  CHECK(outanz == PAGES && drawanz == PAGES, "strip_render: Anzahl Streifen");
+  CHECK(pages_ok(0, PAGES-1), "strip_render: Pages");
+
+  render(1, 0, strip_yres-1);
+  CHECK(pages_ok(0, PAGES-1), "strip_render: Pages mit strip_bkcolor 1");
+
+  render(0, 20, 35);
+  CHECK(pages_ok(20 / 8, 35 / 8), "strip_renderrows 20..35");
+
+  render(0, 60, 255);
+  CHECK(pages_ok(60 / 8, PAGES-1), "strip_renderrows ueber den unteren Rand");
+
+  strip_output= NULL;
+  render(0, 0, strip_yres-1);
+  CHECK(outanz == 0 && drawanz == 0, "strip_render ohne strip_output");
+
+  return check_done("strip_render");
+}
@@ -0,0 +1,284 @@
+/* -----------------------------------------------------
+                    check_tft_scroll.c
+
+    Test des Hardwarescrollings von tftdisplay.c (make
+    check: tft_scroll, tft_scroll=1, ST7735 128x128)
+
+    Die Bytes auf dem SPI werden wie in check_aafont.c
+    mitgeschnitten und in einem Modell des Controllers
+    ausgewertet: Display-Ram mit tft_gramrows Zeilen,
+    Adressfenster (coladdr / rowaddr, der Schreibzeiger
+    laeuft zeilenweise und beginnt am Fensterende wieder
+    oben), Scrollbereich (vscrdef) und Scrollposition
+    (vscrsadd). Das daraus sichtbare Bild wird mit dem
+    erwarteten Bild verglichen, das der Test selbst
+    fuehrt (lcd_scrollup schiebt es um rows Zeilen nach
+    oben, unten erscheint bkcolor).
+
+    Geprueft werden fillrect, blit und ein Zeichen mit
+    Hintergrund, die ueber der Umbruchzeile des Scroll-
+    bereichs liegen (Fenster muss geteilt werden), bei
+    outmode 0 und 3.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_hal.h"
+#include "tftdisplay.h"
+#include "font8x8.h"
+
+#define RAMYOFS       32                        // erste sichtbare Zeile im Display-Ram (128x128)
+
+static uint8_t  pina;                           // I/O-Adresse von PINA
+static uint8_t  usidr;                          // I/O-Adresse von USIDR
+static uint8_t  lastsck;
+static uint8_t  bitn, shift, dc;                // aktuelles Byte auf dem SPI
+
+static uint8_t  cmd;                            // letztes Kommando
+static uint8_t  parn;                           // Parameterbytes nach dem Kommando
+static uint8_t  par[6];
+static uint16_t xs, xe, ys, ye;                 // Adressfenster
+static uint16_t wx, wy;                         // Schreibzeiger
+static uint16_t tfa, vsa, ssa;                  // Scrollbereich, Scrollposition
+
+static uint16_t gram[tft_gramrows][_xres];      // Display-Ram
+static uint16_t soll[_yres][_xres];             // erwartetes Bild (logische Koordinaten)
+
+/* -------------------------------------------------------
+                        spi_byte
+
+     wertet ein gesendetes Byte aus (dc = 0: Kommando)
+   ------------------------------------------------------- */
+static void spi_byte(uint8_t b)
+{
+  if (!dc)
+  {
+    cmd= b;
+    parn= 0;
+    if (cmd == writereg) { wx= xs; wy= ys; }
+    return;
+  }
+  if (parn < sizeof(par)) par[parn]= b;
+  parn++;
+
+  switch (cmd)
+  {
+    case coladdr  : if (parn == 2) xs= (par[0] << 8) | par[1];
+                    if (parn == 4) xe= (par[2] << 8) | par[3];
+                    break;
+    case rowaddr  : if (parn == 2) ys= (par[0] << 8) | par[1];
+                    if (parn == 4) ye= (par[2] << 8) | par[3];
+                    break;
+    case vscrdef  : if (parn == 6)
+                    {
+                      tfa= (par[0] << 8) | par[1];
+                      vsa= (par[2] << 8) | par[3];
+                    }
+                    break;
+    case vscrsadd : if (parn == 2) ssa= (par[0] << 8) | par[1];
+                    break;
+    case writereg : if (parn < 2) break;
+                    parn= 0;
+                    if ((wy < tft_gramrows) && (wx < _xres)) gram[wy][wx]= (par[0] << 8) | par[1];
+                    if (++wx > xe)
+                    {
+                      wx= xs;
+                      if (++wy > ye) wy= ys;
+                    }
+                    break;
+    default       : break;
+  }
+}
+
+/* -------------------------------------------------------
+                        sck_hook
+
+     steigende Flanke an USCK: Bit aus dem MSB von USIDR
+     (host_pinhook)
+   ------------------------------------------------------- */
+static void sck_hook(void)
+{
+  uint8_t sck;
+
+  sck= host_pin(pina) & (1 << PA4);
+  if (sck == lastsck) return;
+  lastsck= sck;
+  if (!sck) return;
+
+  if (!bitn) dc= host_pin(pina) & (1 << PA0);
+  shift= (shift << 1) | (host_io[usidr] >> 7);
+  if (++bitn == 8)
+  {
+    bitn= 0;
+    spi_byte(shift);
+  }
+}
+
+/* -------------------------------------------------------
+                        visible
+
+     Farbe, die der Controller am logischen Punkt x,y an-
+     zeigt: Zeile des Panels -> Zeile im Display-Ram
+     ueber Scrollbereich und Scrollposition
+   ------------------------------------------------------- */
+static uint16_t visible(int x, int y)
+{
+  uint16_t line;
+
+  if (outmode == 3) { x= _xres-1-x; y= _yres-1-y; }
+  line= RAMYOFS + y;
+  if ((line >= tfa) && (line < tfa + vsa))
+    line= tfa + (line - tfa + ssa - tfa) % vsa;
+  return gram[line][x];
+}
+
+/* -------------------------------------------------------
+                        bild_ok
+
+     vergleicht das sichtbare mit dem erwarteten Bild
+   ------------------------------------------------------- */
+static uint8_t bild_ok(void)
+{
+  int      x, y;
+  uint16_t fehler= 0;
+
+  host_sync();
+  for (y= 0; y< _yres; y++)
+    for (x= 0; x< _xres; x++)
+      if (visible(x, y) != soll[y][x])
+      {
+        if (!fehler) printf("  erste Abweichung bei %d,%d\n", x, y);
+        fehler++;
+      }
+  return (fehler == 0);
+}
+
+/* -------------------------------------------------------
+             Ausgaben auf Display und Sollbild
+   ------------------------------------------------------- */
+static void t_clrscr(void)
+{
+  int x, y;
+
+  clrscr();
+  for (y= 0; y< _yres; y++)
+    for (x= 0; x< _xres; x++) soll[y][x]= bkcolor;
+}
+
+static void t_fill(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  int x, y;
+
+  fillrect(x1, y1, x2, y2, color);
+  for (y= y1; y <= y2; y++)
+    for (x= x1; x <= x2; x++) soll[y][x]= color;
+}
+
+static void t_scrollup(uint8_t rows)
+{
+  int x, y;
+
+  lcd_scrollup(rows);
+  memmove(soll[0], soll[rows], (_yres - rows) * sizeof(soll[0]));
+  for (y= _yres - rows; y< _yres; y++)
+    for (x= 0; x< _xres; x++) soll[y][x]= bkcolor;
+}
+
+static void t_blit(int x, int y, uint8_t w, uint8_t h)
+{
+  static uint16_t img[16 * 40];
+  uint16_t i;
+  uint8_t  xi, yi;
+
+  for (i= 0; i< w * h; i++) img[i]= 0x1000 + i;
+  blit(x, y, w, h, img);
+  for (yi= 0; yi< h; yi++)
+    for (xi= 0; xi< w; xi++) soll[y+yi][x+xi]= img[yi * w + xi];
+}
+
+/* -------------------------------------------------------
+                        glyph
+
+     Zeichen ch bei ungescrolltem Display ausgeben und
+     als Vorlage auslesen (Breite / Hoehe w)
+   ------------------------------------------------------- */
+static uint16_t tpl[16][16];
+
+static void glyph(uint8_t ch, uint8_t w)
+{
+  int x, y;
+
+  t_clrscr();
+  aktxp= 0; aktyp= 0;
+  lcd_putchar(ch);
+  host_sync();
+  for (y= 0; y< w; y++)
+    for (x= 0; x< w; x++) tpl[y][x]= visible(x, y);
+}
+
+static void t_putchar(int x0, int y0, uint8_t ch, uint8_t w)
+{
+  int x, y;
+
+  aktxp= x0; aktyp= y0;
+  lcd_putchar(ch);
+  for (y= 0; y< w; y++)
+    for (x= 0; x< w; x++) soll[y0+y][x0+x]= tpl[y][x];
+}
+
+int main(void)
+{
+  uint8_t mode, w;
+
+  pina= HOST_ADDR(PINA);
+  usidr= HOST_ADDR(USIDR);
+  host_sync();
+  lastsck= host_pin(pina) & (1 << PA4);
+  host_pinhook= sck_hook;
+  lcd_init();
+
+  CHECK(tfa == RAMYOFS && vsa == _yres && ssa == RAMYOFS, "Scrollbereich nach lcd_init");
+
+  textcolor= 0xffe0;
+  bkcolor= 0x0010;
+  textsize= 1;
+  w= fontsizex * 2;
+
+  for (mode= 0; mode< 2; mode++)
+  {
+    outmode= (mode) ? 3 : 0;
+
+    glyph('A', w);
+    CHECK(tpl[0][0] == bkcolor || tpl[0][0] == textcolor, "Vorlage des Zeichens");
+
+    t_clrscr();
+    t_fill(10, 96, 60, 127, 0x07e0);
+    CHECK(bild_ok(), (mode) ? "outmode 3: ohne Scrolling" : "outmode 0: ohne Scrolling");
+
+    t_scrollup(40);                             // Umbruchzeile jetzt bei y = 88
+    CHECK(bild_ok(), (mode) ? "outmode 3: lcd_scrollup" : "outmode 0: lcd_scrollup");
+
+    t_fill(5, 70, 70, 110, 0xf800);             // ueber die Umbruchzeile
+    CHECK(bild_ok(), (mode) ? "outmode 3: fillrect ueber der Umbruchzeile" : "outmode 0: fillrect ueber der Umbruchzeile");
+
+    t_putchar(80, 80, 'A', w);                  // Zeilen 80..95
+    CHECK(bild_ok(), (mode) ? "outmode 3: Zeichen ueber der Umbruchzeile" : "outmode 0: Zeichen ueber der Umbruchzeile");
+
+    if (!mode)                                  // blit: ein Fenster nur bei outmode 0
+    {
+      t_blit(100, 75, 16, 30);
+      CHECK(bild_ok(), "blit ueber der Umbruchzeile");
+    }
+
+    t_scrollup(100);                            // Ueberlauf der Scrollposition
+    t_fill(0, 20, 127, 30, 0x001f);
+    CHECK(bild_ok(), (mode) ? "outmode 3: zweimal gescrollt" : "outmode 0: zweimal gescrollt");
+
+    t_clrscr();
+    CHECK(bild_ok() && (ssa == RAMYOFS), (mode) ? "outmode 3: clrscr" : "outmode 0: clrscr");
+  }
+
+  return check_done("tft_scroll");
+}
@@ -0,0 +1,246 @@
+/* -----------------------------------------------------
+                     check_uart_all.c
+
+    Test von uart_all.c (USI-Serial des ATtiny44):
+    Empfangspuffer, Fehlerzaehler, uart_read, Zeilen-
+    callback (make check: uart_all, uart_lineassembly=1)
+    und das Senden waehrend eines Empfangs
+
+    Wie in check_usiuart.c werden die Interruptroutinen
+    von Hand in der Reihenfolge aufgerufen, in der sie
+    die Hardware ausloesen wuerde. Beim Senden ruft
+    host_tickhook den USI-Overflow auf und beendet einen
+    zuvor begonnenen Empfang nach RX_TICKS Takten.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_hal.h"
+#include "uart_all.h"
+
+#define RX_TICKS    200                       // Restdauer eines begonnenen Empfangs
+
+void USI_OVF_vect(void);
+void PCINT0_vect(void);
+void TIM0_COMPA_vect(void);
+
+static uint8_t tx[8];                         // auf der Leitung gesendete Zeichen
+static uint8_t txanz;
+static uint8_t in_hook = 0;
+
+static uint8_t  rx_pending = 0;               // begonnener Empfang, Zeichen
+static uint8_t  rx_char;
+static uint32_t rx_end;
+static uint8_t  tx_during_rx;                 // Senden vor Ende des Empfangs gestartet
+static uint8_t  startbit_in_tx = 0;           // 1: waehrend des Sendens trifft ein Startbit ein
+
+static char    line[32];
+static uint8_t linelen;
+static uint8_t lines = 0;
+
+/* -------------------------------------------------------
+                        reverse
+   ------------------------------------------------------- */
+static uint8_t reverse(uint8_t x)
+{
+  uint8_t i, r= 0;
+
+  for (i= 0; i< 8; i++)
+  {
+    r= (r << 1) | (x & 1);
+    x >>= 1;
+  }
+  return r;
+}
+
+/* -------------------------------------------------------
+                        pcif_clear
+
+     PCIF0 loeschen: das Schreiben einer 1 auf das gesetzte
+     Flag (rx_restart) ist im Host-Build nicht erkennbar
+     (derselbe Wert), beim Einsprung in PCINT0_vect loescht
+     es die Hardware
+   ------------------------------------------------------- */
+static void pcif_clear(void)
+{
+  host_input(HOST_ADDR(GIFR), 0);
+}
+
+/* -------------------------------------------------------
+                        rx_begin
+
+     Startbit an DI, Pinchange und Compare Match in der
+     Mitte des Startbits: die USI empfaengt. Bei noise
+     ist das Startbit dann schon wieder vorbei
+   ------------------------------------------------------- */
+static void rx_begin(uint8_t noise)
+{
+  host_extpin(HOST_ADDR(PINA), 1 << PA6, 0);
+  pcif_clear();
+  PCINT0_vect();
+  if (noise) host_extpin(HOST_ADDR(PINA), 1 << PA6, 1);
+  TIM0_COMPA_vect();
+}
+
+/* -------------------------------------------------------
+                        rx_finish
+
+     8 Datenbits empfangen, Stopbit mit Pegel stop
+   ------------------------------------------------------- */
+static void rx_finish(uint8_t ch, uint8_t stop)
+{
+  USIBR= reverse(ch);
+  USI_OVF_vect();
+  host_extpin(HOST_ADDR(PINA), 1 << PA6, stop);
+  TIM0_COMPA_vect();                          // Mitte des Stopbits
+  host_extpin(HOST_ADDR(PINA), 1 << PA6, 1);
+  pcif_clear();
+}
+
+/* -------------------------------------------------------
+                        rx_char_in
+   ------------------------------------------------------- */
+static void rx_char_in(uint8_t ch)
+{
+  rx_begin(0);
+  rx_finish(ch, 1);
+}
+
+/* -------------------------------------------------------
+                        usi_hw
+
+     host_tickhook: beendet einen begonnenen Empfang und
+     zeichnet gesendete Frames auf (USIWM0 = Three-Wire
+     Modus, die USI sendet). Interrupts nur bei gesetztem
+     I-Bit
+   ------------------------------------------------------- */
+static void usi_hw(void)
+{
+  uint8_t first, second;
+
+  if (in_hook || !(host_io[0x3f] & (1 << SREG_I))) return;
+  in_hook= 1;
+
+  if (USICR & (1 << USIWM0))
+  {
+    if (rx_pending) tx_during_rx= 1;
+    if (startbit_in_tx)                       // Startbit mitten im Sendeframe
+    {
+      host_extpin(HOST_ADDR(PINA), 1 << PA6, 0);
+      host_extpin(HOST_ADDR(PINA), 1 << PA6, 1);
+      startbit_in_tx= 0;
+    }
+    first= USIDR;
+    USI_OVF_vect();                           // Startbit + 7 Datenbits gesendet
+    second= USIDR;
+    USI_OVF_vect();                           // Datenbit 7 + Stopbit gesendet
+    if (txanz < sizeof(tx)) tx[txanz++]= reverse((first << 1) | (second >> 7));
+  }
+  else if (rx_pending && (host_cycles >= rx_end))
+  {
+    rx_pending= 0;
+    rx_finish(rx_char, 1);
+  }
+
+  in_hook= 0;
+}
+
+#if (uart_lineassembly == 1)
+
+/* -------------------------------------------------------
+                        linecb
+   ------------------------------------------------------- */
+static void linecb(char *l, uint8_t len)
+{
+  strcpy(line, l);
+  linelen= len;
+  lines++;
+}
+
+#endif
+
+int main(void)
+{
+  uint8_t  buf[uart_rxfifo_size + 4];
+  uint8_t  i, anz;
+  uint32_t t0;
+
+  uart_init();
+  CHECK(GIMSK & (1 << PCIE0), "Pinchange-Interrupt nach uart_init gesperrt");
+
+  // Empfangspuffer: Reihenfolge, uart_ischar, uart_getchar
+  rx_char_in('a'); rx_char_in('b'); rx_char_in('c');
+  CHECK(uart_ischar(), "uart_ischar");
+  CHECK(uart_getchar() == 'a' && uart_getchar() == 'b' && uart_getchar() == 'c', "Reihenfolge im Empfangspuffer");
+  CHECK(!uart_ischar(), "Empfangspuffer nicht leer");
+  CHECK(GIMSK & (1 << PCIE0), "Pinchange-Interrupt nach Empfang gesperrt");
+
+  // Ueberlauf: der Puffer fasst uart_rxfifo_size - 1 Zeichen
+  for (i= 0; i< uart_rxfifo_size + 2; i++) rx_char_in('A' + i);
+  CHECK(uart_err_overrun == 3, "uart_err_overrun");
+  anz= uart_read(buf, sizeof(buf), 0);
+  CHECK(anz == uart_rxfifo_size - 1, "uart_read: Anzahl bei vollem Puffer");
+  for (i= 0; i< anz; i++) if (buf[i] != 'A' + i) break;
+  CHECK(i == anz, "uart_read: Inhalt");
+
+  // Stopbit low: Zeichen verworfen, Startbit bei der Abtastung vorbei: Stoerimpuls
+  rx_begin(0);
+  rx_finish('x', 0);
+  CHECK(uart_err_frame == 1 && !uart_ischar(), "uart_err_frame");
+  rx_begin(1);
+  CHECK(uart_err_noise == 1 && !uart_ischar(), "uart_err_noise");
+  CHECK(GIMSK & (1 << PCIE0), "Pinchange-Interrupt nach Fehler gesperrt");
+  pcif_clear();
+
+  // uart_read mit Timeout: 2 Zeichen vorhanden, 4 verlangt
+  rx_char_in('1'); rx_char_in('2');
+  t0= host_cycles;
+  anz= uart_read(buf, 4, 5);
+  CHECK(anz == 2 && buf[0] == '1' && buf[1] == '2', "uart_read mit Timeout: Zeichen");
+  CHECK(host_cycles - t0 >= 5ul * (F_CPU / 1000), "uart_read: Timeout nicht abgewartet");
+
+  // Senden waehrend eines Empfangs: erst nach dem Stopbit
+  host_tickhook= usi_hw;
+  rx_begin(0);
+  rx_char= 'r';
+  rx_end= host_cycles + RX_TICKS;
+  rx_pending= 1;
+  tx_during_rx= 0;
+  uart_putchar('t');
+  CHECK(!tx_during_rx, "Senden vor dem Ende des Empfangs gestartet");
+  CHECK(txanz == 1 && tx[0] == 't', "gesendetes Zeichen");
+  CHECK(uart_ischar() && uart_getchar() == 'r', "Zeichen waehrend des Wartens verloren");
+  CHECK(uart_err_overrun == 3 && uart_err_frame == 1, "Fehler beim Senden nach Empfang gezaehlt");
+
+  // Startbit waehrend des Sendens: gezaehlt, Empfang danach wieder frei
+  startbit_in_tx= 1;
+  uart_putchar('u');
+  CHECK(txanz == 2 && tx[1] == 'u', "gesendetes Zeichen (Startbit beim Senden)");
+  CHECK(uart_err_overrun == 4, "Startbit beim Senden nicht gezaehlt");
+  CHECK(GIMSK & (1 << PCIE0), "Pinchange-Interrupt nach dem Senden gesperrt");
+  pcif_clear();
+  uart_putchar('v');
+  CHECK(uart_err_overrun == 4, "Senden ohne Startbit gezaehlt");
+  host_tickhook= NULL;
+
+  #if (uart_lineassembly == 1)
+    // Zeilen: '\n' ignoriert, Zeichen ueber uart_linebuf_size - 1 verworfen
+    uart_linecallback= linecb;
+    for (i= 0; i< 6; i++) rx_char_in("ab\ncd\r"[i]);
+    uart_linepoll();
+    CHECK(lines == 1 && linelen == 4 && !strcmp(line, "abcd"), "uart_linepoll: Zeile");
+    for (i= 0; i< uart_linebuf_size + 3; i++)
+    {
+      rx_char_in('0' + (i % 10));
+      if (!(i & 7)) uart_linepoll();          // Empfangspuffer nicht ueberlaufen lassen
+    }
+    rx_char_in('\r');
+    uart_linepoll();
+    CHECK(lines == 2 && linelen == uart_linebuf_size - 1 && line[0] == '0', "uart_linepoll: lange Zeile");
+    return check_done("uart_all (Zeilen)");
+  #else
+    return check_done("uart_all");
+  #endif
+}
@@ -0,0 +1,81 @@
+/* -----------------------------------------------------
+                     check_usi_spi.c
+
+    SCK-Frequenz von usi_spi.c: aus dem kleinsten Abstand
+    zweier Pegelwechsel an USCK (PA4) in virtuellen
+    Takten. Jeder Schreibzugriff auf USICR zaehlt 1 Takt
+    (out), die Wartetakte aus spi_half() kommen hinzu.
+    Auf dem ATtiny44 dauert eine Halbperiode mindestens
+    so lange, die gemessene Frequenz ist damit eine obere
+    Schranke.
+
+      usi_spi     : ohne spi_maxclk, SCK = F_CPU / 2
+      usi_spi_2m  : spi_maxclk = 2 MHz
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "check.h"
+#include "host_hal.h"
+#include "usi_spi.h"
+
+#define ANZ         100
+
+static uint8_t  pina;                           // I/O-Adresse von PINA
+static uint8_t  lastsck;
+static uint32_t lastedge;                       // 0: noch keine Flanke
+static uint32_t minhalf = 0xffffffff;           // kleinste Halbperiode in Takten
+
+/* -------------------------------------------------------
+                        sck_hook
+
+     Pegelwechsel an PA4 (host_pinhook)
+   ------------------------------------------------------- */
+static void sck_hook(void)
+{
+  uint8_t sck;
+
+  sck= host_pin(pina) & (1 << PA4);
+  if (sck == lastsck) return;
+  lastsck= sck;
+  if (lastedge && (host_cycles - lastedge < minhalf)) minhalf= host_cycles - lastedge;
+  lastedge= host_cycles;
+}
+
+int main(void)
+{
+  static uint8_t buf[ANZ];
+  uint32_t t0, takte, sck;
+  uint8_t  i;
+
+  for (i= 0; i< ANZ; i++) buf[i]= i * 37;
+
+  pina= HOST_ADDR(PINA);
+  spi_init();
+  host_watch(HOST_ADDR(PORTA), 1 << PA4);
+  host_sync();
+  host_edges= 0;
+  t0= host_cycles;
+  lastsck= host_pin(pina) & (1 << PA4);
+  lastedge= 0;
+  host_pinhook= sck_hook;
+
+  spi_outbuf(buf, ANZ);
+
+  host_sync();
+  takte= host_cycles - t0;
+  CHECK(host_edges == ANZ * 16, "Anzahl Flanken an SCK");
+
+  sck= F_CPU / (2 * minhalf);
+  printf("  SCK <= %lu Hz (spi_maxclk %lu), %lu Takte je Byte\n", (unsigned long)sck,
+         (unsigned long)spi_maxclk, (unsigned long)(takte / ANZ));
+
+#if (spi_maxclk == 0)
+  CHECK(sck <= F_CPU / 2, "SCK > F_CPU / 2");
+#else
+  CHECK(sck <= spi_maxclk, "SCK > spi_maxclk");
+  CHECK(sck > spi_maxclk / 2, "SCK unnoetig langsam");
+#endif
+
+  return check_done((spi_maxclk) ? "usi_spi (spi_maxclk)" : "usi_spi");
+}
@@ -0,0 +1,211 @@
+/* -----------------------------------------------------
+                     check_usiuart.c
+
+    Test des Sendepuffers von usiuart.c, halbduplex
+    (make check: usiuart) und vollduplex (usiuart_fd)
+
+    host_hal.c fuehrt keine Interrupts aus und bildet
+    weder Timer0 noch die von Timer0 getaktete USI nach.
+    Die Interruptroutinen werden hier deshalb von Hand in
+    der Reihenfolge aufgerufen, in der sie die Hardware
+    ausloesen wuerde. Geprueft wird damit die Logik von
+    Sendepuffer und Interrupts (Reihenfolge der Zeichen,
+    uart_txoverflow, Aufschieben des Sendens waehrend
+    eines Empfangs), nicht aber Bitzeiten und Latenzen.
+
+    Halbduplex werden die Frames aus USIDR zurueckge-
+    rechnet:
+
+       1. Teil: Startbit + Datenbits 0..6  (rev >> 1)
+       2. Teil: Datenbit 7 + Stopbit       (rev << 7 | 0x7f)
+
+    Vollduplex aus dem Pegel, den TIM1_COMPA_vect in
+    TCCR1A fuer das naechste Bit an OC1B einstellt. Ein
+    Empfang wird mitten in einem Sendeframe eingeschoben;
+    ob Senden und Empfangen bei 19200 Baud zeitlich
+    nebeneinander bestehen (Latenz der ISRs gegen die
+    Bitzeit), laesst sich ohne Interrupts und Timer im
+    Host-Build nicht pruefen.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+#include "check.h"
+#include "host_hal.h"
+#include "usiuart.h"
+
+void USI_OVF_vect(void);
+void PCINT0_vect(void);
+void TIM0_COMPA_vect(void) __attribute__((weak));   // fehlt bei Schnellstart
+void TIM1_COMPA_vect(void);
+
+extern volatile uint8_t serialinput;
+
+static uint8_t rx[64];                        // auf der Leitung gesendete Zeichen
+static uint8_t rxanz;
+
+/* -------------------------------------------------------
+                        reverse
+   ------------------------------------------------------- */
+static uint8_t reverse(uint8_t x)
+{
+  uint8_t i, r= 0;
+
+  for (i= 0; i< 8; i++)
+  {
+    r= (r << 1) | (x & 1);
+    x >>= 1;
+  }
+  return r;
+}
+
+/* -------------------------------------------------------
+                        rx_start
+
+     Startbit an DI, Pinchange und (ohne Schnellstart)
+     Timer0 Compare Match: die USI empfaengt
+   ------------------------------------------------------- */
+static void rx_start(void)
+{
+  host_extpin(HOST_ADDR(PINA), 1 << USI_DI, 0);
+  PCINT0_vect();
+  host_extpin(HOST_ADDR(PINA), 1 << USI_DI, 1);
+  if (TIM0_COMPA_vect) TIM0_COMPA_vect();     // Mitte des Startbits
+}
+
+#if (uart_fullduplex == 0)
+
+/* -------------------------------------------------------
+                        usi_drain
+
+     ruft den USI-Overflow Interrupt auf, solange die USI
+     als Sender laeuft (USIWM0 = Three-Wire Modus) und
+     zeichnet die gesendeten Frames auf
+   ------------------------------------------------------- */
+static void usi_drain(void)
+{
+  uint8_t first, second;
+
+  while ((USICR & (1 << USIWM0)) && (rxanz < sizeof(rx)))
+  {
+    first= USIDR;
+    USI_OVF_vect();                           // Startbit + 7 Datenbits gesendet
+    second= USIDR;
+    USI_OVF_vect();                           // Datenbit 7 + Stopbit gesendet
+    CHECK((first & 0x80) == 0, "Startbit nicht 0");
+    CHECK((second & 0x40) != 0, "Stopbit nicht 1");
+    rx[rxanz++]= reverse((first << 1) | (second >> 7));
+  }
+}
+
+int main(void)
+{
+  static const uint8_t text[]= "0123456789ABCDEFGHIJ";
+  uint32_t t0, t;
+  uint8_t  anz;
+
+  uart_init();
+
+  // 20 Zeichen in einen Puffer mit 16 Plaetzen: 15 werden uebernommen
+  t0= host_cycles;
+  anz= uart_write(text, 20);
+  t= host_cycles - t0;
+
+  CHECK(anz == uart_txfifo_size - 1, "Anzahl uebernommener Zeichen");
+  CHECK(uart_txoverflow == 20 - anz, "uart_txoverflow");
+  CHECK(USICR & (1 << USIOIE), "Sender nicht gestartet");
+  CHECK(!(GIMSK & (1 << PCIE0)), "Empfang waehrend des Sendens nicht gesperrt");
+
+  usi_drain();
+  CHECK(rxanz == anz, "Anzahl gesendeter Zeichen");
+  CHECK(memcmp(rx, text, anz) == 0, "Reihenfolge / Inhalt der Zeichen");
+  CHECK(GIMSK & (1 << PCIE0), "Empfang nach dem Senden nicht freigegeben");
+
+  printf("  uart_write(20): %lu virtuelle Takte (Registerzugriffe), blockierend: %lu Takte\n",
+         (unsigned long)t, (unsigned long)(20ul * 10 * ((F_CPU) / (BAUDRATE))));
+
+  // waehrend eines Empfangs eingetragene Zeichen werden erst danach gesendet
+  rxanz= 0;
+  rx_start();
+  uart_putchar('x');
+  CHECK(!(USICR & (1 << USIWM0)), "Senden waehrend des Empfangs gestartet");
+
+  USIBR= reverse('k');
+  USI_OVF_vect();                             // 8 Datenbits empfangen
+  CHECK(uart_ischar() && (serialinput == 'k'), "empfangenes Zeichen");
+
+  usi_drain();
+  CHECK((rxanz == 1) && (rx[0] == 'x'), "aufgeschobenes Zeichen nicht gesendet");
+
+  return check_done("usiuart");
+}
+
+#else
+
+/* -------------------------------------------------------
+                        tim1_drain
+
+     ruft TIM1_COMPA_vect auf, solange der Sender laeuft
+     (OCIE1A) und setzt die Frames aus den Pegeln in
+     TCCR1A zusammen. Beim rxbit-ten Aufruf wird ein
+     Empfang des Zeichens 'k' eingeschoben.
+   ------------------------------------------------------- */
+static void tim1_drain(uint16_t rxbit)
+{
+  static uint8_t lv[1024];
+  uint16_t n, i, k;
+  uint8_t  b;
+
+  n= 0;
+  while ((TIMSK1 & (1 << OCIE1A)) && (n < sizeof(lv)))
+  {
+    if (n == rxbit)
+    {
+      rx_start();
+      USIBR= reverse('k');
+      USI_OVF_vect();
+    }
+    TIM1_COMPA_vect();
+    lv[n++]= (TCCR1A & (1 << COM1B0)) ? 1 : 0;
+  }
+  CHECK(!(TIMSK1 & (1 << OCIE1A)), "Sender endet nicht");
+
+  for (i= 0; i< n; )
+  {
+    if (lv[i]) { i++; continue; }             // Ruhepegel
+    CHECK(i + 9 < n, "Frame unvollstaendig");
+    if (i + 9 >= n) break;
+    b= 0;
+    for (k= 0; k< 8; k++) b |= lv[i + 1 + k] << k;
+    CHECK(lv[i + 9] == 1, "Stopbit nicht 1");
+    if (rxanz < sizeof(rx)) rx[rxanz++]= b;
+    i += 10;
+  }
+}
+
+int main(void)
+{
+  static const uint8_t text[]= "0123456789ABCDEFGHIJ";
+  uint8_t  anz;
+
+  uart_init();
+  CHECK(TCCR1A & (1 << COM1B0), "OC1B nicht high nach uart_init");
+
+  anz= uart_write(text, 20);
+  CHECK(anz == uart_txfifo_size - 1, "Anzahl uebernommener Zeichen");
+  CHECK(uart_txoverflow == 20 - anz, "uart_txoverflow");
+  CHECK(TIMSK1 & (1 << OCIE1A), "Sender nicht gestartet");
+  CHECK(GIMSK & (1 << PCIE0), "Empfang waehrend des Sendens gesperrt");
+
+  // Empfang mitten im 2. Sendeframe (Datenbit 4)
+  tim1_drain(15);
+  CHECK(rxanz == anz, "Anzahl gesendeter Zeichen");
+  CHECK(memcmp(rx, text, anz) == 0, "Reihenfolge / Inhalt der Zeichen");
+  CHECK(uart_ischar() && (serialinput == 'k'), "waehrend des Sendens empfangenes Zeichen");
+  CHECK(GIMSK & (1 << PCIE0), "Pinchange nach dem Empfang nicht freigegeben");
+
+  return check_done("usiuart_fd");
+}
+
+#endif
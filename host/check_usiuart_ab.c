@@ -0,0 +1,144 @@
+/* -----------------------------------------------------
+                   check_usiuart_ab.c
+
+    Test der automatischen Baudratenerkennung von
+    usiuart.c (make check: usiuart_ab, autobaud_enable=1)
+
+    host_tickhook bildet dafuer Timer0 mit Prescaler 1
+    nach (TCNT0 zaehlt mit host_cycles, TOV0 beim Ueber-
+    lauf) und legt an DI das Synchronisationszeichen 0x55
+    mit BITT Takten je Bit an. uart_autobaud misst in
+    Host-Takten, erwartet werden deshalb BITT Takte pro
+    Bit und die daraus berechneten Timer0 Einstellungen.
+
+    TOV0 wird durch Schreiben einer 1 geloescht. Steht
+    das Flag bereits, ist dieser Schreibzugriff im Host-
+    Build nicht erkennbar (derselbe Wert). Bit 7 von
+    TIFR0 (reserviert) wird deshalb gesetzt gehalten,
+    damit jeder Schreibzugriff den Inhalt veraendert.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "check.h"
+#include "host_hal.h"
+#include "usiuart.h"
+
+#define TIFR0_MARK    0x80                    // reserviertes Bit, s.o.
+
+static uint32_t bitt;                         // Takte je Bit der Gegenstelle
+static uint32_t t_start;                      // Beginn des Startbits
+static uint32_t t_last;                       // Timer0 zuletzt nachgefuehrt
+static uint8_t  di_level = 1;
+static uint8_t  in_hook = 0;
+
+// Registeradressen fuer ab_hw (HOST_ADDR ist selbst ein Registerzugriff)
+static uint8_t  a_pina, a_tcnt0, a_tccr0b, a_tifr0;
+
+/* -------------------------------------------------------
+                        di_set
+   ------------------------------------------------------- */
+static void di_set(uint8_t level)
+{
+  if (level == di_level) return;
+  di_level= level;
+  host_extpin(a_pina, 1 << USI_DI, level);
+}
+
+/* -------------------------------------------------------
+                        ab_hw
+
+     host_tickhook: Timer0 (nur Prescaler 1) und Pegel an
+     DI: Startbit, Datenbits 0x55 (LSB zuerst), Stopbit
+   ------------------------------------------------------- */
+static void ab_hw(void)
+{
+  uint32_t cnt, bit;
+
+  if (in_hook) return;
+  in_hook= 1;
+
+  if ((host_io[a_tccr0b] & 0x07) == 1)
+  {
+    cnt= host_io[a_tcnt0] + (host_cycles - t_last);
+    host_input(a_tcnt0, cnt & 0xff);
+    if (cnt > 0xff) host_input(a_tifr0, host_io[a_tifr0] | (1 << TOV0));
+  }
+  t_last= host_cycles;
+
+  if (host_cycles < t_start) di_set(1);
+  else
+  {
+    bit= (host_cycles - t_start) / bitt;
+    if (bit == 0) di_set(0);                  // Startbit
+    else if (bit <= 8) di_set((0x55 >> (bit - 1)) & 1);
+    else di_set(1);                           // Stopbit, Ruhepegel
+  }
+
+  in_hook= 0;
+}
+
+/* -------------------------------------------------------
+                        measure
+
+     sendet 0x55 mit baud und ruft uart_autobaud auf
+   ------------------------------------------------------- */
+static uint16_t measure(uint32_t baud)
+{
+  uint16_t cyc;
+
+  bitt= (F_CPU + baud / 2) / baud;
+  t_last= host_cycles;
+  t_start= host_cycles + 3 * bitt;
+  host_tickhook= ab_hw;
+  cyc= uart_autobaud();
+  host_tickhook= NULL;
+  return cyc;
+}
+
+/* -------------------------------------------------------
+                        check_baud
+   ------------------------------------------------------- */
+static void check_baud(uint32_t baud)
+{
+  uint16_t cyc;
+  uint8_t  div;
+  char     msg[64];
+
+  cyc= measure(baud);
+  printf("  %6lu Baud: %lu Takte je Bit, gemessen %u\n", (unsigned long)baud, (unsigned long)bitt, cyc);
+
+  snprintf(msg, sizeof(msg), "%lu Baud: Takte je Bit", (unsigned long)baud);
+  CHECK((cyc + 1 >= bitt) && (cyc <= bitt + 1), msg);
+
+  div= (cyc > 255) ? 8 : 1;
+  snprintf(msg, sizeof(msg), "%lu Baud: Timer0 Einstellung", (unsigned long)baud);
+  CHECK((TCCR0B == ((div == 8) ? 2 : 1)) && (OCR0A == (cyc + div / 2) / div - 1), msg);
+  CHECK(GIMSK & (1 << PCIE0), "Empfang nach der Messung gesperrt");
+}
+
+int main(void)
+{
+  uint8_t ocr, cs;
+
+  a_pina= HOST_ADDR(PINA);
+  a_tcnt0= HOST_ADDR(TCNT0);
+  a_tccr0b= HOST_ADDR(TCCR0B);
+  a_tifr0= HOST_ADDR(TIFR0);
+
+  uart_init();
+  host_input(a_tifr0, TIFR0_MARK);
+
+  check_baud(9600);
+  check_baud(38400);
+  check_baud(115200);
+
+  // 250000 Baud: zu wenige Takte je Bit fuer den Schnellstart des Empfangs,
+  // die Einstellung bleibt
+  ocr= OCR0A;
+  cs= TCCR0B;
+  CHECK(measure(250000) == 0, "250000 Baud: nicht abgewiesen");
+  CHECK((OCR0A == ocr) && (TCCR0B == cs), "250000 Baud: Einstellung veraendert");
+
+  return check_done("usiuart_ab");
+}
@@ -0,0 +1,101 @@
+/* -----------------------------------------------------
+                      check_zfont.c
+
+    Test des Decoders zfont.c mit den komprimierten
+    Zeichensaetzen (make check: zfont):
+
+      zfont8x8  : src/zfont8x8.c  (Zeichen 32..132)
+      zfont8x8h : src/zfont8x8h.c (Zeichen 32..130)
+      zfont5x7  : mit fontcomp erzeugt (bin/zfont5x7.c),
+                  5 Bytes je Zeichen, also Bloecke ueber
+                  Zeichengrenzen und ein unvollstaendiger
+                  letzter Block
+
+    Jedes Byte, das zfont_getbyte liefert, wird mit dem
+    Byte aus dem unkomprimierten Zeichensatz verglichen:
+    der Reihe nach, rueckwaerts und in zufaelliger
+    Reihenfolge ueber alle drei Zeichensaetze (jeder
+    Wechsel von Zeichensatz oder Block erzwingt eine
+    neue Suche im Decoder).
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <stdlib.h>
+#include "check.h"
+#include "font5x7.h"
+#include "font8x8.h"
+#include "font8x8h.h"
+#include "zfont.h"
+
+#define RANDOM_ANZ    50000                   // Zugriffe in zufaelliger Reihenfolge
+
+extern const zfont_t zfont8x8;
+extern const zfont_t zfont8x8h;
+extern const zfont_t zfont5x7;
+
+typedef struct
+{
+  const char     *name;
+  const zfont_t  *z;                          // komprimiert
+  const uint8_t  *raw;                        // unkomprimiert
+  uint16_t       anz;                         // Bytes
+} testfont_t;
+
+static const testfont_t fonts[] =
+{
+  { "zfont8x8",  &zfont8x8,  &font8x8[0][0],  (132 - 31) * 8 },
+  { "zfont8x8h", &zfont8x8h, &font8x8h[0][0], (130 - 31) * 8 },
+  { "zfont5x7",  &zfont5x7,  &fonttab[0][0],  (lastascii - 31) * 5 }
+};
+
+#define FONTANZ       (sizeof(fonts) / sizeof(fonts[0]))
+
+/* -------------------------------------------------------
+                        byte_ok
+
+     vergleicht das Byte an Position pos, gibt die erste
+     Abweichung eines Zeichensatzes aus
+   ------------------------------------------------------- */
+static uint8_t byte_ok(const testfont_t *f, uint16_t pos)
+{
+  uint8_t z, r;
+
+  z= zfont_getbyte(f->z, pos >> 3, pos & 7);
+  r= pgm_read_byte(f->raw + pos);
+  if (z == r) return 1;
+  printf("  %s: Byte %u ist 0x%02x statt 0x%02x\n", f->name, pos, z, r);
+  return 0;
+}
+
+int main(void)
+{
+  uint8_t  n, ok;
+  uint16_t pos;
+  uint32_t k;
+  const testfont_t *f;
+  char     msg[64];
+
+  for (n= 0; n< FONTANZ; n++)
+  {
+    f= &fonts[n];
+
+    for (ok= 1, pos= 0; ok && (pos < f->anz); pos++) ok= byte_ok(f, pos);
+    snprintf(msg, sizeof(msg), "%s: der Reihe nach", f->name);
+    CHECK(ok, msg);
+
+    for (ok= 1, pos= f->anz; ok && pos; pos--) ok= byte_ok(f, pos - 1);
+    snprintf(msg, sizeof(msg), "%s: rueckwaerts", f->name);
+    CHECK(ok, msg);
+  }
+
+  srand(1);
+  for (ok= 1, k= 0; ok && (k < RANDOM_ANZ); k++)
+  {
+    f= &fonts[rand() % FONTANZ];
+    ok= byte_ok(f, rand() % f->anz);
+  }
+  CHECK(ok, "zufaellige Reihenfolge");
+
+  return check_done("zfont");
+}
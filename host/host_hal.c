@@ -0,0 +1,424 @@
+/* -----------------------------------------------------
+                        host_hal.c
+
+    Registerebene fuer den Host-Build (siehe host_hal.h)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "avr/io.h"
+
+#ifndef F_CPU
+  #define F_CPU  8000000ul
+#endif
+
+volatile uint8_t host_io[HOST_IOSIZE];
+uint32_t host_cycles  = 0;
+uint32_t host_writes  = 0;
+uint32_t host_usibits = 0;
+
+uint8_t  host_eeprom[E2END+1];                      // EEPROM-Inhalt (geloescht: 0xff)
+void     (*host_pinhook)(void)  = NULL;
+void     (*host_tickhook)(void) = NULL;
+
+static uint8_t  shadow[HOST_IOSIZE];                // zuletzt ausgewerteter Registerinhalt
+static int      pending = -1;                       // Adresse des letzten Zugriffs
+static uint8_t  pendwidth;                          // 1 oder 2 Bytes
+static uint32_t wrcount[HOST_IOSIZE];
+static uint8_t  extlevel[2] = { 0xff, 0xff };      // von aussen angelegte Pegel PINA, PINB
+static int      watchaddr = -1;                     // beobachtete Taktleitung
+static uint8_t  watchmask;
+static uint8_t  usi_latch = 0x80;                   // Ausgangslatch SDA im Two-Wire Modus (Bit 7)
+
+uint32_t host_edges = 0;
+
+static FILE     *tracefile = NULL;
+static uint32_t maxcycles  = 0;
+static uint8_t  initdone   = 0;
+
+static const char *regname[HOST_IOSIZE] =
+{
+  "PRR",    "DIDR0",  "0x02",   "ADCSRB", "ADCL",   "ADCH",   "ADCSRA", "ADMUX",
+  "ACSR",   "0x09",   "0x0a",   "TIFR1",  "TIMSK1", "USICR",  "USISR",  "USIDR",
+  "USIBR",  "0x11",   "PCMSK0", "GPIOR0", "GPIOR1", "GPIOR2", "PINB",   "DDRB",
+  "PORTB",  "PINA",   "DDRA",   "PORTA",  "EECR",   "EEDR",   "EEARL",  "EEARH",
+  "PCMSK1", "WDTCSR", "TCCR1C", "GTCCR",  "ICR1L",  "ICR1H",  "CLKPR",  "DWDR",
+  "OCR1BL", "OCR1BH", "OCR1AL", "OCR1AH", "TCNT1L", "TCNT1H", "TCCR1B", "TCCR1A",
+  "TCCR0A", "OSCCAL", "TCNT0",  "TCCR0B", "MCUSR",  "MCUCR",  "OCR0A",  "SPMCSR",
+  "TIFR0",  "TIMSK0", "GIFR",   "GIMSK",  "OCR0B",  "SPL",    "SPH",    "SREG"
+};
+
+static void pin_level(uint8_t addr);
+
+/* -------------------------------------------------------
+                       host_init
+
+     wertet beim ersten Registerzugriff die Umgebungs-
+     variablen aus
+   ------------------------------------------------------- */
+static void host_init(void)
+{
+  char *s;
+
+  initdone= 1;
+  memset(host_eeprom, 0xff, sizeof(host_eeprom));
+  s= getenv("HOST_TRACE");
+  if (s) tracefile= fopen(s, "w");
+  s= getenv("HOST_CYCLES");
+  if (s)
+  {
+    maxcycles= strtoul(s, NULL, 0);
+    atexit(host_report);
+  }
+}
+
+/* -------------------------------------------------------
+                       port_changed
+
+     PORTx / DDRx wurden geaendert (Schreibzugriff, Tog-
+     geln ueber PINx oder USITC): Flanke zaehlen, Aus-
+     gangslatch des USI nachfuehren, host_pinhook rufen
+   ------------------------------------------------------- */
+static void port_changed(uint8_t addr, uint8_t old, uint8_t val)
+{
+  if ((addr == watchaddr) && ((old ^ val) & watchmask)) host_edges++;
+
+  // steigende Flanke USCK im Two-Wire Modus: das Latch uebernimmt das
+  // MSB von USIDR und haelt es, solange SCL high ist
+  if ((addr == 0x1b) && (~old & val & (1 << PA4)) && (host_io[0x0d] & (1 << USIWM1)))
+    usi_latch= host_io[0x0f] & 0x80;
+
+  if (host_pinhook) host_pinhook();
+}
+
+/* -------------------------------------------------------
+                       usi_write
+
+     wertet einen Schreibzugriff auf USICR aus
+   ------------------------------------------------------- */
+static void usi_write(uint8_t old, uint8_t val)
+{
+  uint8_t shift, count, cnt;
+
+  shift= 0; count= 0;
+
+  if ((val & ~old) & (1 << USIWM1)) usi_latch= host_io[0x0f] & 0x80;   // Two-Wire Modus ein
+
+  if (!(val & ((1 << USIWM1) | (1 << USIWM0)))) return;   // USI ausgeschaltet
+
+  if (val & (1 << USITC))
+  {
+    host_io[0x1b] ^= (1 << PA4);                    // USCK toggeln
+    shadow[0x1b]= host_io[0x1b];
+    port_changed(0x1b, host_io[0x1b] ^ (1 << PA4), host_io[0x1b]);
+    if (val & (1 << USICS1))
+    {
+      count= 1;                                     // Zaehler auf beiden Flanken
+      if ( ((val & (1 << USICS0)) == 0) == ((host_io[0x1b] & (1 << PA4)) != 0) )
+        shift= 1;                                   // steigende (USICS0 = 0) bzw. fallende Flanke
+    }
+  }
+  if ((val & (1 << USICLK)) && !(val & (1 << USICS1)))
+  {
+    shift= 1;                                       // Software Clock Strobe
+    count= 1;
+  }
+
+  if (shift)
+  {
+    pin_level(0x19);
+    host_io[0x0f]= (host_io[0x0f] << 1) | ((host_io[0x19] >> PA6) & 1);
+    shadow[0x0f]= host_io[0x0f];
+    host_usibits++;
+  }
+  if (count)
+  {
+    cnt= (host_io[0x0e] + 1) & 0x0f;
+    host_io[0x0e]= (host_io[0x0e] & 0xf0) | cnt;
+    if (!cnt) host_io[0x0e] |= (1 << USIOIF);
+    shadow[0x0e]= host_io[0x0e];
+  }
+}
+
+/* -------------------------------------------------------
+                       reg_write
+
+     ein geaenderter Registerinhalt wurde erkannt
+   ------------------------------------------------------- */
+static void reg_write(uint8_t addr)
+{
+  uint8_t  old, val;
+  uint16_t ee;
+
+  old= shadow[addr];
+  val= host_io[addr];
+  shadow[addr]= val;
+
+  host_writes++;
+  wrcount[addr]++;
+  if (tracefile) fprintf(tracefile, "%10lu  %-7s 0x%02x\n", (unsigned long)host_cycles, regname[addr], val);
+
+  switch (addr)
+  {
+    case 0x19 :                                     // PINA / PINB: Schreiben toggelt PORTx
+    case 0x16 :
+    {
+      host_io[addr]= old;
+      shadow[addr]= old;
+      host_io[addr+2] ^= val;
+      shadow[addr+2]= host_io[addr+2];
+      port_changed(addr+2, host_io[addr+2] ^ val, host_io[addr+2]);
+      break;
+    }
+    case 0x17 :                                     // DDRx, PORTx
+    case 0x18 :
+    case 0x1a :
+    case 0x1b :
+    {
+      port_changed(addr, old, val);
+      break;
+    }
+    case 0x0d :                                     // USICR: USICLK, USITC sind Strobes (lesen 0)
+    {
+      usi_write(old, val);
+      host_io[addr]= val & ~((1 << USICLK) | (1 << USITC));
+      shadow[addr]= host_io[addr];
+      if (host_pinhook) host_pinhook();
+      break;
+    }
+    case 0x0f :                                     // USIDR: MSB liegt bei SCL low an SDA
+    {
+      if (host_pinhook) host_pinhook();
+      break;
+    }
+    case 0x3a :                                     // GIFR, TIFR0, TIFR1: 1 loescht ein Flag
+    case 0x38 :
+    case 0x0b :
+    {
+      host_io[addr]= old & ~val;
+      shadow[addr]= host_io[addr];
+      break;
+    }
+    case 0x0e :                                     // USISR: 1 loescht ein Flag, Zaehler wird gesetzt
+    {
+      host_io[addr]= (old & ~val & 0xe0) | (val & 0x0f);
+      shadow[addr]= host_io[addr];
+      break;
+    }
+    case 0x06 :                                     // ADCSRA: Wandlung sofort fertig
+    {
+      if (val & (1 << ADSC))
+      {
+        host_io[addr]= (val & ~(1 << ADSC)) | (1 << ADIF);
+        shadow[addr]= host_io[addr];
+      }
+      break;
+    }
+    case 0x1c :                                     // EECR: Lesen / Schreiben sofort fertig
+    {
+      ee= (host_io[0x1e] | (host_io[0x1f] << 8)) & E2END;
+      if (val & (1 << EERE))
+      {
+        host_io[0x1d]= host_eeprom[ee];
+        shadow[0x1d]= host_io[0x1d];
+      }
+      if (val & (1 << EEPE)) host_eeprom[ee]= host_io[0x1d];
+      host_io[addr]= val & ~((1 << EEPE) | (1 << EERE));
+      shadow[addr]= host_io[addr];
+      break;
+    }
+    default : break;
+  }
+}
+
+/* -------------------------------------------------------
+                       host_sync
+
+     prueft, ob der letzte Zugriff ein Register veraendert
+     hat
+   ------------------------------------------------------- */
+void host_sync(void)
+{
+  uint8_t i;
+  int     addr;
+
+  if (pending < 0) return;
+  addr= pending;                                    // host_pinhook kann wieder host_sync aufrufen
+  pending= -1;
+  for (i= 0; i< pendwidth; i++)
+  {
+    if (host_io[addr+i] != shadow[addr+i]) reg_write(addr+i);
+  }
+}
+
+/* -------------------------------------------------------
+                       host_input
+
+     setzt ein Register "von aussen" (Eingangspins, ADC-
+     Ergebnis ...), das ist kein Schreibzugriff des
+     Programms
+   ------------------------------------------------------- */
+void host_input(uint8_t addr, uint8_t value)
+{
+  host_sync();
+  if (addr == 0x19) extlevel[0]= value;
+  if (addr == 0x16) extlevel[1]= value;
+  host_io[addr]= value;
+  shadow[addr]= value;
+}
+
+/* -------------------------------------------------------
+                       host_extpin
+
+     legt an den Bits mask von PINx einen Pegel von aus-
+     sen an (level 0: nach GND gezogen), bspw. ein Slave,
+     der SDA oder SCL festhaelt
+   ------------------------------------------------------- */
+void host_extpin(uint8_t addr, uint8_t mask, uint8_t level)
+{
+  uint8_t *ext;
+
+  host_sync();
+  ext= (addr == 0x19) ? &extlevel[0] : &extlevel[1];
+  if (level) *ext |= mask; else *ext &= ~mask;
+  pin_level(addr);
+}
+
+/* -------------------------------------------------------
+                       host_pin
+
+     aktueller Pegel der Leitungen eines Ports (PINA oder
+     PINB), ohne einen Registerzugriff zu zaehlen
+   ------------------------------------------------------- */
+uint8_t host_pin(uint8_t addr)
+{
+  pin_level(addr);
+  return host_io[addr];
+}
+
+/* -------------------------------------------------------
+                       host_watch
+
+     zaehlt in host_edges die Pegelwechsel der Bits mask
+     im Register addr (bspw. Taktleitung eines Bit-
+     banging-Protokolls)
+   ------------------------------------------------------- */
+void host_watch(uint8_t addr, uint8_t mask)
+{
+  host_sync();
+  watchaddr= addr;
+  watchmask= mask;
+  host_edges= 0;
+}
+
+/* -------------------------------------------------------
+                       pin_level
+
+     PINx beim Lesen: Ausgaenge liefern den Wert aus PORTx,
+     Eingaenge den von aussen angelegten Pegel.
+
+     Im Two-Wire Modus des USI sind SDA (PA6) und SCL (PA4)
+     Open-Drain: ein Ausgang zieht nur nach GND, der Pegel
+     ist die UND-Verknuepfung mit dem aeusseren Pegel. SDA
+     wird zusaetzlich vom MSB des USIDR (bei SCL high vom
+     Latch) nach GND gezogen.
+   ------------------------------------------------------- */
+static void pin_level(uint8_t addr)
+{
+  uint8_t ddr, port, ext, drv, msb, old;
+
+  old= host_io[addr];
+  ddr= host_io[addr+1];
+  port= host_io[addr+2];
+  ext= (addr == 0x19) ? extlevel[0] : extlevel[1];
+  host_io[addr]= (port & ddr) | (ext & ~ddr);
+
+  if ((addr == 0x19) && (host_io[0x0d] & (1 << USIWM1)))
+  {
+    msb= (port & (1 << PA4)) ? usi_latch : (host_io[0x0f] & 0x80);
+    drv= ~ddr | port;
+    if (!msb) drv &= ~(1 << PA6);
+    host_io[addr]= (host_io[addr] & ~((1 << PA6) | (1 << PA4))) |
+                   (ext & drv & ((1 << PA6) | (1 << PA4)));
+  }
+  shadow[addr]= host_io[addr];
+
+  // Pinchange-Flag
+  old ^= host_io[addr];
+  if (old & host_io[(addr == 0x19) ? 0x12 : 0x20])
+  {
+    host_io[0x3a] |= (addr == 0x19) ? (1 << PCIF0) : (1 << PCIF1);
+    shadow[0x3a]= host_io[0x3a];
+  }
+}
+
+/* -------------------------------------------------------
+                       host_addcycles
+   ------------------------------------------------------- */
+void host_addcycles(uint32_t n)
+{
+  if (!initdone) host_init();
+  host_sync();                                      // Schreibzugriff vor der Wartezeit stempeln
+  host_cycles += n;
+  if (host_tickhook) host_tickhook();
+  if ((maxcycles) && (host_cycles >= maxcycles))
+  {
+    host_sync();
+    exit(0);                                        // host_report ueber atexit
+  }
+}
+
+/* -------------------------------------------------------
+                       host_reg / host_reg16
+   ------------------------------------------------------- */
+volatile uint8_t *host_reg(uint8_t addr)
+{
+  host_sync();
+  host_addcycles(1);
+  if ((addr == 0x19) || (addr == 0x16)) pin_level(addr);
+  pending= addr;
+  pendwidth= 1;
+  return &host_io[addr];
+}
+
+volatile uint16_t *host_reg16(uint8_t addr)
+{
+  host_sync();
+  host_addcycles(2);
+  pending= addr;
+  pendwidth= 2;
+  return (volatile uint16_t *)&host_io[addr];
+}
+
+/* -------------------------------------------------------
+                       host_delay_us
+   ------------------------------------------------------- */
+void host_delay_us(double us)
+{
+  host_sync();
+  host_addcycles((uint32_t)(us * (F_CPU / 1000000.0)));
+}
+
+/* -------------------------------------------------------
+                       host_report
+
+     Statistik auf stderr
+   ------------------------------------------------------- */
+void host_report(void)
+{
+  uint8_t i;
+
+  host_sync();
+  fprintf(stderr, "\n virtuelle Takte   : %lu", (unsigned long)host_cycles);
+  fprintf(stderr, "\n Schreibzugriffe   : %lu", (unsigned long)host_writes);
+  fprintf(stderr, "\n USI Bits / Bytes  : %lu / %lu", (unsigned long)host_usibits, (unsigned long)host_usibits / 8);
+  for (i= 0; i< HOST_IOSIZE; i++)
+  {
+    if (wrcount[i]) fprintf(stderr, "\n   %-7s : %lu", regname[i], (unsigned long)wrcount[i]);
+  }
+  fprintf(stderr, "\n");
+  if (tracefile) fflush(tracefile);
+}
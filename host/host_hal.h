@@ -0,0 +1,102 @@
+/* -----------------------------------------------------
+                        host_hal.h
+
+    Registerebene fuer den Host-Build (make host): die
+    Treiber aus src/ werden mit gcc fuer den PC ueber-
+    setzt, die Register des ATtiny44 liegen in einem
+    Array host_io[] (Adressen = I/O-Adressen des
+    ATtiny44).
+
+    Jeder Registerzugriff laeuft ueber host_reg(). Ein
+    Schreibzugriff wird beim naechsten Registerzugriff
+    (oder mit host_sync) erkannt, mit einem virtuellen
+    Taktstempel protokolliert und ausgewertet:
+
+      - PINx lesen liefert fuer Ausgaenge PORTx, fuer
+        Eingaenge den mit host_input angelegten Pegel
+        (Standard: 1, Pull-Up)
+      - PINx schreiben toggelt PORTx (wie beim AVR)
+      - USI: USITC toggelt USCK (PA4), USICLK bzw. die
+        USCK-Flanke schiebt USIDR, der 4-Bit Zaehler in
+        USISR setzt USIOIF. Die geschobenen Bits werden
+        als Busbits gezaehlt
+      - USI im Two-Wire Modus: SDA (PA6) und SCL (PA4)
+        sind Open-Drain, SDA folgt dem MSB von USIDR
+        (bei SCL high ueber das Ausgangslatch)
+      - ADCSRA.ADSC und EECR.EEPE / EERE werden sofort
+        geloescht (Wandlung / Lesen / Schreiben ist fertig),
+        der EEPROM-Inhalt steht in host_eeprom[]
+      - Pegelwechsel an einem in PCMSK0 / PCMSK1 frei-
+        gegebenen Pin setzen PCIF0 / PCIF1 in GIFR.
+        In GIFR, TIFR0 und TIFR1 loescht eine 1 das Flag
+
+    Schreiben desselben Werts in ein Register ist nicht
+    erkennbar und wird nicht protokolliert. Timer zaehlen
+    nicht, Interrupts werden nicht ausgeloest (ISRs sind
+    normale Funktionen und koennen direkt aufgerufen
+    werden).
+
+    Fuer Tests mit einem simulierten Busteilnehmer (bspw.
+    host_i2c.c):
+
+      host_pinhook  : wird nach jeder Aenderung von
+                      PORTx, DDRx, USICR und USIDR
+                      aufgerufen, host_cycles ist dann
+                      der Takt des Schreibzugriffs
+      host_tickhook : wird nach jeder Erhoehung von
+                      host_cycles aufgerufen
+      host_extpin   : Pegel an einzelnen Pins von aussen
+                      anlegen
+      host_pin      : Pegel der Leitungen lesen (ohne
+                      Takt)
+
+    Virtuelle Takte: 1 je Registerzugriff plus die Zeit
+    der Verzoegerungen aus util/delay.h. Das ist ein Mass
+    fuer den Protokollaufwand, keine Laufzeitmessung.
+
+    Umgebungsvariable:
+
+      HOST_TRACE=datei  : jeden erkannten Schreibzugriff
+                          protokollieren (Takt, Register,
+                          Wert)
+      HOST_CYCLES=n     : nach n virtuellen Takten Sta-
+                          tistik ausgeben und beenden
+                          (Hauptprogramme enden sonst nie)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_hal
+  #define in_host_hal
+
+  #include <stdint.h>
+
+  #define HOST_IOSIZE           64
+
+  extern volatile uint8_t host_io[HOST_IOSIZE];     // Registerinhalte
+  extern uint32_t host_cycles;                      // virtuelle Takte
+  extern uint32_t host_writes;                      // erkannte Schreibzugriffe
+  extern uint32_t host_usibits;                     // ueber das USI geschobene Bits
+  extern uint32_t host_edges;                       // Pegelwechsel der mit host_watch gewaehlten Bits
+  extern uint8_t  host_eeprom[];                    // EEPROM-Inhalt
+  extern void     (*host_pinhook)(void);            // Aenderung an PORTx / DDRx / USI
+  extern void     (*host_tickhook)(void);           // nach jeder Erhoehung von host_cycles
+
+  volatile uint8_t *host_reg(uint8_t addr);         // Zugriff auf 8-Bit Register
+  volatile uint16_t *host_reg16(uint8_t addr);      // Zugriff auf 16-Bit Register (L-Adresse)
+  void host_sync(void);                             // letzten Schreibzugriff auswerten
+  void host_input(uint8_t addr, uint8_t value);     // Register von aussen setzen (bspw. Pegel an
+                                                    // PINA), ohne einen Schreibzugriff auszuloesen
+  void host_extpin(uint8_t addr, uint8_t mask, uint8_t level);  // Pegel einzelner Pins von aussen
+  uint8_t host_pin(uint8_t addr);                   // Pegel der Leitungen von PINA / PINB
+  void host_watch(uint8_t addr, uint8_t mask);      // Pegelwechsel in addr & mask zaehlen
+  void host_delay_us(double us);                    // Verzoegerung in virtuellen Takten
+  void host_addcycles(uint32_t n);
+  void host_report(void);                           // Statistik auf stderr
+
+  #define __builtin_avr_delay_cycles(n)   host_addcycles(n)
+
+  // I/O-Adresse eines Registers, bspw. host_watch(HOST_ADDR(DDRA), 1 << 5)
+  #define HOST_ADDR(reg)        ((uint8_t)(&(reg) - host_io))
+
+#endif
@@ -0,0 +1,258 @@
+/* -----------------------------------------------------
+                        host_i2c.c
+
+    I2C-Slave fuer Tests im Host-Build (siehe
+    host_i2c.h)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <stddef.h>
+#include "host_hal.h"
+#include "host_i2c.h"
+
+uint8_t  host_i2c_mem[256];
+uint8_t  host_i2c_ptr     = 0;
+uint8_t  host_i2c_nack    = 0;
+uint32_t host_i2c_stretch = 0;
+uint8_t  host_i2c_stretchbit = 9;
+
+uint32_t host_i2c_starts;
+uint32_t host_i2c_stops;
+uint32_t host_i2c_bytes;
+uint32_t host_i2c_tlow;
+uint32_t host_i2c_thigh;
+uint32_t host_i2c_tper;
+
+#define ST_IDLE       0                     // nicht adressiert, wartet auf Start
+#define ST_ADDR       1                     // Adressbyte
+#define ST_REG        2                     // Registerzeiger
+#define ST_WRITE      3                     // Daten vom Master
+#define ST_READ       4                     // Daten zum Master
+
+static uint8_t  devaddr;
+static uint8_t  pin, sda, scl;              // PINx und Bitmasken
+static uint8_t  lastsda= 1, lastscl= 1;
+static uint8_t  state= ST_IDLE;
+static uint8_t  bitn;                       // steigende Flanken im aktuellen Byte (9 = ACK)
+static uint8_t  shift;                      // empfangenes Byte
+static uint8_t  outbyte;                    // zu sendendes Byte
+static uint8_t  ack;                        // Slave zieht SDA im ACK-Takt
+static uint8_t  mack;                       // ACK des Masters beim Lesen (0 = ACK)
+static uint8_t  holdscl;                    // Slave haelt SCL
+static uint32_t release;                    // ... bis zu diesem Takt
+static uint32_t t_rise, t_fall;             // letzte Flanken (0: ungueltig)
+
+static void bus_update(void);
+
+/* -------------------------------------------------------
+                        min_set
+   ------------------------------------------------------- */
+static void min_set(uint32_t *m, uint32_t t)
+{
+  if ((*m == 0) || (t < *m)) *m= t;
+}
+
+/* -------------------------------------------------------
+                        slave_sda
+
+     Slave zieht SDA nach GND (level = 0) oder gibt SDA
+     frei
+   ------------------------------------------------------- */
+static void slave_sda(uint8_t level)
+{
+  host_extpin(pin, sda, level);
+}
+
+/* -------------------------------------------------------
+                        tick
+
+     gibt SCL nach Ablauf des Clockstretchings frei
+   ------------------------------------------------------- */
+static void tick(void)
+{
+  if ((holdscl) && (host_cycles >= release))
+  {
+    holdscl= 0;
+    host_extpin(pin, scl, 1);
+    bus_update();
+  }
+}
+
+/* -------------------------------------------------------
+                        hold
+
+     Clockstretching: Slave haelt SCL fuer host_i2c_stretch
+     Takte auf GND
+   ------------------------------------------------------- */
+static void hold(void)
+{
+  holdscl= 1;
+  release= host_cycles + host_i2c_stretch;
+  host_extpin(pin, scl, 0);
+}
+
+/* -------------------------------------------------------
+                        scl_rise
+   ------------------------------------------------------- */
+static void scl_rise(uint8_t sdalevel)
+{
+  if (t_fall) min_set(&host_i2c_tlow, host_cycles - t_fall);
+  t_rise= host_cycles;
+
+  if (state == ST_IDLE) return;
+  bitn++;
+  if (bitn <= 8)
+  {
+    shift= (shift << 1) | sdalevel;
+  }
+  else
+  {
+    mack= sdalevel;                         // ACK-Takt: beim Lesen quittiert der Master
+  }
+}
+
+/* -------------------------------------------------------
+                        scl_fall
+   ------------------------------------------------------- */
+static void scl_fall(void)
+{
+  if (t_rise) min_set(&host_i2c_thigh, host_cycles - t_rise);
+  if (t_fall && t_rise) min_set(&host_i2c_tper, host_cycles - t_fall);
+  t_fall= host_cycles;
+
+  if (state == ST_IDLE) return;
+
+  if (bitn == 8)                            // 8 Bits komplett, ACK-Takt folgt
+  {
+    host_i2c_bytes++;
+    ack= 1;
+    switch (state)
+    {
+      case ST_ADDR  : if (((shift & 0xfe) != devaddr) || host_i2c_nack) ack= 0;
+                      break;
+      case ST_REG   : host_i2c_ptr= shift; break;
+      case ST_WRITE : host_i2c_mem[host_i2c_ptr++]= shift; break;
+      case ST_READ  : ack= 0; break;         // SDA freigeben, Master quittiert
+      default       : break;
+    }
+    if (ack) slave_sda(0);
+      else slave_sda(1);
+    if ((state == ST_ADDR) && !ack) state= ST_IDLE;
+    else if (host_i2c_stretch && (host_i2c_stretchbit == 8)) hold();
+    return;
+  }
+
+  if (bitn == 9)                            // ACK-Takt beendet
+  {
+    bitn= 0;
+    if (ack) slave_sda(1);
+    if (ack && host_i2c_stretch && (host_i2c_stretchbit == 9)) hold();
+    switch (state)
+    {
+      case ST_ADDR  : state= (shift & 1) ? ST_READ : ST_REG;
+                      mack= 0;
+                      break;
+      case ST_REG   : state= ST_WRITE; break;
+      default       : break;
+    }
+    if (state == ST_READ)
+    {
+      if (mack)                             // NACK des Masters: letztes Byte
+      {
+        state= ST_IDLE;
+        return;
+      }
+      outbyte= host_i2c_mem[host_i2c_ptr++];
+      slave_sda(outbyte & 0x80);
+    }
+    return;
+  }
+
+  if ((state == ST_READ) && (bitn > 0))     // naechstes Datenbit anlegen
+  {
+    slave_sda(outbyte & (0x80 >> bitn));
+  }
+  if (host_i2c_stretch && (bitn == host_i2c_stretchbit)) hold();
+}
+
+/* -------------------------------------------------------
+                        bus_update
+
+     wertet die aktuellen Pegel von SDA und SCL aus
+     (host_pinhook)
+   ------------------------------------------------------- */
+static void bus_update(void)
+{
+  uint8_t level, nsda, nscl;
+
+  level= host_pin(pin);
+  nsda= (level & sda) ? 1 : 0;
+  nscl= (level & scl) ? 1 : 0;
+
+  if (nscl && lastscl && (nsda != lastsda))
+  {
+    if (!nsda)                              // Startcondition
+    {
+      host_i2c_starts++;
+      state= ST_ADDR;
+      bitn= 0; shift= 0; ack= 0;
+      t_rise= 0;                            // Zeit vor dem Start zaehlt nicht
+      t_fall= 0;
+    }
+    else                                    // Stopcondition
+    {
+      host_i2c_stops++;
+      state= ST_IDLE;
+      t_rise= 0; t_fall= 0;
+    }
+  }
+  else if (nscl && !lastscl)
+  {
+    scl_rise(nsda);
+  }
+  else if (!nscl && lastscl)
+  {
+    scl_fall();
+  }
+  lastsda= nsda;
+  lastscl= nscl;
+
+  // Pegel koennen sich durch den Slave selbst geaendert haben
+  level= host_pin(pin);
+  lastsda= (level & sda) ? 1 : 0;
+}
+
+/* -------------------------------------------------------
+                       host_i2c_attach
+
+     addr    : 8-Bit Deviceadresse (R/W-Bit = 0)
+     pinaddr : I/O-Adresse von PINx der Leitungen
+     sdamask, sclmask : Bits von SDA und SCL
+   ------------------------------------------------------- */
+void host_i2c_attach(uint8_t addr, uint8_t pinaddr, uint8_t sdamask, uint8_t sclmask)
+{
+  devaddr= addr & 0xfe;
+  pin= pinaddr;
+  sda= sdamask;
+  scl= sclmask;
+  host_extpin(pin, sda | scl, 1);
+  state= ST_IDLE;
+  lastsda= 1; lastscl= 1;
+  host_pinhook= bus_update;
+  host_tickhook= tick;
+  host_i2c_reset();
+}
+
+/* -------------------------------------------------------
+                       host_i2c_reset
+   ------------------------------------------------------- */
+void host_i2c_reset(void)
+{
+  host_i2c_starts= 0;
+  host_i2c_stops= 0;
+  host_i2c_bytes= 0;
+  host_i2c_tlow= 0;
+  host_i2c_thigh= 0;
+  host_i2c_tper= 0;
+}
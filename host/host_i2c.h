@@ -0,0 +1,54 @@
+/* -----------------------------------------------------
+                        host_i2c.h
+
+    I2C-Slave fuer Tests im Host-Build (siehe
+    host_hal.h). Der Slave haengt ueber host_pinhook /
+    host_tickhook an den Leitungen SDA und SCL eines
+    Ports und wertet die Pegel aus, die der Treiber
+    erzeugt (Bitbanging ueber DDRx / PORTx oder USI im
+    Two-Wire Modus):
+
+      - Start- / Stopcondition, Adresse, R/W-Bit
+      - Schreiben: das erste Datenbyte ist der Register-
+        zeiger, weitere Bytes landen in host_i2c_mem[]
+        (Auto-Increment)
+      - Lesen: liefert host_i2c_mem[] ab dem Register-
+        zeiger, bis der Master nicht quittiert
+      - Acknowledge durch Ziehen von SDA ueber host_extpin
+      - Clockstretching: nach jedem Acknowledge (bzw. nach
+        der fallenden Flanke des Takts host_i2c_stretchbit
+        jedes Bytes) haelt der Slave SCL fuer host_i2c_stretch
+        virtuelle Takte auf GND
+
+    Gemessen werden die kleinsten SCL-Zeiten (LOW, HIGH,
+    Periode) in virtuellen Takten zwischen Start- und
+    Stopcondition. Da jeder Registerzugriff mit nur 1
+    Takt gezaehlt wird (ein AVR braucht 1 oder 2), sind
+    die Werte untere Schranken der Zeiten auf dem
+    ATtiny44.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_i2c
+  #define in_host_i2c
+
+  #include <stdint.h>
+
+  extern uint8_t  host_i2c_mem[256];          // Registerinhalt des Slaves
+  extern uint8_t  host_i2c_ptr;               // Registerzeiger
+  extern uint8_t  host_i2c_nack;              // 1: Adresse wird nicht quittiert
+  extern uint32_t host_i2c_stretch;           // Takte Clockstretching nach jedem ACK (0: keins)
+  extern uint8_t  host_i2c_stretchbit;        // ... bzw. nach diesem Takt (1..8, 9 = ACK)
+
+  extern uint32_t host_i2c_starts;            // Startconditions (inkl. Repeated Start)
+  extern uint32_t host_i2c_stops;             // Stopconditions
+  extern uint32_t host_i2c_bytes;             // uebertragene Bytes inkl. Adresse
+  extern uint32_t host_i2c_tlow;              // kleinste SCL LOW-Zeit
+  extern uint32_t host_i2c_thigh;             // kleinste SCL HIGH-Zeit
+  extern uint32_t host_i2c_tper;              // kleinste SCL Periode (fallende Flanken)
+
+  void host_i2c_attach(uint8_t addr, uint8_t pinaddr, uint8_t sdamask, uint8_t sclmask);
+  void host_i2c_reset(void);                  // Zaehler und Zeiten zuruecksetzen
+
+#endif
@@ -0,0 +1,28 @@
+/* -----------------------------------------------------
+                        stdio.h
+
+    Host-Build: stdio.h des PCs, ergaenzt um die Makros
+    von avr-libc zum Anlegen eines Streams. Ein mit
+    FDEV_SETUP_STREAM angelegter Stream ist auf dem PC
+    nur ein leerer FILE (die Funktionen put / get werden
+    nicht aufgerufen), Programme mit my_printf sind
+    davon nicht betroffen.
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_stdio
+  #define in_host_stdio
+
+  #include_next <stdio.h>
+
+  #define _FDEV_SETUP_READ                  0x01
+  #define _FDEV_SETUP_WRITE                 0x02
+  #define _FDEV_SETUP_RW                    (_FDEV_SETUP_READ | _FDEV_SETUP_WRITE)
+
+  #define FDEV_SETUP_STREAM(put, get, rwflag)   { 0 }
+  #define fdev_setup_stream(stream, put, get, rwflag)
+  #define fdev_get_udata(stream)            NULL
+  #define fdev_set_udata(stream, u)
+
+#endif
@@ -0,0 +1,30 @@
+/* -----------------------------------------------------
+                      util/atomic.h
+
+    Host-Build: der Block wird einmal ausgefuehrt, das
+    I-Bit wird wie beim AVR behandelt
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_util_atomic
+  #define in_host_util_atomic
+
+  #include <avr/io.h>
+
+  #define ATOMIC_RESTORESTATE   1
+  #define ATOMIC_FORCEON        2
+  #define NONATOMIC_RESTORESTATE 1
+  #define NONATOMIC_FORCEOFF    2
+
+  #define ATOMIC_BLOCK(type)    for (uint8_t host_sreg= SREG, host_once= (SREG &= ~(1 << SREG_I), 1); \
+                                     host_once;                                                     \
+                                     host_once= 0, SREG= ((type) == ATOMIC_FORCEON) ?               \
+                                       (host_sreg | (1 << SREG_I)) : host_sreg)
+
+  #define NONATOMIC_BLOCK(type) for (uint8_t host_sreg= SREG, host_once= (SREG |= (1 << SREG_I), 1); \
+                                     host_once;                                                     \
+                                     host_once= 0, SREG= ((type) == NONATOMIC_FORCEOFF) ?           \
+                                       (host_sreg & ~(1 << SREG_I)) : host_sreg)
+
+#endif
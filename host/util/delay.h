@@ -0,0 +1,18 @@
+/* -----------------------------------------------------
+                      util/delay.h
+
+    Host-Build: Verzoegerungen werden nur als virtuelle
+    Takte gezaehlt (siehe host_hal.h)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_util_delay
+  #define in_host_util_delay
+
+  #include "host_hal.h"
+
+  #define _delay_us(us)         host_delay_us((double)(us))
+  #define _delay_ms(ms)         host_delay_us((double)(ms) * 1000.0)
+
+#endif
@@ -0,0 +1,18 @@
+/* -----------------------------------------------------
+                    util/delay_basic.h
+
+    Host-Build: Zaehlschleifen als virtuelle Takte
+    (3 bzw. 4 Takte je Durchlauf wie beim AVR)
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_host_util_delay_basic
+  #define in_host_util_delay_basic
+
+  #include "host_hal.h"
+
+  #define _delay_loop_1(n)      host_addcycles(3ul * ((uint8_t)(n) ? (uint8_t)(n) : 256))
+  #define _delay_loop_2(n)      host_addcycles(4ul * ((uint16_t)(n) ? (uint16_t)(n) : 65536))
+
+#endif
@@ -4,7 +4,16 @@
      Software I2C Bitbanging mit ATtiny44
 
      Scant den I2C Bus nach angeschlossenen Teilnehmern und gibt
-     die Hexadresse des I2C-Device auf dem UART aus.
+     eine Adresstabelle (7-Bit Adressen) auf dem UART aus.
+
+     Der Scan verwendet kuerzestmoegliche Proben (Start, Adresse,
+     Stop ohne Wartezeiten), alle 112 Adressen benoetigen bei
+     100 kHz Bustakt ca. 15 ms. Die Dauer wird mit Timer1 gemessen
+     und mit ausgegeben.
+
+     Bekannte Bausteine werden anschliessend anhand ihrer ID-
+     Register identifiziert (SSD1306, DS1307 / DS3231, BMP180,
+     RDA5807, PCF8574).
 
 
      MCU   : ATtiny44
@@ -25,9 +34,10 @@
      PB1 = SCL
 
 
-     Pinbelegung UART
-     ----------------
+     Pinbelegung UART (uart_all)
+     ---------------------------
      PA5 = D0 = TxD
+     PA6 = DI = RxD
 
 
      12.09.2018 R. Seelig
@@ -56,18 +66,16 @@ PCINT6 - OC1A - SDA - MOSI - DI - ADC6 - PA6  | 7   y   8 |  PA5 - ADC5 - DO - M
 
 #include "avr_gpio.h"
 #include "i2c_sw.h"
-#include "usiuart.h"
+#include "uart_all.h"
 #include "my_printf.h"
 
-#define  delay                _delay_ms
 #define  printf               my_printf
 
-#define cnt_speed    500
+// Timer1 mit Prescaler 64 zur Messung der Scandauer
+#define  tim1_ticks_ms        ( (F_CPU) / 64000ul )
 
-#define led_init()     PA1_output_init()
-#define led_clr()      PA1_set()
-#define led_set()      PA1_clr()
 
+uint8_t  devfound[16];                  // Bitfeld der gefundenen 7-Bit Adressen
 
 
 /* --------------------------------------------------------
@@ -82,74 +90,187 @@ void my_putchar(char ch)
   uart_putchar(ch);
 }
 
+/* --------------------------------------------------------
+   i2c_scanbus
 
-int main(void)
+   probt alle Adressen 0x08 .. 0x77 mit Start, Adresse,
+   Stop und traegt die quittierten Adressen in devfound
+   ein.
+
+   Rueckgabe: Dauer des Scans in Timer1 Ticks
+   -------------------------------------------------------- */
+uint16_t i2c_scanbus(void)
 {
-  uint8_t ch;
-  uint8_t cx,anz;
-  uint8_t ack;
+  uint8_t a;
 
+  for (a= 0; a< 16; a++) devfound[a]= 0;
 
-  printfkomma= 3;
+  TCCR1A = 0;
+  TCCR1B = (1 << CS11) | (1 << CS10);   // Prescaler 64
+  TCNT1 = 0;
 
-  uart_init();
-  i2c_master_init();
+  for (a= 0x08; a< 0x78; a++)
+  {
+    if (i2c_start(a << 1)) devfound[a >> 3] |= (1 << (a & 0x07));
+    i2c_stop();
+  }
 
-  while(1)
+  return TCNT1;
+}
+
+/* --------------------------------------------------------
+   i2c_isfound
+
+   Rueckgabe: 1 wenn 7-Bit Adresse a geantwortet hat
+   -------------------------------------------------------- */
+uint8_t i2c_isfound(uint8_t a)
+{
+  return (devfound[a >> 3] >> (a & 0x07)) & 1;
+}
+
+/* --------------------------------------------------------
+   i2c_readreg
+
+   liest ein Register eines Devices (8-Bit Adresse)
+   -------------------------------------------------------- */
+uint8_t i2c_readreg(uint8_t addr, uint8_t reg)
+{
+  uint8_t value;
+
+  i2c_read_buf(addr, reg, &value, 1);
+  return value;
+}
+
+/* --------------------------------------------------------
+   showtable
+
+   gibt die gefundenen Adressen als Tabelle aus
+   -------------------------------------------------------- */
+void showtable(void)
+{
+  uint8_t a;
+
+  printf("\n\r    0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F");
+  for (a= 0; a< 0x80; a++)
   {
-    printf("\n\rI2C Bus scanning\n\r--------------------------\n\n\r" \
-           "Devices found at address:\n\n\r");
+    if (!(a & 0x0f)) printf("\n\r%d0:", a >> 4);
+    if ((a< 0x08) || (a> 0x77))        printf("   ");
+    else if (i2c_isfound(a))           printf(" %x", a);
+    else                               printf(" --");
+  }
+  printf("\n\n\r");
+}
+
+/* --------------------------------------------------------
+   fingerprint
 
-    anz= 0;
+   identifiziert einen Baustein anhand seiner Adresse
+   und (sofern vorhanden) seiner ID-Register
 
-    for (cx= 0; cx< 254; cx += 2)
+   Uebergabe: 7-Bit Adresse
+   -------------------------------------------------------- */
+void fingerprint(uint8_t a)
+{
+  uint8_t addr;
+  uint8_t b[4];
+
+  addr= a << 1;
+  printf("%x : ", a);
+
+  switch (a)
+  {
+    case 0x3c :
+    case 0x3d :                         // Statusbyte des SSD1306 lesen
     {
-      ack= i2c_start(cx);
-      delay(1);
+      i2c_start(addr | 1);
+      b[0]= i2c_read_nack();
       i2c_stop();
-      if (ack)
+      printf("SSD1306 OLED (Status %x)", b[0]);
+      break;
+    }
+    case 0x68 :                         // DS3231: Bit 6..4 des Statusregisters
+    {                                   // (0Fh) lesen immer 0 und lassen sich
+                                        // nicht setzen, beim DS1307 liegt hier RAM
+      i2c_read_buf(addr, 0x0f, b, 4);
+                                        // Bit 6..4 setzen (eine 1 laesst OSF,
+      b[1]= b[0] | 0x70;                // A2F und A1F unveraendert)
+      i2c_write_buf(addr, 0x0f, &b[1], 1);
+      if ((i2c_readreg(addr, 0x0f) & 0x70) == 0)
+        printf("DS3231 RTC (Temp. %d C)", (int8_t)b[2]);
+      else
       {
-        switch (cx)
-        {
-          case 0xC0 : printf("Adr. %xh : TEA5767 UKW-Radio\n\r", cx); break;
-          case 0x20 :
-          case 0x22 : printf("Adr. %xh : RDA5807 UKW-Radio\n\r", cx); break;
-          case 0x40 :
-          case 0x42 :
-          case 0x44 :
-          case 0x46 :
-          case 0x48 :
-          case 0x4A :
-          case 0x4C :
-          case 0x4E : printf("Adr. %xh : PCF8574 I/O Expander\n\r", cx); break;
-          case 0x90 :
-          case 0x92 :
-          case 0x94 :
-          case 0x96 :
-          case 0x98 :
-          case 0x9A :
-          case 0x9C :
-          case 0x9E : printf("Adr. %xh : LM75 Temp.-Sensor\n\r", cx); break;
-          case 0xA0 :
-          case 0xA2 :
-          case 0xA4 :
-          case 0xA6 :
-          case 0xA8 :
-          case 0xAA :
-          case 0xAC :
-          case 0xAE : printf("Adr. %xh : EEProm\n\r", cx); break;
-          case 0x78 : printf("Adr. %xh : SSD13016 I2C-OLED Display\n\r", cx); break;
-          case 0xD0 : printf("Adr. %xh : RTC - DS1307\n\r", cx); break;
-
-          default   : printf("Adr. %xh : unknown\n\r",cx); break;
-        }
+        i2c_write_buf(addr, 0x0f, b, 1);         // RAM des DS1307 wiederherstellen
+        printf("DS1307 RTC");
       }
-      delay(1);
+      break;
     }
-    printf("\n\n\rEnd of I2C-bus scanning... \n\n\r");
-    i2c_stop();
+    case 0x77 :                         // Chip-ID Register D0h
+    {
+      b[0]= i2c_readreg(addr, 0xd0);
+      switch (b[0])
+      {
+        case 0x55 : printf("BMP180 / BMP085"); break;
+        case 0x58 : printf("BMP280"); break;
+        case 0x60 : printf("BME280"); break;
+        default   : printf("unknown (ID %x)", b[0]); break;
+      }
+      break;
+    }
+    case 0x10 : printf("RDA5807 UKW-Radio (sequentiell)"); break;
+    case 0x11 :                         // Chip-ID Register 00h (16 Bit)
+    {
+      i2c_read_buf(addr, 0x00, b, 2);
+      if (b[0] == 0x58) printf("RDA5807 UKW-Radio (ID %x%x)", b[0], b[1]);
+                   else printf("unknown (ID %x%x)", b[0], b[1]);
+      break;
+    }
+    case 0x60 : printf("TEA5767 UKW-Radio"); break;
+
+    default :
+    {
+      if (((a & 0xf8) == 0x20) || ((a & 0xf8) == 0x38))
+      {
+        // PCF8574 / PCF8574A: keine ID, Portzustand lesen
+        i2c_start(addr | 1);
+        b[0]= i2c_read_nack();
+        i2c_stop();
+        printf("PCF8574 I/O Expander (Port %x)", b[0]);
+      }
+      else
+      if ((a & 0xf8) == 0x48) printf("LM75 Temp.-Sensor");
+      else
+      if ((a & 0xf8) == 0x50) printf("EEProm");
+      else
+        printf("unknown");
+      break;
+    }
+  }
+  printf("\n\r");
+}
+
+
+int main(void)
+{
+  uint8_t  a;
+  uint16_t ticks;
+
+  uart_init();
+  i2c_master_init();
+
+  while(1)
+  {
+    printf("\n\rI2C Bus scanning\n\r--------------------------\n\r");
+
+    ticks= i2c_scanbus();
+    showtable();
+
+    for (a= 0x08; a< 0x78; a++)
+    {
+      if (i2c_isfound(a)) fingerprint(a);
+    }
+
+    printf("\n\rScan: %d ms\n\r", ticks / tim1_ticks_ms);
     printf("Press any key for rescan... \n\r");
-    ch= uart_getchar();
-//    printf("Taste war: %c\n\n\r", ch);
+    uart_getchar();
   }
 }
@@ -0,0 +1,440 @@
+/* ----------------------------------------------------------
+                         imgconv.c
+
+     konvertiert ein Bild im PNM-Format (PBM, PGM, PPM,
+     jeweils ASCII oder binaer) in ein PROGMEM-Array fuer
+     die blit_P Funktionen der Displaytreiber (Format
+     siehe include/bitmap_p.h)
+
+     PNG-Dateien werden vorher mit bspw.
+
+         pngtopnm bild.png > bild.ppm
+         convert bild.png bild.ppm
+
+     umgewandelt.
+
+     17.10.2026    agent
+   ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+
+#define BMP_PAGE        0
+#define BMP_PAGER       1
+#define BMP_RGB565      2
+#define BMP_RLE         0x80
+
+struct image
+{
+  int      width;
+  int      height;
+  uint8_t  *rgb;                      // 3 Bytes je Pixel
+};
+
+/* ----------------------------------------------------------
+                          pnm_getc
+     liest ein Zeichen, Kommentare im Header werden
+     uebersprungen
+   ---------------------------------------------------------- */
+int pnm_getc(FILE *f)
+{
+  int c;
+
+  c= fgetc(f);
+  if (c == '#')
+  {
+    while ((c != '\n') && (c != EOF)) c= fgetc(f);
+  }
+  return c;
+}
+
+/* ----------------------------------------------------------
+                          pnm_getint
+     liest eine Dezimalzahl aus dem Header (oder aus den
+     Bilddaten der ASCII-Formate)
+   ---------------------------------------------------------- */
+int pnm_getint(FILE *f)
+{
+  int c, v;
+
+  do
+  {
+    c= pnm_getc(f);
+  } while ((c != EOF) && isspace(c));
+  if ((c == EOF) || !isdigit(c)) return -1;
+
+  v= 0;
+  while ((c != EOF) && isdigit(c))
+  {
+    v= v*10 + (c - '0');
+    c= pnm_getc(f);
+  }
+  return v;
+}
+
+/* ----------------------------------------------------------
+                          pnm_read
+
+     liest eine PNM-Datei
+
+     Rueckgabe: 0 = Fehler
+   ---------------------------------------------------------- */
+int pnm_read(const char *fname, struct image *img)
+{
+  FILE *f;
+  int  type, maxval, x, i, c= 0, v, bit;
+  long p, anz;
+
+  f= fopen(fname, "rb");
+  if (!f)
+  {
+    fprintf(stderr, "\n Datei %s kann nicht gelesen werden\n", fname);
+    return 0;
+  }
+
+  if (fgetc(f) != 'P') type= 0;
+                  else type= fgetc(f) - '0';
+  if ((type < 1) || (type > 6))
+  {
+    fprintf(stderr, "\n %s ist keine PNM-Datei (PBM, PGM, PPM)\n", fname);
+    fclose(f);
+    return 0;
+  }
+
+  img->width= pnm_getint(f);
+  img->height= pnm_getint(f);
+  maxval= ((type == 1) || (type == 4)) ? 1 : pnm_getint(f);
+  if ((img->width < 1) || (img->height < 1) || (maxval < 1) || (maxval > 65535))
+  {
+    fprintf(stderr, "\n fehlerhafter Header\n");
+    fclose(f);
+    return 0;
+  }
+
+  anz= (long)img->width * img->height;
+  img->rgb= malloc(anz * 3);
+
+  for (p= 0; p< anz; p++)
+  {
+    for (i= 0; i< 3; i++)
+    {
+      switch (type)
+      {
+        case 1 :                                    // PBM ASCII, 1 = schwarz
+        {
+          do { c= pnm_getc(f); } while ((c != EOF) && isspace(c));
+          v= (c == '1') ? 0 : 255;
+          img->rgb[p*3]= img->rgb[p*3+1]= img->rgb[p*3+2]= v;
+          i= 3;
+          break;
+        }
+        case 4 :                                    // PBM binaer, Zeilen auf Bytes aufgefuellt
+        {
+          x= p % img->width;
+          if ((x & 7) == 0) c= fgetc(f);
+          bit= (c >> (7 - (x & 7))) & 1;
+          v= bit ? 0 : 255;
+          img->rgb[p*3]= img->rgb[p*3+1]= img->rgb[p*3+2]= v;
+          i= 3;
+          break;
+        }
+        case 2 : case 5 :                           // PGM
+        case 3 : case 6 :                           // PPM
+        {
+          if (type <= 3) v= pnm_getint(f);
+          else
+          {
+            v= fgetc(f);
+            if (maxval > 255) v= (v << 8) | fgetc(f);
+          }
+          v= (long)v * 255 / maxval;
+          if ((type == 2) || (type == 5))
+          {
+            img->rgb[p*3]= img->rgb[p*3+1]= img->rgb[p*3+2]= v;
+            i= 3;
+          }
+          else img->rgb[p*3+i]= v;
+          break;
+        }
+      }
+    }
+  }
+  fclose(f);
+  return 1;
+}
+
+/* ----------------------------------------------------------
+                          diffuse
+
+     verteilt den Quantisierungsfehler err eines Pixels
+     nach Floyd-Steinberg auf die Nachbarpixel (Kanal ch
+     eines Fehlerpuffers mit 3 Kanaelen)
+   ---------------------------------------------------------- */
+void diffuse(int *buf, int w, int h, int x, int y, int ch, int err)
+{
+  if (x+1 < w)                  buf[((y  )*w + x+1)*3 + ch] += err * 7 / 16;
+  if ((y+1 < h) && (x > 0))     buf[((y+1)*w + x-1)*3 + ch] += err * 3 / 16;
+  if (y+1 < h)                  buf[((y+1)*w + x  )*3 + ch] += err * 5 / 16;
+  if ((y+1 < h) && (x+1 < w))   buf[((y+1)*w + x+1)*3 + ch] += err * 1 / 16;
+}
+
+/* ----------------------------------------------------------
+                          convert
+
+     erzeugt die unkomprimierten Bilddaten im Zielformat
+
+     Rueckgabe: Anzahl Bytes
+   ---------------------------------------------------------- */
+long convert(struct image *img, int format, int dither, int threshold, int invert,
+             uint8_t *out)
+{
+  int  *buf;
+  int  x, y, i, v, q, bits[3], set;
+  int  w, h, pages;
+  long anz, n;
+
+  w= img->width;
+  h= img->height;
+  anz= (long)w * h;
+
+  buf= malloc(anz * 3 * sizeof(int));
+  for (n= 0; n< anz * 3; n++) buf[n]= img->rgb[n];
+
+  if (format == BMP_RGB565)
+  {
+    bits[0]= 5; bits[1]= 6; bits[2]= 5;
+    for (y= 0; y< h; y++)
+    {
+      for (x= 0; x< w; x++)
+      {
+        uint16_t col= 0;
+        for (i= 0; i< 3; i++)
+        {
+          v= buf[(y*w + x)*3 + i];
+          if (v < 0) v= 0;
+          if (v > 255) v= 255;
+          q= (v * ((1 << bits[i]) - 1) + 127) / 255;
+          col= (col << bits[i]) | q;
+          if (dither) diffuse(buf, w, h, x, y, i, v - q * 255 / ((1 << bits[i]) - 1));
+        }
+        out[(y*w + x)*2]= col >> 8;
+        out[(y*w + x)*2 + 1]= col & 0xff;
+      }
+    }
+    free(buf);
+    return anz * 2;
+  }
+
+  // 1 Bit je Pixel, gesetztes Bit = dunkler Pixel (mit invert: heller Pixel)
+  pages= (h + 7) / 8;
+  memset(out, 0, (long)pages * w);
+  for (n= 0; n< anz; n++)                             // Graustufen in Kanal 0
+  {
+    buf[n*3]= (img->rgb[n*3] * 299 + img->rgb[n*3+1] * 587 + img->rgb[n*3+2] * 114) / 1000;
+  }
+  for (y= 0; y< h; y++)
+  {
+    for (x= 0; x< w; x++)
+    {
+      v= buf[(y*w + x)*3];
+      q= (v >= threshold) ? 255 : 0;
+      if (dither) diffuse(buf, w, h, x, y, 0, v - q);
+      set= (q == 0);
+      if (invert) set= !set;
+      if (set)
+      {
+        if (format == BMP_PAGE) out[(y >> 3)*w + x] |= 1 << (y & 7);
+                           else out[(y >> 3)*w + x] |= 0x80 >> (y & 7);
+      }
+    }
+  }
+  free(buf);
+  return (long)pages * w;
+}
+
+/* ----------------------------------------------------------
+                          rle_pack
+
+     komprimiert anz Bytes aus src in Einheiten von unit
+     Bytes (Format siehe include/bitmap_p.h)
+
+     Rueckgabe: Anzahl Bytes in dest
+   ---------------------------------------------------------- */
+long rle_pack(uint8_t *src, long anz, int unit, uint8_t *dest)
+{
+  long units, i, j, run, lit, d;
+  int  minrun;
+
+  units= anz / unit;
+  minrun= (unit == 1) ? 3 : 2;                        // ab hier spart ein Wiederholblock
+  d= 0;
+  i= 0;
+
+  #define SAME(a,b)  (memcmp(&src[(a)*unit], &src[(b)*unit], unit) == 0)
+
+  while (i < units)
+  {
+    for (run= 1; (i+run < units) && (run < 129) && SAME(i, i+run); run++);
+
+    if (run >= minrun)
+    {
+      dest[d++]= 0x80 | (run - 2);
+      memcpy(&dest[d], &src[i*unit], unit);
+      d += unit;
+      i += run;
+    }
+    else
+    {
+      // unkomprimierter Block bis zum naechsten lohnenden Wiederholblock
+      for (lit= 0; (i+lit < units) && (lit < 128); lit++)
+      {
+        for (j= 1; (i+lit+j < units) && (j < minrun) && SAME(i+lit, i+lit+j); j++);
+        if (j >= minrun) break;
+      }
+      dest[d++]= lit - 1;
+      memcpy(&dest[d], &src[i*unit], lit*unit);
+      d += lit*unit;
+      i += lit;
+    }
+  }
+  return d;
+}
+
+/* ----------------------------------------------------------
+                           show_help
+     gibt Syntaxmeldung aus
+   ---------------------------------------------------------- */
+void help_show(void)
+{
+  printf("  \nimgconv 0.10");
+  printf("  \n Syntax: imgconv [Optionen] bild.pnm > bild.c");
+  printf("  \n    -t format    | page   : 1 Bit/Pixel, Bit 0 oben (n5110, max7219)");
+  printf("  \n                 | pager  : 1 Bit/Pixel, Bit 7 oben (oled1306)");
+  printf("  \n                 | rgb565 : 16 Bit/Pixel (tftdisplay)");
+  printf("  \n                 | (Standard: page)");
+  printf("  \n    -n name      | Name des Arrays (Standard: image)");
+  printf("  \n    -d           | Dithering (Floyd-Steinberg)");
+  printf("  \n    -r           | RLE Komprimierung");
+  printf("  \n    -s value     | Schwelle hell/dunkel fuer 1 Bit/Pixel (Standard: 128)");
+  printf("  \n    -i           | 1 Bit/Pixel: Bit gesetzt fuer helle statt dunkle Pixel");
+  printf("  \n    -h           | diese Anzeige (Help)");
+  printf("  \n");
+}
+
+/* ---------------------------------------------------------------------------
+                                    M A I N
+   --------------------------------------------------------------------------- */
+int main (int argc, char **argv)
+{
+  struct image img;
+  char    name[64] = "image";
+  int     c, format, dither, rle, threshold, invert;
+  long    rawanz, rleanz, anz, i;
+  uint8_t *raw, *packed, *out;
+
+  format= BMP_PAGE;
+  dither= 0; rle= 0; invert= 0;
+  threshold= 128;
+
+  // Kommandozeile auswerten
+  opterr= 0;
+
+  while ((c = getopt (argc, argv, "ht:n:drs:i")) != -1)
+  {
+    switch (c)
+    {
+      case 't' :
+      {
+        if (!strcmp(optarg, "page")) format= BMP_PAGE;
+        else if (!strcmp(optarg, "pager")) format= BMP_PAGER;
+        else if (!strcmp(optarg, "rgb565")) format= BMP_RGB565;
+        else
+        {
+          fprintf(stderr, "Unbekanntes Format: %s\n", optarg);
+          return 1;
+        }
+        break;
+      }
+      case 'n' : strncpy(name, optarg, sizeof(name)-1); break;
+      case 'd' : dither= 1; break;
+      case 'r' : rle= 1; break;
+      case 's' : threshold= atoi(optarg); break;
+      case 'i' : invert= 1; break;
+      case 'h' :
+      {
+        help_show();
+        return -1;
+      }
+      default :
+      {
+        fprintf(stderr, "Unbekannte Option oder fehlender Parameter.\n");
+        help_show();
+        return 1;
+      }
+    }
+  }
+
+  if (optind >= argc)
+  {
+    help_show();
+    return -1;
+  }
+
+  if (!pnm_read(argv[optind], &img)) return 1;
+  if ((img.width > 255) || (img.height > ((format == BMP_RGB565) ? 255 : 248)))
+  {
+    fprintf(stderr, "\n Bild zu gross (max. 255 x 255 Pixel)\n");
+    return 1;
+  }
+
+  raw= malloc((long)img.width * (img.height + 7) * 2);
+  packed= malloc((long)img.width * (img.height + 7) * 3);
+
+  rawanz= convert(&img, format, dither, threshold, invert, raw);
+  rleanz= rle_pack(raw, rawanz, (format == BMP_RGB565) ? 2 : 1, packed);
+
+  if ((rle) && (rleanz < rawanz)) { out= packed; anz= rleanz; }
+  else { out= raw; anz= rawanz; rle= 0; }
+
+  // ---------------- Sourcedatei ausgeben ----------------
+  printf("/* -------------------------------------------------");
+  printf("\n     %s", name);
+  printf("\n");
+  printf("\n     erzeugt mit imgconv aus %s", argv[optind]);
+  printf("\n     %d x %d Pixel, %s%s, %ld Bytes", img.width, img.height,
+         (format == BMP_PAGE) ? "BMP_PAGE" : (format == BMP_PAGER) ? "BMP_PAGER" : "BMP_RGB565",
+         rle ? " | BMP_RLE" : "", anz + 3);
+  printf("\n   ------------------------------------------------- */");
+  printf("\n");
+  printf("\n#include \"bitmap_p.h\"");
+  printf("\n");
+  printf("\nconst uint8_t PROGMEM %s[] = {", name);
+  printf("\n  %d, %d, %s%s,", img.width, (format == BMP_RGB565) ? img.height : (img.height + 7) / 8 * 8,
+         (format == BMP_PAGE) ? "BMP_PAGE" : (format == BMP_PAGER) ? "BMP_PAGER" : "BMP_RGB565",
+         rle ? " | BMP_RLE" : "");
+  for (i= 0; i< anz; i++)
+  {
+    if (!(i % 12)) printf("\n  ");
+    printf("0x%.2x", out[i]);
+    if (i < anz-1) printf(", ");
+  }
+  printf("\n};");
+  printf("\n");
+
+  // ---------------- Bericht ----------------
+  fprintf(stderr, "\n %s: %d x %d Pixel", name, img.width, img.height);
+  fprintf(stderr, "\n   unkomprimiert     : %6ld Bytes", rawanz + 3);
+  fprintf(stderr, "\n   mit RLE           : %6ld Bytes%s", rleanz + 3,
+          (rleanz >= rawanz) ? " (groesser, nicht verwendet)" : "");
+  fprintf(stderr, "\n   ausgegeben        : %6ld Bytes", anz + 3);
+  fprintf(stderr, "\n");
+
+  free(img.rgb);
+  free(raw);
+  free(packed);
+  return 0;
+}
@@ -0,0 +1,27 @@
+/*  ---------------------------------------------------------
+                         aafont10d.h
+
+      Graustufen-Zeichensatz fuer lcd_putchar_aa (tftdisplay),
+      10 x 14 Pixel, 2 Bit je Pixel, Zeichen '-' '.' '/'
+      '0'..'9' ':' (Ascii 45..58) fuer Zahlen und Uhrzeiten.
+
+      Erzeugt mit fontcomp aus font8x8.c, benoetigt in
+      tftdisplay.h tft_aafont = 2 (im Makefile:
+      DEFS = -Dtft_aafont=2), aafont10d.o linken.
+
+          lcd_setaafont(&aafont10d);
+          lcd_putchar_aa('1');
+    --------------------------------------------------------- */
+
+#ifndef in_aafont10d
+  #define in_aafont10d
+
+  #include "tftdisplay.h"
+
+  #if (tft_aafont != 2)
+    #error "aafont10d benoetigt tft_aafont = 2"
+  #endif
+
+  extern const aafont_t aafont10d;
+
+#endif
@@ -0,0 +1,53 @@
+/* -------------------------------------------------------
+                        bcd_conv.h
+
+     Header fuer divisionsfreie Umwandlung von Binaer-
+     werten in Dezimalziffern (BCD) fuer die Ansteuerung
+     von 7-Segmentanzeigen und fuer my_printf
+
+     Der AVR besitzt keinen Hardwaredividierer, / und %
+     rufen je Ziffer eine Softwaredivision auf (mehrere
+     hundert Takte). Hier werden die Ziffern durch Sub-
+     traktion der Zehnerpotenzen ermittelt.
+
+     MCU   :  alle AVR
+
+     17.10.2026   agent
+   ------------------------------------------------------ */
+
+#ifndef in_bcd_conv
+  #define in_bcd_conv
+
+  #include <avr/io.h>
+  #include <avr/pgmspace.h>
+
+  // --------------------------------------------------------------------
+  //                      Prototypenbeschreibung
+  // --------------------------------------------------------------------
+
+  /* -------------------------------------------------------
+
+      ############### bcd_8bit(uint8_t value) ##############
+
+      wandelt einen Wert 0..99 in eine gepackte BCD-Zahl,
+      Zehner im oberen, Einer im unteren Nibble
+
+
+      ############### bcd_dig16(uint16_t value, uint8_t *dig, uint8_t anz) #####
+
+      zerlegt value in anz (1..5) Dezimalziffern, dig[0]
+      ist die hoechstwertige Ziffer. Stellen oberhalb von
+      anz werden verworfen (entspricht value % 10^anz)
+
+
+      ############### bcd_dig32(uint32_t value, uint8_t *dig, uint8_t anz) #####
+
+      wie bcd_dig16, anz = 1..10
+
+     ------------------------------------------------------- */
+
+  uint8_t bcd_8bit(uint8_t value);
+  void bcd_dig16(uint16_t value, uint8_t *dig, uint8_t anz);
+  void bcd_dig32(uint32_t value, uint8_t *dig, uint8_t anz);
+
+#endif
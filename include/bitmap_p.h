@@ -0,0 +1,75 @@
+/* -----------------------------------------------------
+                        bitmap_p.h
+
+    Header fuer Bitmaps im Flash, wie sie von imgconv
+    (siehe imgconv/readme.txt) erzeugt werden, und einen
+    Streamingdecoder, der die Bilddaten byteweise an
+    die blit_P Funktionen der Displaytreiber liefert.
+
+    Aufbau einer Bitmap (const uint8_t PROGMEM):
+
+       Byte 0   : Breite in Pixel
+       Byte 1   : Hoehe in Pixel (Pageformate: Vielfaches von 8)
+       Byte 2   : Format (BMP_xxx), Bit 7 = RLE komprimiert
+       ab 3     : Bilddaten
+
+    Formate:
+
+       BMP_PAGE     : 1 Bit/Pixel, pageweise (8 Pixelzeilen),
+                      je Page alle Spalten, Bit 0 = oben
+                      (n5110, max7219_dot8x8)
+       BMP_PAGER    : wie BMP_PAGE, Bit 7 = oben
+                      (oled1306_spi, oled1306_i2c)
+       BMP_RGB565   : 2 Byte/Pixel (MSB zuerst), zeilenweise
+                      (tftdisplay)
+
+    RLE: Steuerbyte c, danach
+       c <  0x80 : c+1 Einheiten unkomprimiert
+       c >= 0x80 : eine Einheit, die (c & 0x7f)+2 mal
+                   wiederholt wird
+    Eine Einheit ist bei BMP_RGB565 ein Pixel (2 Bytes),
+    sonst 1 Byte.
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_bitmap_p
+  #define in_bitmap_p
+
+  #include <stdint.h>
+  #include <avr/pgmspace.h>
+
+  #define BMP_PAGE              0
+  #define BMP_PAGER             1
+  #define BMP_RGB565            2
+  #define BMP_RLE               0x80
+
+  #define bmp_width(img)        pgm_read_byte(&(img)[0])
+  #define bmp_height(img)       pgm_read_byte(&(img)[1])
+  #define bmp_format(img)       (pgm_read_byte(&(img)[2]) & 0x7f)
+
+  // --------------------------------------------------------------------
+  //                      Prototypenbeschreibung
+  // --------------------------------------------------------------------
+
+  /* -------------------------------------------------------
+
+      ############### bmp_start(const uint8_t *img) ##########
+
+      setzt den Decoder auf den Anfang der Bilddaten von
+      img
+
+
+      ############### bmp_getbyte(void) ##########
+
+      liefert das naechste Byte der (dekomprimierten)
+      Bilddaten
+     ------------------------------------------------------- */
+
+  void bmp_start(const uint8_t *img);
+  uint8_t bmp_getbyte(void);
+
+#endif
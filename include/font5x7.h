@@ -23,6 +23,10 @@
     #define lastascii 96
   #endif
 
-  extern const uint8_t fonttab [][5];
+  extern const uint8_t fonttab[][5];
+
+  // font5x7_byte(ch,i) liefert Byte i des Zeichens ch (ab Zeichen 32)
+  // (komprimiert nicht kleiner, siehe fontcomp/readme.txt)
+  #define font5x7_byte(ch,i)     pgm_read_byte(&(fonttab[(ch)-32][i]))
 
 #endif
@@ -7,9 +7,28 @@
 #ifndef in_font8x8
   #define in_font8x8
 
+  #include <stdint.h>
+  #include <avr/pgmspace.h>
+
   #define fontsizex    8
   #define fontsizey    8
 
+  #ifndef font8x8_compressed             // im Makefile: DEFS = -Dfont8x8_compressed=1
+    #define font8x8_compressed  0        // 1 : komprimierten Zeichensatz verwenden, dann
+  #endif                                 //     zfont8x8.o und zfont.o statt font8x8.o linken
+                                         //     (Zeichensatz erzeugen: fontcomp/readme.txt).
+                                         //     Spart netto ca. 30 Bytes, mehr wenn weitere
+                                         //     Zeichensaetze den Decoder teilen (siehe dort)
+
   extern const uint8_t font8x8[][8];
 
+  // font8x8_byte(ch,i) liefert Byte i des Zeichens ch (ab Zeichen 32)
+  #if (font8x8_compressed == 1)
+    #include "zfont.h"
+    extern const zfont_t zfont8x8;
+    #define font8x8_byte(ch,i)     zfont_getbyte(&zfont8x8, (ch)-32, (i))
+  #else
+    #define font8x8_byte(ch,i)     pgm_read_byte(&(font8x8[(ch)-32][i]))
+  #endif
+
 #endif
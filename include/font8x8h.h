@@ -10,6 +10,22 @@
   #include <stdint.h>
   #include <avr/pgmspace.h>
 
+  #ifndef font8x8h_compressed             // im Makefile: DEFS = -Dfont8x8h_compressed=1
+    #define font8x8h_compressed  0        // 1 : komprimierten Zeichensatz verwenden, dann
+  #endif                                  //     zfont8x8h.o und zfont.o statt font8x8h.o linken
+                                          //     (Zeichensatz erzeugen: fontcomp/readme.txt).
+                                          //     Spart allein netto kaum etwas, lohnt wenn
+                                          //     weitere Zeichensaetze den Decoder teilen (siehe dort)
+
   extern const uint8_t font8x8h[][8];
 
+  // font8x8h_byte(ch,i) liefert Byte i des Zeichens ch (ab Zeichen 32)
+  #if (font8x8h_compressed == 1)
+    #include "zfont.h"
+    extern const zfont_t zfont8x8h;
+    #define font8x8h_byte(ch,i)     zfont_getbyte(&zfont8x8h, (ch)-32, (i))
+  #else
+    #define font8x8h_byte(ch,i)     pgm_read_byte(&(font8x8h[(ch)-32][i]))
+  #endif
+
 #endif
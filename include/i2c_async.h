@@ -0,0 +1,125 @@
+/* -----------------------------------------------------
+                        i2c_async.h
+
+    Header fuer interruptgesteuerten (nicht blockieren-
+    den) Software I2C-Bus
+
+    Transferschritte (Start + Adresse, Datenbytes, Stop)
+    werden in eine Queue eingetragen und im Hintergrund
+    von einem Timer1 Compare-Interrupt abgearbeitet.
+    Jeder Interruptaufruf erzeugt eine halbe Taktperiode
+    auf SCL, das Hauptprogramm rechnet waehrenddessen
+    weiter.
+
+    Es werden dieselben Anschluesse wie in i2c_sw.h ver-
+    wendet. Die blockierenden Funktionen aus i2c_sw.c
+    bleiben unveraendert und duerfen verwendet werden,
+    wenn die Queue leer ist (i2c_async_wait() ).
+
+    Belegte Resourcen: Timer1 (CTC), TIM1_COMPA_vect
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_i2c_async
+  #define in_i2c_async
+
+  #include <avr/io.h>
+  #include <avr/interrupt.h>
+
+  #include "i2c_sw.h"
+
+  // Anzahl der Eintraege der Transferqueue (Zweierpotenz, je Eintrag 3 Byte RAM)
+  #define i2c_async_qsize       16
+
+  // Busfrequenz in Hz (Interruptrate ist doppelt so hoch). Bei 8 MHz bleiben
+  // bei 25 kHz Bustakt ca. 45-50% der Rechenzeit fuer das Hauptprogramm uebrig
+  // (Schaetzung mit host/check_i2c_async.c)
+  #define i2c_async_clk         25000
+
+  // max. Anzahl Interruptticks, die ein Slave SCL low halten darf
+  // (Clockstretching), danach werden alle Eintraege verworfen
+  #define i2c_async_stretchmax  250
+
+  // Queue - Eintragstypen
+  #define I2CQ_DATA             0
+  #define I2CQ_START            1
+  #define I2CQ_STOP             2
+
+  extern volatile uint8_t i2c_async_nackcnt;          // Anzahl Bytes die nicht quittiert wurden
+  extern volatile uint8_t i2c_async_errcnt;           // Anzahl Abbrueche durch Clockstretch-Timeout
+  extern void (*i2c_async_ready)(void);               // Callback: Queue leer und Bus frei
+                                                      // (wird im Interrupt aufgerufen !)
+
+  // --------------------------------------------------------------------
+  //                      Prototypenbeschreibung
+  // --------------------------------------------------------------------
+
+  /* -------------------------------------------------------
+
+      ############### i2c_async_init ##############
+
+      initialisiert Busanschluesse und Timer1
+
+
+      ############### i2c_async_start(uint8_t addr) ##############
+
+      traegt Startcondition plus Deviceadresse in die
+      Queue ein (ist der Bus noch belegt, wird eine
+      Repeated-Start Condition erzeugt)
+
+
+      ############### i2c_async_write(uint8_t data) ##############
+
+      traegt ein Datenbyte in die Queue ein
+
+
+      ############### i2c_async_fill(uint8_t data, uint16_t anz) ####
+
+      traegt ein Datenbyte ein, das anz mal hintereinander
+      gesendet wird (bspw. Loeschen von Displayinhalten).
+      Je angefangene 256 Bytes wird ein Queueeintrag be-
+      legt (anz = 1024: 4 Eintraege), anz = 0 traegt
+      nichts ein
+
+
+      ############### i2c_async_stop(void) ##############
+
+      traegt eine Stopcondition in die Queue ein
+
+
+      ############### i2c_async_busy(void) ##############
+
+      Rueckgabe:
+                 1 : Queue enthaelt Eintraege oder Bus
+                     ist belegt
+                 0 : Transfers abgeschlossen
+
+
+      ############### i2c_async_free(void) ##############
+
+      Rueckgabe: Anzahl freier Queueeintraege
+
+
+      ############### i2c_async_wait(void) ##############
+
+      wartet bis alle Transfers abgeschlossen sind
+
+
+      Ist die Queue voll, warten die Eintragsfunktionen
+      bis ein Platz frei ist.
+     ------------------------------------------------------- */
+
+  void i2c_async_init(void);
+  void i2c_async_start(uint8_t addr);
+  void i2c_async_write(uint8_t data);
+  void i2c_async_fill(uint8_t data, uint16_t anz);
+  void i2c_async_stop(void);
+  uint8_t i2c_async_busy(void);
+  uint8_t i2c_async_free(void);
+  void i2c_async_wait(void);
+
+#endif
@@ -7,6 +7,17 @@
     MCU   :  alle
     Takt  :
 
+    Mit I2C_USI = 1 im Makefile (definiert I2C_USI_TWI) wird
+    anstelle des Bitbangings das USI-Interface des ATtiny44
+    im Two-Wire Modus verwendet (Fast-Mode 400 kHz).
+    Die Anschluesse sind dann fest vorgegeben:
+
+        PA6 = SDA
+        PA4 = SCL
+
+    USI-TWI und usiuart.c / uart_all.c schliessen sich gegen-
+    seitig aus (beide belegen das USI-Interface).
+
 
     27.01.2020   R. Seelig
   ------------------------------------------------------ */
@@ -18,23 +29,196 @@
 
   #include <util/delay.h>
   #include <avr/io.h>
+  #include <avr/pgmspace.h>
+
+  #if defined(I2C_USI_TWI)
+
+    // Anschluesse des USI-Interfaces (nicht veraenderbar)
+    #define i2c_sdaport    A
+    #define i2c_sdabitnr   6
+
+    #define i2c_sclport    A
+    #define i2c_sclbitnr   4
+
+    // Taktzyklen der Bitschleife in usi_transfer neben den Wartezeiten
+    // (avr-gcc -Os, abgezaehlt, siehe Tabelle unten)
+    #ifndef I2C_OVH_LOW
+      #define I2C_OVH_LOW    9
+    #endif
+    #ifndef I2C_OVH_HIGH
+      #define I2C_OVH_HIGH   3
+    #endif
+
+    #ifndef I2C_BUS_HZ
+      #define I2C_BUS_HZ   400000
+    #endif
 
-  // Dataanschluss
-  #define i2c_sdaport    A
-  #define i2c_sdabitnr   4
+  #else
 
-  // Clockanschluss
-  #define i2c_sclport    A
-  #define i2c_sclbitnr   5
+    // Anschluesse koennen im Makefile ueberschrieben werden, bspw.
+    // DEFS = -Di2c_sdaport=B -Di2c_sdabitnr=0 -Di2c_sclport=B -Di2c_sclbitnr=1
+    #ifndef i2c_sdaport
+      // Dataanschluss
+      #define i2c_sdaport    A
+      #define i2c_sdabitnr   4
 
+      // Clockanschluss
+      #define i2c_sclport    A
+      #define i2c_sclbitnr   5
+    #endif
 
-  #define short_puls     1            // Einheiten fuer einen langen Taktimpuls
-  #define long_puls      1            // Einheiten fuer einen kurzen Taktimpuls
-  #define del_wait       1            // Wartezeit fuer garantierten 0 Pegel SCL-Leitung
+    // Taktzyklen der Bitschleifen in i2c_write_nack / i2c_read neben den
+    // Wartezeiten, jeweils die kuerzere der beiden (avr-gcc -Os,
+    // abgezaehlt, siehe Tabelle unten)
+    #ifndef I2C_OVH_LOW
+      #define I2C_OVH_LOW    4
+    #endif
+    #ifndef I2C_OVH_HIGH
+      #define I2C_OVH_HIGH   8
+    #endif
 
-  #define short_del()     i2c_delay(short_puls)
-  #define long_del()      i2c_delay(long_puls)
-  #define wait_del()      i2c_delay(del_wait)
+    #ifndef I2C_BUS_HZ
+      #define I2C_BUS_HZ   100000
+    #endif
+
+  #endif
+
+
+  // ----------------------------------------------------------------
+  //   Clockstretching / Fehlercodes
+  //
+  //   Nach dem Freigeben von SCL wird max. I2C_STRETCH_US Mikro-
+  //   sekunden gewartet, bis ein Slave SCL ebenfalls freigibt.
+  //   Nach einem Timeout oder bei blockiertem Bus erzeugen alle
+  //   Funktionen bis zur naechsten Startcondition keine Takte mehr
+  //   und kehren sofort zurueck.
+  //
+  //   Die Rueckgabewerte von i2c_start / i2c_write sind unveraendert
+  //   (> 0 = Acknowledge), die Ursache eines Fehlers steht nach
+  //   jedem Aufruf in i2c_error.
+  // ----------------------------------------------------------------
+
+  #ifndef I2C_STRETCH_US
+    #define I2C_STRETCH_US   2000
+  #endif
+
+  #define I2C_OK             0            // kein Fehler
+  #define I2C_ERR_NACK       1            // Slave hat nicht quittiert
+  #define I2C_ERR_TIMEOUT    2            // Slave haelt SCL laenger als I2C_STRETCH_US
+  #define I2C_ERR_BUS        3            // SDA / SCL blockiert, Bus-Recovery erfolglos
+
+  extern uint8_t i2c_error;
+
+  // ----------------------------------------------------------------
+  //   Bustakt
+  //
+  //   I2C_BUS_HZ wird im Makefile angegeben (bspw. I2C_BUS_HZ = 400000)
+  //   und ist ansonsten 100 kHz (Bitbanging) bzw. 400 kHz (USI).
+  //
+  //   Eine Taktperiode wird zu 52% low und 48% high aufgeteilt (bzw.
+  //   laenger low, wenn tLOW das erfordert). Von jeder Halbperiode
+  //   werden die Taktzyklen abgezogen, die die Bitschleife neben den
+  //   Wartezeiten benoetigt (I2C_OVH_LOW / I2C_OVH_HIGH).
+  //
+  //   Die Werte sind aus den Befehlen abgezaehlt, die avr-gcc -Os fuer
+  //   die Schleifen erzeugt (Registerbits auf Port A, sbi/cbi 2 Takte,
+  //   in/out 1, sbis/sbic 2 beim Ueberspringen, rjmp/brne 2). Gezaehlt
+  //   wird von der Flanke bis einschliesslich des Befehls, der die
+  //   naechste Flanke erzeugt:
+  //
+  //     Bitbanging, i2c_write_nack    low : cbi PORT, sbrs, cbi DDR
+  //                                         (bzw. rjmp, sbi DDR, cbi
+  //                                         PORT), rjmp, cbi DDR  10 (11)
+  //                                   high: sbis PIN, lsl, subi, brne,
+  //                                         sbi DDR                8
+  //     Bitbanging, i2c_read          low : cbi PORT, cbi DDR      4
+  //                                   high: sbis PIN, sbic PIN, or,
+  //                                         lsr, subi, brne, sbi  10
+  //     USI, usi_transfer             low : sbic USISR, lds, cpi,
+  //                                         brsh, rjmp, out USICR  9
+  //                                   high: sbis PIN, out USICR    3
+  //
+  //   Beim Bitbanging gilt jeweils der kleinere Wert beider Schleifen,
+  //   damit tLOW / tHIGH und I2C_BUS_HZ auch in der schnelleren ein-
+  //   gehalten werden. Die andere Schleife laeuft entsprechend lang-
+  //   samer. Weicht das Listing (avr-objdump -d) einer anderen
+  //   Compilerversion ab, koennen beide Werte im Makefile angegeben
+  //   werden. host/check_i2c_timing.c prueft, dass die Schleifen noch
+  //   die gezaehlten Portzugriffe enthalten.
+  //
+  //   Erreichter Bustakt bei F_CPU = 8 MHz (Datenbytes, ohne ACK-Bit):
+  //
+  //     I2C_BUS_HZ   Bitbanging schreiben / lesen      USI
+  //       100000        93 kHz / 98 kHz               100 kHz
+  //       400000       308 kHz / 364 kHz              400 kHz
+  //      1000000       444 kHz / 571 kHz (Warnung)    667 kHz (Warnung)
+  //
+  //   Das ACK-Bit, Start und Stop benoetigen einige Takte mehr.
+  //
+  //   tLOW / tHIGH der Spezifikation (100k: 4,7 / 4,0 us, 400k: 1,3 /
+  //   0,6 us, 1M: 0,5 / 0,26 us, aufgerundet auf ganze Taktzyklen) werden
+  //   von Wartezeit plus I2C_OVH_LOW / I2C_OVH_HIGH eingehalten.
+  //
+  //   Die Wartezeiten werden vom Compiler zyklengenau mit
+  //   __builtin_avr_delay_cycles erzeugt und haengen damit nicht von
+  //   einer Schleife ab.
+  // ----------------------------------------------------------------
+
+  #if (I2C_BUS_HZ > 400000)                   // Fast-Mode Plus
+    #define I2C_TLOW_MIN_NS    500
+    #define I2C_THIGH_MIN_NS   260
+  #elif (I2C_BUS_HZ > 100000)                 // Fast-Mode
+    #define I2C_TLOW_MIN_NS    1300
+    #define I2C_THIGH_MIN_NS   600
+  #else                                       // Standard-Mode
+    #define I2C_TLOW_MIN_NS    4700
+    #define I2C_THIGH_MIN_NS   4000
+  #endif
+
+  // Taktzyklen fuer ns Nanosekunden, aufgerundet
+  #define I2C_NS_CYCLES(ns)  ( ((F_CPU) / 1000ul * (ns) + 999999ul) / 1000000ul )
+
+  #define I2C_TLOW_MIN       I2C_NS_CYCLES(I2C_TLOW_MIN_NS)
+  #define I2C_THIGH_MIN      I2C_NS_CYCLES(I2C_THIGH_MIN_NS)
+
+  #define I2C_PERIOD_CYCLES  ( (F_CPU) / (I2C_BUS_HZ) )
+  #define I2C_LOW_SPLIT      ( (I2C_PERIOD_CYCLES * 13) / 25 )
+
+  // low-Halbperiode: 52% der Periode, mindestens tLOW und mindestens
+  // die Laufzeit der Schleife
+  #if (I2C_LOW_SPLIT >= I2C_TLOW_MIN)
+    #define I2C_LOW_WANT     I2C_LOW_SPLIT
+  #else
+    #define I2C_LOW_WANT     I2C_TLOW_MIN
+  #endif
+  #if (I2C_LOW_WANT >= I2C_OVH_LOW)
+    #define I2C_LOW_CYCLES   I2C_LOW_WANT
+  #else
+    #define I2C_LOW_CYCLES   I2C_OVH_LOW
+  #endif
+  #define I2C_TLOW_DEL       ( I2C_LOW_CYCLES - I2C_OVH_LOW )
+
+  // high-Halbperiode: Rest der Periode, mindestens tHIGH bzw. Laufzeit
+  #if (I2C_THIGH_MIN >= I2C_OVH_HIGH)
+    #define I2C_HIGH_MIN     I2C_THIGH_MIN
+  #else
+    #define I2C_HIGH_MIN     I2C_OVH_HIGH
+  #endif
+  #if (I2C_PERIOD_CYCLES >= I2C_LOW_CYCLES + I2C_HIGH_MIN)
+    #define I2C_HIGH_CYCLES  ( I2C_PERIOD_CYCLES - I2C_LOW_CYCLES )
+  #else
+    #define I2C_HIGH_CYCLES  I2C_HIGH_MIN
+    #warning "I2C_BUS_HZ ist mit dieser Taktfrequenz nicht erreichbar, Bus laeuft langsamer"
+  #endif
+  #define I2C_THIGH_DEL      ( I2C_HIGH_CYCLES - I2C_OVH_HIGH )
+
+  #define i2c_tlow()       __builtin_avr_delay_cycles(I2C_TLOW_DEL)
+  #define i2c_thigh()      __builtin_avr_delay_cycles(I2C_THIGH_DEL)
+
+  // Bezeichnungen aelterer Versionen
+  #define short_del()      i2c_thigh()
+  #define long_del()       i2c_tlow()
+  #define wait_del()       i2c_thigh()
 
   // --------------------------------------------------------------------
   //                      Prototypenbeschreibung
@@ -42,6 +226,11 @@
 
   /* -------------------------------------------------------
 
+      ############### i2c_delay(uint16_t anz) ##############
+
+      wartet anz halbe Taktperioden des I2C-Busses
+
+
       ############### i2c_master_init ##############
 
       setzt die Pins die fuer den I2C Bus verwendet werden
@@ -99,6 +288,50 @@
 
       Rueckgabe:
                   gelesenes Byte
+
+
+      ############## i2c_bus_recover(void) ##############
+
+      gibt einen von einem Slave blockierten Bus frei
+      (bis zu 9 Taktimpulse bis SDA high, Stopcondition).
+      Wird von i2c_sendstart bei Bedarf selbst aufgerufen.
+
+      Rueckgabe:
+                 1 : Bus frei
+                 0 : SDA oder SCL weiterhin low
+
+
+      ############## i2c_write_buf(uint8_t addr, uint8_t reg, const uint8_t *buf, uint16_t len) ####
+
+      schreibt len Bytes ab Register reg in einer einzigen
+      Transaktion (Start, Adresse, Register, Daten, Stop).
+      Das Device muss die Registeradresse selbststaendig
+      erhoehen (Auto-Increment).
+
+      Uebergabe:
+                 addr : 8-Bit Deviceadresse (R/W-Bit = 0)
+                 reg  : erstes Register bzw. Steuerbyte
+                 buf  : Daten im RAM
+                 len  : Anzahl Bytes
+
+      Rueckgabe:
+                 > 0 wenn alle Bytes quittiert wurden
+                 == 0 wenn kein Acknowledge vom Slave
+
+
+      ############## i2c_write_buf_P(uint8_t addr, uint8_t reg, const uint8_t *buf, uint16_t len) ##
+
+      wie i2c_write_buf, die Daten liegen im Flash (PROGMEM)
+
+
+      ############## i2c_read_buf(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) ####
+
+      liest len Bytes ab Register reg (Registeradresse
+      schreiben, Repeated Start, sequentielles Lesen)
+
+      Rueckgabe:
+                 > 0 wenn das Device geantwortet hat
+                 == 0 wenn kein Acknowledge vom Slave
      ------------------------------------------------------- */
 
   void i2c_delay(uint16_t anz);
@@ -111,6 +344,10 @@
   uint8_t i2c_write(uint8_t data);
   uint8_t i2c_write16(uint16_t data);
   uint8_t i2c_read(uint8_t ack);
+  uint8_t i2c_bus_recover(void);
+  uint8_t i2c_write_buf(uint8_t addr, uint8_t reg, const uint8_t *buf, uint16_t len);
+  uint8_t i2c_write_buf_P(uint8_t addr, uint8_t reg, const uint8_t *buf, uint16_t len);
+  uint8_t i2c_read_buf(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
   #define i2c_read_ack()    i2c_read(1)
   #define i2c_read_nack()   i2c_read(0)
@@ -143,10 +380,12 @@
 
   #define sclport           conc2(PORT,i2c_sclport)
   #define sclddr            conc2(DDR,i2c_sclport)
+  #define sclpin            conc2(PIN,i2c_sclport)
 
   #define i2c_sda_hi()      sdaddr &= ~(1 << i2c_sdabitnr)
   #define i2c_sda_lo()      { sdaddr |= (1 << i2c_sdabitnr); sdaport &= ~(1 << i2c_sdabitnr); }
   #define i2c_is_sda()      ((sdapin & (1 << i2c_sdabitnr)) >> i2c_sdabitnr)
+  #define i2c_is_scl()      ((sclpin & (1 << i2c_sclbitnr)) >> i2c_sclbitnr)
 
   #define i2c_scl_hi()      sclddr &= ~(1 << i2c_sclbitnr)
   #define i2c_scl_lo()      { sclddr |= (1 << i2c_sclbitnr); sclport &= ~(1 << i2c_sclbitnr); }
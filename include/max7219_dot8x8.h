@@ -66,6 +66,13 @@ Anmerkung: CS ist eine irrefuehrende Bezeichnung, da es der Uebernahmeimpuls
   #include "avr_gpio.h"
   #include "font8x8h.h"
 
+  #ifndef bitmap_enable                     // im Makefile: DEFS = -Dbitmap_enable=1
+    #define bitmap_enable    0              // 1 : m7219_blit_P fuer Bitmaps im Flash (imgconv,
+  #endif                                    //     Format BMP_PAGE, 8x8) einbinden, bitmap_p.o linken
+  #if (bitmap_enable == 1)
+    #include "bitmap_p.h"
+  #endif
+
 
   // Pinzuordnung und Ein- Ausschaltmakros
   #define m7219_dininit()    PA0_output_init()
@@ -99,6 +106,9 @@ Anmerkung: CS ist eine irrefuehrende Bezeichnung, da es der Uebernahmeimpuls
   void m7219_col(uint8_t digit, uint8_t value);
   void m7219_setbmp(uint8_t *bmp);
   void m7219_setpgmbmp(const uint8_t *bmp);
+  #if (bitmap_enable == 1)
+    void m7219_blit_P(const uint8_t *image);
+  #endif
 
   // Framebuffer Funktionen
 
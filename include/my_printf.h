@@ -9,6 +9,7 @@
 
                 my_putchar(char c);
 
+     sowie das Modul bcd_conv (SRCS += ../src/bcd_conv.o)
 
      22.04.2016   R. Seelig
 
@@ -24,6 +25,12 @@
 
      29.08.2018    R. Seelig
 
+     Formatierer mit austauschbarer Ausgabefunktion (Sink), Feldbreite,
+     %u, %ld / %lu, %S (Flashstring), %k mit beliebiger Anzahl Nach-
+     kommastellen sowie Ausgabe in einen RAM-Puffer
+
+     17.10.2026    agent
+
    --------------------------------------------------------------------- */
 
 #ifndef in_myprintf
@@ -33,6 +40,16 @@
   #include <avr/pgmspace.h>
   #include <stdarg.h>
 
+  // 1 : %ld, %lu, %lx, %lk fuer 32-Bit Werte
+  // 0 : nur 16-Bit Werte (kleiner, schneller), bei 'l' wird das long-
+  //     Argument gelesen und auf 16 Bit gekuerzt ausgegeben
+  #ifndef printf_long_enable                  // im Makefile: DEFS = -Dprintf_long_enable=0
+    #define printf_long_enable  1
+  #endif
+
+  // Ausgabefunktion fuer own_fprintf (UART, Display, ...)
+  typedef void (*printf_sink_t)(char c);
+
   extern char printfkomma;
 
   void my_putchar(char c);
@@ -42,11 +59,15 @@
   void my_putramstring(uint8_t *p);
 
   void own_printf(const uint8_t *s,...);
+  void own_fprintf(printf_sink_t sink, const uint8_t *s,...);
+  void own_vfprintf(printf_sink_t sink, const uint8_t *s, va_list ap);
+  uint8_t own_sprintf(char *buf, const uint8_t *s,...);
 
   #define tiny_printf(str,...)  (own_printf(PSTR(str), ## __VA_ARGS__))
   #define my_printf             tiny_printf
 
-
-#endif
+  #define my_fprintf(sink,str,...)  (own_fprintf(sink, PSTR(str), ## __VA_ARGS__))
+  #define my_sprintf(buf,str,...)   (own_sprintf(buf, PSTR(str), ## __VA_ARGS__))
 
 
+#endif
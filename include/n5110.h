@@ -52,26 +52,31 @@ Hinweis:
   #include <avr/io.h>
   #include <avr/pgmspace.h>
   #include "font5x7.h"
+  #include "usi_spi.h"
 
 
-  #define hardware_spi                 1        // 0 : SPI ueber Bitbanging realisieren, hier
-                                                //     duerfen dann die Anschlusspins veraendert werden
-                                                // 1 : SPI ueber USI-Hardware realisieren,
-                                                //     Anschlusspins fuer Mosi, Miso, Clk duerfen
-                                                //     NICHT veraendert werden
+  // SPI (USI oder Bitbanging, CLK = PA4, DIN = PA5): siehe usi_spi.h
+  // Der PCD8544 verarbeitet max. 4 MHz SCK
+  #if ((F_CPU) / 2 > 4000000) && ((spi_maxclk == 0) || (spi_maxclk > 4000000))
+    #error "n5110: SCK = F_CPU / 2 > 4 MHz, im Makefile DEFS = -Dspi_maxclk=4000000 angeben"
+  #endif
+
+  #ifndef stripout_enable                       // im Makefile: DEFS = -Dstripout_enable=1
+    #define stripout_enable            0        // 1 : Ausgabefunktion lcd_stripout fuer
+  #endif                                        //     strip_render.c einbinden
 
-  #define SPI_DDR                 DDRA
-  #define SPI_PORT                PORTA
-  #define SPI_MOSI_PIN            PA5
-  #define SPI_MISO_PIN            PA6
-  #define SPI_CLK_PIN             PA4
-  #define SPI_SS_PIN              PA2
+  #ifndef bitmap_enable                         // im Makefile: DEFS = -Dbitmap_enable=1
+    #define bitmap_enable              0        // 1 : lcd_blit_P fuer Bitmaps im Flash (imgconv,
+  #endif                                        //     Format BMP_PAGE) einbinden, bitmap_p.o linken
+  #if (bitmap_enable == 1)
+    #include "bitmap_p.h"
+  #endif
 
   #define LCD_PORT                PORTA
   #define LCD_DDR                 DDRA
   #define LCD_RST_PIN             PA1
   #define LCD_DC_PIN              PA0
-  #define LCD_CE_PIN              SPI_SS_PIN
+  #define LCD_CE_PIN              PA2
 
 
   #ifdef n3410
@@ -99,8 +104,6 @@ Hinweis:
                           Prototypen
      ---------------------------------------------------- */
 
-  void spi_init(void);
-  unsigned char spi_out(uint8_t data);
   void wrcmd(uint8_t command);                                  // sende ein Kommando
   void lcd_init(uint8_t contrast, uint8_t bias, uint8_t temp);  // initialisiert das Display
   void wrdata(uint8_t dat);                                     // sende ein Datum
@@ -110,6 +113,13 @@ Hinweis:
   void putramstring(char *c);                                   // schreibe String aus dem RAM
   void putromstring(const unsigned char *dataPtr);              // dto. ROM
 
+  #if (stripout_enable == 1)
+    void lcd_stripout(uint8_t page, uint8_t *buf, uint8_t width); // Streifen (8 Pixelzeilen) ausgeben
+  #endif
+  #if (bitmap_enable == 1)
+    void lcd_blit_P(uint8_t x, uint8_t page, const uint8_t *image); // Bitmap (imgconv) aus dem Flash ausgeben
+  #endif
+
   #define prints(tx)     (putromstring(PSTR(tx)))               // Anzeige String aus Flashrom: prints("Text");
   #define printa(tx)     (putramstring(tx))                     // Anzeige eines Strings der in einem Array im RAM liegt
 
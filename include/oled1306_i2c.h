@@ -39,6 +39,64 @@
 
   #define ssd1306_addr          0x78
 
+  // oled_async = 1 : clrscr wird ueber die Transferqueue aus i2c_async.c im
+  //                  Hintergrund gesendet (i2c_async.o muss hinzugelinkt werden,
+  //                  belegt Timer1)
+  #ifndef oled_async                    // im Makefile: DEFS = -Doled_async=1
+    #define oled_async          0
+  #endif
+
+  #if (oled_async == 1)
+    #include "i2c_async.h"
+    #define oled_sync()         i2c_async_wait()
+  #else
+    #define oled_sync()
+  #endif
+
+  // oled_framebuffer = 1 : Zeichenausgaben innerhalb eines Fensters (Angabe in
+  //                        Textkoordinaten) werden in einem RAM-Puffer gesammelt
+  //                        und erst mit oled_flush() gesendet. Gesendet werden
+  //                        nur die geaenderten Spalten, je Page in einem Block.
+  //                        Ein Zeichen, das sich nicht geaendert hat, erzeugt
+  //                        keinen Bustransfer. Ausgaben ausserhalb des Fensters
+  //                        werden wie bisher direkt gesendet. Ragt eine direkte
+  //                        Ausgabe (doublechar, oled_blit_P) in das Fenster,
+  //                        werden die betroffenen Bytes in den Puffer uebernommen.
+  //
+  //                        RAM-Bedarf: oled_fbwin_cols * oled_fbwin_rows * 8 Bytes
+  //                        (ein kompletter Bildspeicher mit 1024 Bytes passt
+  //                        nicht in die 256 Bytes des ATtiny44)
+  #ifndef oled_framebuffer
+    #define oled_framebuffer    0
+  #endif
+
+  // Fenster, im Makefile bspw.: DEFS = -Doled_fbwin_cols=16 -Doled_fbwin_rows=1
+  #ifndef oled_fbwin_x
+    #define oled_fbwin_x        0               // linke Spalte des Fensters (0..15)
+  #endif
+  #ifndef oled_fbwin_y
+    #define oled_fbwin_y        0               // obere Textzeile des Fensters (0..7)
+  #endif
+  #ifndef oled_fbwin_cols
+    #define oled_fbwin_cols     8               // Breite in Zeichen
+  #endif
+  #ifndef oled_fbwin_rows
+    #define oled_fbwin_rows     2               // Hoehe in Textzeilen (= Pages)
+  #endif
+
+  // bitmap_enable = 1 : oled_blit_P fuer Bitmaps im Flash (imgconv, Format
+  //                     BMP_PAGER) einbinden, bitmap_p.o muss hinzugelinkt
+  //                     werden. Die Bitmap wird direkt gesendet, Bytes im
+  //                     Fenster des Framebuffers werden in den Puffer
+  //                     uebernommen
+  #ifndef bitmap_enable
+    #define bitmap_enable       0
+  #endif
+
+  #if (bitmap_enable == 1)
+    #include "bitmap_p.h"
+  #endif
+
   extern uint8_t aktxp;
   extern uint8_t aktyp;
   extern uint8_t doublechar;
@@ -50,5 +108,17 @@
   void clrscr(void);
   void oled_putchar(uint8_t ch);
 
+  #if (oled_framebuffer == 1)
+
+    void oled_flush(void);
+
+  #endif
+
+  #if (bitmap_enable == 1)
+
+    void oled_blit_P(uint8_t x, uint8_t page, const uint8_t *image);
+
+  #endif
+
 
 #endif
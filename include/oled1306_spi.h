@@ -89,19 +89,25 @@ Hinweis:
   #include <avr/io.h>
   #include <avr/pgmspace.h>
   #include "avr_gpio.h"
+  #include "usi_spi.h"
 
-  #define hardware_spi          1        // 0 : SPI ueber Bitbanging realisieren, hier
-                                         //     duerfen dann die Anschlusspins veraendert werden
-                                         // 1 : SPI ueber USI-Hardware realisieren,
-                                         //     Anschlusspins fuer Mosi, Miso, Clk duerfen
-                                         //     NICHT veraendert werden
+  // SPI (USI oder Bitbanging, D0 = PA4, D1 = PA5): siehe usi_spi.h
+
+  #ifndef stripout_enable                // im Makefile: DEFS = -Dstripout_enable=1
+    #define stripout_enable     0        // 1 : Ausgabefunktion oled_stripout fuer
+  #endif                                 //     strip_render.c einbinden
+
+  #ifndef bitmap_enable                  // im Makefile: DEFS = -Dbitmap_enable=1
+    #define bitmap_enable       0        // 1 : oled_blit_P fuer Bitmaps im Flash (imgconv,
+  #endif                                 //     Format BMP_PAGER) einbinden, bitmap_p.o linken
+  #if (bitmap_enable == 1)
+    #include "bitmap_p.h"
+  #endif
 
 
-  #define sw_mosiinit()         PA5_output_init()
   #define sw_csinit()           PA2_output_init()
   #define sw_resinit()          PA1_output_init()
   #define sw_dcinit()           PA0_output_init()
-  #define sw_sckinit()          PA4_output_init()
 
   #define dc_set()              ( PA0_set() )
   #define dc_clr()              ( PA0_clr() )
@@ -110,12 +116,6 @@ Hinweis:
   #define rst_set()             ( PA1_set() )
   #define rst_clr()             ( PA1_clr() )
 
-  #define mosi_set()            ( PA5_set() )
-  #define mosi_clr()            ( PA5_clr() )
-  #define sck_set()             ( PA4_set() )
-  #define sck_clr()             ( PA4_clr() )
-
-
   #define oled_enable()         ( PA2_clr() )
   #define oled_disable()        ( PA2_set() )
   #define oled_cmdmode()        ( PA0_clr() )      // SPI-Wert als Kommando
@@ -135,5 +135,13 @@ Hinweis:
   void clrscr(void);
   void oled_putchar(uint8_t ch);
 
+  #if (stripout_enable == 1)
+    void oled_stripout(uint8_t page, uint8_t *buf, uint8_t width);
+  #endif
+
+  #if (bitmap_enable == 1)
+    void oled_blit_P(uint8_t x, uint8_t page, const uint8_t *image);
+  #endif
+
 #endif
 
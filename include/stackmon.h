@@ -0,0 +1,62 @@
+/* ------------------------------------------------------------------
+                              stackmon.h
+
+     Stackueberwachung durch "Bemalen" des freien RAM's
+
+     Beim Start (Sektion .init3, vor dem Initialisieren von .data
+     und .bss) wird der gesamte Bereich zwischen dem Ende von
+     .bss und RAMEND mit dem Wert STACK_CANARY gefuellt. Der
+     Stack ueberschreibt diese Bytes, stack_highwater liefert
+     daher die groesste bisher benoetigte Stacktiefe.
+
+     Das Modul ist optional: es genuegt, im Makefile
+
+        SRCS += ../src/stackmon.o
+
+     anzugeben, das Fuellen geschieht dann automatisch.
+
+     Hinweise:
+       - ein auf den Stack gelegtes Byte mit dem Wert STACK_CANARY
+         wird nicht erkannt, der Wert kann also (selten) um wenige
+         Bytes zu klein sein
+       - nicht zusammen mit malloc verwenden (Heap liegt im selben
+         Bereich)
+
+     MCU   : ATtiny44
+
+     17.10.2026 agent
+   ------------------------------------------------------------------ */
+
+#ifndef in_stackmon
+  #define in_stackmon
+
+  #include <stdint.h>
+  #include <avr/io.h>
+
+  #define STACK_CANARY      0xc5
+
+
+/* --------------------------------------------------------
+     Prototypen:
+
+   --------------------------------------------------------
+     uint16_t stack_highwater(void);
+
+         Rueckgabe:
+            groesste bisher benutzte Stacktiefe in Bytes
+            (seit dem Reset)
+
+   --------------------------------------------------------
+     uint16_t stack_unused(void);
+
+         Rueckgabe:
+            Anzahl Bytes zwischen dem Ende von .bss und dem
+            tiefsten bisher erreichten Stackzeiger, die noch
+            nie benutzt wurden (Reserve)
+
+   -------------------------------------------------------- */
+
+  uint16_t stack_highwater(void);
+  uint16_t stack_unused(void);
+
+#endif
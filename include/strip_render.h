@@ -0,0 +1,156 @@
+/* -----------------------------------------------------
+                        strip_render.h
+
+    Header fuer Streifen-Rendering (partieller Frame-
+    buffer) auf Displays, deren Bildspeicher nicht in
+    das RAM des ATtiny passt (TFT, SSD1306 SPI, N5110)
+
+    Das Hauptprogramm zeichnet seine Szene in einer
+    Callback-Funktion (strip_draw). strip_render ruft
+    diese fuer jeden 8 Pixel hohen Streifen des Displays
+    einmal auf, die Zeichenfunktionen schreiben dabei
+    nur den Teil, der im aktuellen Streifen liegt, in
+    den Streifenpuffer. Der fertige Streifen wird von der
+    Ausgabefunktion des Displaytreibers (strip_output)
+    mit einer einzigen Adressierung auf das Display
+    uebertragen.
+
+    Aufbau des Streifenpuffers (wie eine Page bei
+    SSD1306 / PCD8544):
+
+       strip_buf[x], Bit 0 = oberste Pixelzeile des
+       Streifens, Bit 7 = unterste Pixelzeile
+
+    Ausgabefunktionen der Treiber (dort jeweils mit
+    stripout_enable 1 einbinden):
+
+       n5110.c        : lcd_stripout
+       oled1306_spi.c : oled_stripout
+       tftdisplay.c   : lcd_stripout  (1 = textcolor,
+                                       0 = bkcolor)
+
+    Beispiel:
+
+       void scene(void)
+       {
+         strip_line(0,0, 127,63, 1);
+         strip_putstring(10,20, "Hallo", 1);
+       }
+
+       strip_output= oled_stripout;
+       strip_draw= scene;
+       strip_render();
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_strip_render
+  #define in_strip_render
+
+  #include <stdint.h>
+  #include <avr/pgmspace.h>
+
+  // Displayaufloesung in Pixel. strip_xres ist gleichzeitig die Groesse des
+  // Streifenpuffers in Byte, strip_yres muss ein Vielfaches von 8 sein
+  //   SSD1306 : 128 x 64,  N5110 : 84 x 48,  TFT : 128 x 128
+  // im Makefile: DEFS = -Dstrip_xres=84 -Dstrip_yres=48
+  #ifndef strip_xres
+    #define strip_xres          128
+  #endif
+  #ifndef strip_yres
+    #define strip_yres          64
+  #endif
+
+  // Zeichensatz fuer Textausgaben
+  //   0 : keine Textausgabe
+  //   1 : font5x7  (fonttab, 6 Pixel Zeichenbreite)
+  //   2 : font8x8h (8 Pixel Zeichenbreite)
+  #ifndef strip_font
+    #define strip_font          1
+  #endif
+
+  #if (strip_font == 1)
+    #include "font5x7.h"
+    #define strip_fontx         6
+  #elif (strip_font == 2)
+    #include "font8x8h.h"
+    #define strip_fontx         8
+  #endif
+
+  extern uint8_t strip_buf[strip_xres];               // aktueller Streifen
+  extern uint8_t strip_y0;                            // erste Pixelzeile des aktuellen Streifens
+  extern uint8_t strip_bkcolor;                       // Hintergrund (0 / 1) mit dem jeder Streifen
+                                                      // vor dem Zeichnen gefuellt wird
+
+  extern void (*strip_draw)(void);                    // Callback: zeichnet die Szene
+  extern void (*strip_output)(uint8_t page, uint8_t *buf, uint8_t width);
+                                                      // Ausgabefunktion des Displaytreibers
+
+  // --------------------------------------------------------------------
+  //                      Prototypenbeschreibung
+  // --------------------------------------------------------------------
+
+  /* -------------------------------------------------------
+
+      ############### strip_render(void) ##############
+
+      zeichnet das gesamte Display Streifen fuer Streifen,
+      ohne gesetztes strip_output wird nichts gezeichnet
+
+
+      ############### strip_renderrows(uint8_t y1, uint8_t y2) ######
+
+      zeichnet nur die Streifen, die die Pixelzeilen y1..y2
+      enthalten (Teilaktualisierung)
+
+
+      Zeichenfunktionen (nur innerhalb von strip_draw auf-
+      rufen). col: 1 = Pixel setzen, 0 = Pixel loeschen,
+      2 = Pixel invertieren. Koordinaten ausserhalb des
+      Displays werden abgeschnitten
+
+      ############### strip_putpixel(int16_t x, int16_t y, uint8_t col)
+      ############### strip_hline(int16_t x1, int16_t x2, int16_t y, uint8_t col)
+      ############### strip_vline(int16_t x, int16_t y1, int16_t y2, uint8_t col)
+      ############### strip_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+      ############### strip_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+      ############### strip_fillrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+
+      ############### strip_putchar(int16_t x, int16_t y, uint8_t ch, uint8_t col)
+
+      zeichnet ein Zeichen an Pixelposition x,y (linke
+      obere Ecke, beliebige Y-Position)
+
+      Rueckgabe: X-Position des naechsten Zeichens
+
+
+      ############### strip_putstring(int16_t x, int16_t y, char *s, uint8_t col)
+      ############### strip_putstring_P(int16_t x, int16_t y, const char *s, uint8_t col)
+
+      Textausgabe aus RAM bzw. Flash
+
+      Rueckgabe: X-Position nach dem Text
+     ------------------------------------------------------- */
+
+  void strip_render(void);
+  void strip_renderrows(uint8_t y1, uint8_t y2);
+
+  void strip_putpixel(int16_t x, int16_t y, uint8_t col);
+  void strip_hline(int16_t x1, int16_t x2, int16_t y, uint8_t col);
+  void strip_vline(int16_t x, int16_t y1, int16_t y2, uint8_t col);
+  void strip_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col);
+  void strip_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col);
+  void strip_fillrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col);
+
+  #if (strip_font != 0)
+    int16_t strip_putchar(int16_t x, int16_t y, uint8_t ch, uint8_t col);
+    int16_t strip_putstring(int16_t x, int16_t y, char *s, uint8_t col);
+    int16_t strip_putstring_P(int16_t x, int16_t y, const char *s, uint8_t col);
+  #endif
+
+  #define strip_prints(x,y,tx,col)   (strip_putstring_P(x,y,PSTR(tx),col))
+
+#endif
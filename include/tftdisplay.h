@@ -42,6 +42,7 @@
   #include <avr/pgmspace.h>
 
   #include "avr_gpio.h"
+  #include "usi_spi.h"
 
   // Auswahl des Displaycontrollers (ILI9163 und S6D02A1 haben dieselben Sequenzen)
 
@@ -85,11 +86,36 @@
   #define mirror                  0                 // 0 : normale Ausgabe
                                                     // 1 : Spiegelbildausgabe
 
-  #define hardware_spi            1                 // 0 : SPI ueber Bitbanging realisieren, hier
-                                                    //     duerfen dann die Anschlusspins veraendert werden
-                                                    // 1 : SPI ueber USI-Hardware realisieren,
-                                                    //     Anschlusspins fuer Mosi, Miso, Clk duerfen
-                                                    //     NICHT veraendert werden
+  // SPI (USI oder Bitbanging, CLK = PA4, DIN = PA5): siehe usi_spi.h
+
+  #ifndef stripout_enable                           // im Makefile: DEFS = -Dstripout_enable=1
+    #define stripout_enable       0                 // 1 : Ausgabefunktion lcd_stripout fuer
+  #endif                                            //     strip_render.c einbinden
+
+  #ifndef bitmap_enable                             // im Makefile: DEFS = -Dbitmap_enable=1
+    #define bitmap_enable         0                 // 1 : blit_P fuer Bitmaps im Flash (imgconv, Format
+  #endif                                            //     BMP_RGB565) einbinden, bitmap_p.o linken
+  #if (bitmap_enable == 1)
+    #include "bitmap_p.h"
+  #endif
+
+  #ifndef tft_scroll                                // im Makefile: DEFS = -Dtft_scroll=1
+    #define tft_scroll            0                 // 1 : Terminalmodus: Textausgabe scrollt am unteren
+  #endif                                            //     Rand per Hardwarescrolling (VSCRDEF / VSCRSADD)
+                                                    //     statt neu zu zeichnen (nicht ili9225,
+                                                    //     nur outmode 0 und 3)
+
+  #ifndef tft_gramrows                              // im Makefile: DEFS = -Dtft_gramrows=320
+    #define tft_gramrows          160               // Anzahl Zeilen im Display-Ram des Controllers
+  #endif                                            // (ST7735 / ILI9163: 160, ILI9340: 320)
+
+  #ifndef tft_aafont                                // im Makefile: DEFS = -Dtft_aafont=2
+    #define tft_aafont            0                 // Graustufen-Zeichensatz (Antialiasing) fuer lcd_putchar_aa
+  #endif                                            // 0 : nicht verwenden
+                                                    // 2 : 2 Bit je Pixel (4 Stufen, 8 Byte RAM),
+                                                    //     bspw. aafont10d.c (aafont10d.o linken)
+                                                    // 4 : 4 Bit je Pixel (16 Stufen, 32 Byte RAM)
+                                                    // weitere Zeichensaetze: fontcomp -a (fontcomp/readme.txt)
 
 /*  ------------------------------------------------------------
                        Pinbelegung
@@ -108,14 +134,6 @@
                             Vcc (8)
 */
 
-  #define mosi_init()             PA5_output_init()
-  #define clk_init()              PA4_output_init()
-
-  #define mosi_set()              PA5_set()
-  #define mosi_clr()              PA5_clr()
-  #define clk_set()               PA4_set()
-  #define clk_clr()               PA4_clr()
-
   #define rst_init()              PA1_output_init()
   #define ce_init()               PA2_output_init()
   #define dc_init()               PA0_output_init()
@@ -133,6 +151,27 @@
 
   #define lastascii 126                       // letztes angegebenes Asciizeichen
 
+  #if (tft_aafont != 0)
+
+    /*  ------------------------------------------------------------
+          Beschreibung eines Graustufen-Zeichensatzes (liegt im Flash)
+
+          bitmap: je Zeichen height Pixelzeilen, jede Zeile beginnt
+          auf einer Bytegrenze, linkes Pixel in den hoechstwertigen
+          Bits. Pixelwert 0 = Hintergrund, Maximalwert = Textfarbe,
+          Zwischenwerte werden gemischt
+        ------------------------------------------------------------ */
+    typedef struct
+    {
+      uint8_t        width;                 // Zeichenbreite in Pixel
+      uint8_t        height;                // Zeichenhoehe in Pixel
+      uint8_t        first;                 // erstes enthaltenes Zeichen
+      uint8_t        last;                  // letztes enthaltenes Zeichen
+      const uint8_t  *bitmap;               // Pixeldaten (PROGMEM)
+    } aafont_t;
+
+  #endif
+
   /*  ------------------------------------------------------------
                          P R O T O T Y P E N
       ------------------------------------------------------------ */
@@ -142,6 +181,24 @@
   void lcd_init(void);                                                        // initialisiert Display
   void putpixel(int x, int y,uint16_t color);                                 // schreibt einen einzelnen Punkt auf das Display
   void clrscr();                                                              // loescht Display-Inhalt
+  void fillrect(int x1, int y1, int x2, int y2, uint16_t color);              // ausgefuelltes Rechteck (ein Adressfenster)
+  void hline(int x1, int x2, int y, uint16_t color);                          // waagerechte Linie
+  void vline(int x, int y1, int y2, uint16_t color);                          // senkrechte Linie
+  void blit(int x, int y, uint8_t w, uint8_t h, const uint16_t *image);       // RGB565 Bild aus dem RAM ausgeben
+  #if (bitmap_enable == 1)
+    void blit_P(int x, int y, const uint8_t *image);                          // Bitmap (imgconv) aus dem Flash ausgeben
+  #endif
+  #if (tft_aafont != 0)
+    void lcd_setaafont(const aafont_t *font);                                 // Graustufen-Zeichensatz (im Flash) waehlen
+    void lcd_putchar_aa(uint8_t ch);                                          // Zeichen mit Antialiasing ausgeben
+  #endif
+  #if (tft_scroll == 1)
+    void lcd_scrollup(uint8_t rows);                                          // Hardwarescrolling um rows Pixelzeilen
+  #endif
+  #if (ili9225 == 0)
+    void lcd_partialarea(uint16_t y1, uint16_t y2);                           // nur Zeilen y1..y2 anzeigen
+    void lcd_normalmode(void);                                                // gesamtes Display anzeigen
+  #endif
   uint16_t rgbfromvalue(uint8_t r, uint8_t g, uint8_t b);                     // konvertiert einen 24 Bit RGB-Farbwert in einen 16 Bit Farbwert
   uint16_t rgbfromega(uint8_t entry);                                         // konvertiert einen Farbwert aus der EGA-Palette in einen 16 Bit Farbwert
   void gotoxy(unsigned char x, unsigned char y);                              // setzt den Textcursor fuer Textausgaben
@@ -149,6 +206,10 @@
   void lcd_putramstring(char *c);                                                 // Uebergabe eines Zeigers (auf einen String)
   void lcd_putromstring(const unsigned char *dataPtr);
 
+  #if (stripout_enable == 1)
+    void lcd_stripout(uint8_t page, uint8_t *buf, uint8_t width);             // Streifen aus strip_render.c ausgeben
+  #endif
+
   /*  ------------------------------------------------------------
                       EGA - Farbzuweisungen
       ------------------------------------------------------------ */
@@ -184,6 +245,11 @@
     #define coladdr      0x2a
     #define rowaddr      0x2b
     #define writereg     0x2c
+    #define ptlar        0x30                   // Partial Area
+    #define ptlon        0x12                   // Partial Mode on
+    #define noron        0x13                   // Normal Mode on
+    #define vscrdef      0x33                   // Vertical Scrolling Definition
+    #define vscrsadd     0x37                   // Vertical Scrolling Start Address
   #endif
 
   //-------------------------------------------------------------
@@ -40,8 +40,9 @@
   #include "avr_gpio.h"
 
 
-  #define board_version                           1      // 1 => Board mit 8 Tasten und zusaetzlichen 8 Einzel-LED
-                                                         // 2 => Board mit 16 Tasten
+  #ifndef board_version                                  // im Makefile: DEFS = -Dboard_version=2
+    #define board_version                         1      // 1 => Board mit 8 Tasten und zusaetzlichen 8 Einzel-LED
+  #endif                                                 // 2 => Board mit 16 Tasten
 
   /* ----------------------------------------------------------
          Anschluss CLK und DIO des TM1638 an den Controller
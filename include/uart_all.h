@@ -56,8 +56,12 @@
   #include <avr/interrupt.h>
 
 
-  #define echo_enable     0
-  #define readint_enable  1
+  #ifndef echo_enable                   // im Makefile: DEFS = -Decho_enable=1
+    #define echo_enable     0               // 1 : uart_getchar sendet jedes Zeichen zurueck
+  #endif
+  #ifndef readint_enable
+    #define readint_enable  1               // 1 : uart_readint einbinden
+  #endif
 
   /* -----------------------------------------------------------------------
       Moegliche Baudratenkombinationen fuer ATtiny24 - 84, ATtiny25 - 85
@@ -77,6 +81,45 @@
   #define uart_crlf()     { uart_putchar(0x0d); uart_putchar(0x0a); }
 
 
+  /* -----------------------------------------------------------------------
+      Empfangspuffer (Zweierpotenz), wird fuer Hardware-UART und USI-Serial
+      interruptgesteuert gefuellt.
+
+      Fehlerzaehler (bleiben bei 255 stehen):
+
+        uart_err_overrun : Zeichen verloren, da Empfangspuffer (bzw. beim
+                           Hardware-UART das Datenregister) voll war oder
+                           (USI-Serial, halbduplex) waehrend des Sendens
+                           ein Startbit eintraf
+        uart_err_frame   : Stopbit war nicht high, Zeichen wird verworfen
+        uart_err_noise   : Startbit bei der ersten Abtastung nicht mehr
+                           vorhanden (nur USI-Serial)
+
+      uart_lineassembly 1 : uart_linepoll() setzt eingehende Zeichen zu
+                            einer Zeile zusammen und ruft bei Eingang von
+                            '\r' die Funktion uart_linecallback auf
+     ----------------------------------------------------------------------- */
+
+  #ifndef uart_rxfifo_size                // im Makefile: DEFS = -Duart_rxfifo_size=32
+    #define uart_rxfifo_size    16
+  #endif
+
+  #ifndef uart_lineassembly               // im Makefile: DEFS = -Duart_lineassembly=1
+    #define uart_lineassembly   0
+  #endif
+  #ifndef uart_linebuf_size
+    #define uart_linebuf_size   24          // max. Zeilenlaenge inkl. abschliessender 0
+  #endif
+
+  extern volatile uint8_t uart_err_overrun;
+  extern volatile uint8_t uart_err_frame;
+  extern volatile uint8_t uart_err_noise;
+
+  #if (uart_lineassembly == 1)
+    extern void (*uart_linecallback)(char *line, uint8_t len);
+  #endif
+
+
   /* -----------------------------------------------------------------------
                                   Prototypen
      ----------------------------------------------------------------------- */
@@ -84,6 +127,13 @@
   void uart_putchar(uint8_t ch);
   uint8_t uart_ischar( void );
   uint8_t uart_getchar( void );
+  uint8_t uart_read(uint8_t *buf, uint8_t len, uint16_t timeout_ms);
+
+  #if (uart_lineassembly == 1)
+
+    void uart_linepoll(void);
+
+  #endif
 
   #if (readint_enable == 1)
 
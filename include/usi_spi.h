@@ -0,0 +1,148 @@
+/* -----------------------------------------------------
+                        usi_spi.h
+
+    Header fuer SPI-Master (Mode 0, nur Senden mit
+    optionalem Lesen) ueber das USI des ATtiny, gemein-
+    sam genutzt von den Displaytreibern (tftdisplay,
+    n5110, oled1306_spi)
+
+    Der Takt wird nicht in einer Schleife mit Abfrage
+    von USIOIF erzeugt, sondern durch 16 aufeinander-
+    folgende Schreibzugriffe auf USICR ("ausgerollt",
+    2 Taktzyklen je Bit, SCK = F_CPU / 2). Mit spi_maxclk
+    werden bei hoeherem F_CPU Wartetakte eingefuegt.
+
+    Anschluesse (bei hardware_spi 1 fest vorgegeben):
+
+       PA5 (DO)   : MOSI
+       PA6 (DI)   : MISO
+       PA4 (USCK) : SCK
+
+    Der Chipselect-Anschluss wird vom jeweiligen Treiber
+    bedient
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_usi_spi
+  #define in_usi_spi
+
+  #include <avr/io.h>
+  #include <avr/pgmspace.h>
+
+  #include "avr_gpio.h"
+
+  #define hardware_spi            1        // 0 : SPI ueber Bitbanging realisieren, hier
+                                           //     duerfen dann die Anschlusspins veraendert werden
+                                           // 1 : SPI ueber USI-Hardware realisieren,
+                                           //     Anschlusspins fuer Mosi, Miso, Clk duerfen
+                                           //     NICHT veraendert werden
+
+  #define spi_mosi_init()         PA5_output_init()
+  #define spi_miso_init()         PA6_input_init()
+  #define spi_sck_init()          PA4_output_init()
+
+  #define spi_mosi_set()          PA5_set()
+  #define spi_mosi_clr()          PA5_clr()
+  #define spi_sck_set()           PA4_set()
+  #define spi_sck_clr()           PA4_clr()
+  #define spi_is_miso()           is_PA6()
+
+  // max. SCK-Frequenz des Displays in Hz, 0 = keine Grenze (SCK = F_CPU / 2).
+  // PCD8544 (n5110): 4 MHz, im Makefile: DEFS = -Dspi_maxclk=4000000
+  #ifndef spi_maxclk
+    #define spi_maxclk            0
+  #endif
+
+  #if (spi_maxclk > 0) && ((F_CPU) / 2 > (spi_maxclk))
+    // Wartetakte nach jeder Flanke: SCK = F_CPU / (2 * (1 + SPI_HALF_DEL))
+    #define SPI_HALF_DEL          ( ((F_CPU) + 2ul * (spi_maxclk) - 1) / (2ul * (spi_maxclk)) - 1 )
+    #define spi_half()            __builtin_avr_delay_cycles(SPI_HALF_DEL)
+  #else
+    #define spi_half()
+  #endif
+
+  #if (hardware_spi == 1)
+
+    /* -------------------------------------------------------
+       USI_SPI_DECL / spi_fast
+
+       fuer Schleifen in den Treibern: USI_SPI_DECL legt die
+       beiden USICR-Werte in lokalen Variablen (Registern) ab,
+       spi_fast(b) sendet damit ein Byte ohne Funktionsaufruf
+
+         void fill(uint8_t b, uint8_t anz)
+         {
+           USI_SPI_DECL
+           while (anz--) spi_fast(b);
+         }
+       ------------------------------------------------------- */
+    #define USI_SPI_DECL          uint8_t usi_clo= (1 << USIWM0) | (1 << USITC); \
+                                  uint8_t usi_chi= (1 << USIWM0) | (1 << USITC) | (1 << USICLK);
+    #define spi_fast(b)           usi_spi_byte(b, usi_clo, usi_chi)
+
+    static inline void usi_spi_byte(uint8_t data, uint8_t clo, uint8_t chi)
+    {
+      USIDR = data;
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+      USICR = clo; spi_half(); USICR = chi; spi_half();
+    }
+
+  #else
+
+    #define USI_SPI_DECL
+    #define spi_fast(b)           spi_out(b)
+
+  #endif
+
+  // --------------------------------------------------------------------
+  //                      Prototypenbeschreibung
+  // --------------------------------------------------------------------
+
+  /* -------------------------------------------------------
+
+      ############### spi_init(void) ##############
+
+      konfiguriert MOSI, SCK als Ausgang und MISO als
+      Eingang (mit Pull-Up)
+
+
+      ############### spi_out(uint8_t data) ##############
+
+      sendet ein Byte
+
+      Rueckgabe: gleichzeitig empfangenes Byte
+
+
+      ############### spi_outbuf(const uint8_t *buf, uint16_t anz) ##
+
+      sendet anz Bytes aus dem RAM
+
+
+      ############### spi_outbuf_P(const uint8_t *buf, uint16_t anz) ##
+
+      sendet anz Bytes aus dem Flash
+
+
+      ############### spi_fill16(uint16_t value, uint16_t anz) ####
+
+      sendet anz mal einen 16-Bit Wert (MSB zuerst), bspw.
+      fuer RGB565 Farbflaechen
+     ------------------------------------------------------- */
+
+  void spi_init(void);
+  uint8_t spi_out(uint8_t data);
+  void spi_outbuf(const uint8_t *buf, uint16_t anz);
+  void spi_outbuf_P(const uint8_t *buf, uint16_t anz);
+  void spi_fill16(uint16_t value, uint16_t anz);
+
+#endif
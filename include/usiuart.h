@@ -6,6 +6,7 @@
 
      Verwendet USI-Overflow, Pinchange0 und Timer0 Compare Match
      Interrupt
+     (im Vollduplex-Betrieb zusaetzlich Timer1 Compare Match A)
 
 
      MCU   : ATtiny44
@@ -69,21 +70,89 @@ PCINT6 - OC1A - SDA - MOSI - DI - ADC6 - PA6  | 7   y   8 |  PA5 - ADC5 - DO - M
       Moegliche Baudratenkombinationen
 
       F_CPU 1000000   BAUDRATE 1200, 2400
-      F_CPU 8000000   BAUDRATE 9600, 19200
-      F_CPU 12000000  BAUDRATE 9600, 19200,
-      F_CPU 16000000  BAUDRATE 9600, 19200, 38400
+      F_CPU 8000000   BAUDRATE 4800, 9600, 19200, 38400, 57600, 115200
+      F_CPU 12000000  BAUDRATE 9600, 19200, 38400, 57600, 115200
+      F_CPU 16000000  BAUDRATE 9600, 19200, 38400, 57600, 115200
+
+      Ab 57600 Baud (8 MHz) wird der Empfang automatisch ueber den Pinchange-
+      Interrupt direkt gestartet (Schnellstart, siehe usiuart.c). Kombina-
+      tionen, deren Bitzeit um mehr als BAUD_TOLERANCE Promille abweicht,
+      erzeugen einen Fehler beim Uebersetzen.
      ----------------------------------------------------------------------- */
 
-  #define BAUDRATE              19200
+  #ifndef BAUDRATE                              // im Makefile: DEFS = -DBAUDRATE=4800
+    #define BAUDRATE            19200
+  #endif
   #define STOPBITS              1
 
+  #define BAUD_TOLERANCE        20              // max. Abweichung der Bitzeit in Promille
+
+
+  /* -----------------------------------------------------------------------
+      automatische Baudratenerkennung
+
+      autobaud_enable 1 : uart_autobaud() wartet auf das Synchronisations-
+                          zeichen 0x55 ('U') und stellt die Bitzeit auf die
+                          gemessene Baudrate ein (z.B. bei unkalibriertem
+                          internen RC-Oszillator). BAUDRATE ist dann nur der
+                          Startwert.
+     ----------------------------------------------------------------------- */
+
+  #ifndef autobaud_enable                       // im Makefile: DEFS = -Dautobaud_enable=1
+    #define autobaud_enable     0
+  #endif
+
+
+  /* -----------------------------------------------------------------------
+      Sendepuffer (Zweierpotenz). uart_putchar / uart_write legen die
+      Zeichen im Puffer ab, gesendet wird im Hintergrund aus dem USI-
+      Overflow Interrupt heraus. Waehrend gesendet wird, ist der Empfang
+      gesperrt (die USI arbeitet halbduplex).
+     ----------------------------------------------------------------------- */
+
+  #ifndef uart_txfifo_size                      // im Makefile: DEFS = -Duart_txfifo_size=32
+    #define uart_txfifo_size    16
+  #endif
+
+  extern volatile uint16_t uart_txoverflow;     // Anzahl von uart_write verworfener Zeichen
+
+
+  /* -----------------------------------------------------------------------
+      Vollduplex-Betrieb
+
+      uart_fullduplex 0 : Senden und Empfangen ueber die USI (halbduplex)
+      uart_fullduplex 1 : Empfangen weiterhin ueber USI, Pinchange und
+                          Timer0. Gesendet wird mit Timer1 (CTC) ueber den
+                          Compare-Ausgang OC1B, der ebenfalls auf PA5 (DO)
+                          liegt. Die Bitflanken werden von der Timerhardware
+                          gesetzt, der Interrupt bestimmt nur den Pegel des
+                          naechsten Bits. Senden und Empfangen laufen
+                          gleichzeitig.
+
+      Belegt im Vollduplex-Betrieb zusaetzlich Timer1 und TIM1_COMPA_vect,
+      kann somit nicht zusammen mit i2c_async oder den Timer1-Multiplex-
+      Treibern verwendet werden.
+     ----------------------------------------------------------------------- */
+
+  #ifndef uart_fullduplex                       // im Makefile: DEFS = -Duart_fullduplex=1
+    #define uart_fullduplex     0
+  #endif
+
 
   /* ------------------------------------------------------------------
                                    PROTOTYPEN
      ------------------------------------------------------------------ */
   void uart_init();
   void uart_putchar(char c);
+  uint8_t uart_write(const uint8_t *buf, uint8_t len);
+  void uart_txflush(void);
   uint8_t uart_getchar(void);
   uint8_t uart_ischar(void);
 
+  #if (autobaud_enable == 1)
+
+    uint16_t uart_autobaud(void);
+
+  #endif
+
 #endif
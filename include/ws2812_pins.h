@@ -19,9 +19,12 @@
   #define in_ws2812_pins
 
 
-  // Anschlusspin der WS2812 LED-Kette
-  #define ws_port      PORTB
-  #define ws_ddr       DDRB
-  #define ws_portpin   1
+  // Anschlusspin der WS2812 LED-Kette, im Makefile ueberschreibbar:
+  // DEFS = -Dws_port=PORTA -Dws_ddr=DDRA -Dws_portpin=7
+  #ifndef ws_port
+    #define ws_port      PORTB
+    #define ws_ddr       DDRB
+    #define ws_portpin   1
+  #endif
 
 #endif
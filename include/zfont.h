@@ -0,0 +1,66 @@
+/* -----------------------------------------------------
+                        zfont.h
+
+    Header fuer komprimierte Zeichensaetze und Bitmaps
+    (erzeugt mit fontcomp, siehe fontcomp/readme.txt)
+
+    Die Daten werden in Bloecken zu 8 Bytes abgelegt
+    (bei den 8x8 Zeichensaetzen ein Zeichen je Block).
+    Jeder Block beginnt mit einem Maskenbyte, danach
+    folgen die Literale:
+
+       Bit k der Maske = 1 : Byte wie das vorherige
+       Bit k der Maske = 0 : naechstes Literal
+
+    Die Bytes eines Blocks stehen in der Reihenfolge
+    7, 0, 1 .. 6 (Bit 0 der Maske gehoert zu Byte 7),
+    das "vorherige" Byte vor Byte 7 ist 0x00. Die bei
+    den Zeichensaetzen meist leere Zeile 7 und die dann
+    folgenden leeren Zeilen am Anfang kosten so nur ein
+    Bit. Fuer jeden 8. Block ist der Beginn in den Daten
+    in einem Index abgelegt.
+
+    Der Decoder arbeitet ohne Zeichenpuffer im RAM, er
+    merkt sich nur den Beginn des zuletzt gelesenen
+    Blocks (6 Byte RAM).
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#ifndef in_zfont
+  #define in_zfont
+
+  #include <stdint.h>
+  #include <avr/pgmspace.h>
+
+  // Beschreibung eines komprimierten Zeichensatzes (liegt im Flash)
+  typedef struct
+  {
+    const uint16_t  *index;                   // Beginn jedes 8. Blocks in data
+    const uint8_t   *data;                    // Maskenbytes und Literale
+  } zfont_t;
+
+  // --------------------------------------------------------------------
+  //                      Prototypenbeschreibung
+  // --------------------------------------------------------------------
+
+  /* -------------------------------------------------------
+
+      ############### zfont_getbyte(const zfont_t *font, uint8_t n, uint8_t i)
+
+      liefert das Byte i (0..7) des Blocks n, entspricht
+
+          pgm_read_byte(&(font[n][i]))
+
+      bei einem unkomprimierten Zeichensatz mit 8 Bytes
+      je Zeichen (n = Zeichen - erstes Zeichen). Ist ein
+      Zeichen nicht 8 Bytes gross, ist n = pos / 8 und
+      i = pos % 8 fuer das Byte an Position pos.
+     ------------------------------------------------------- */
+
+  uint8_t zfont_getbyte(const zfont_t *font, uint8_t n, uint8_t i);
+
+#endif
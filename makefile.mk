@@ -22,6 +22,27 @@
 #        Die Dateien serial_demo.c und readint.c werden zu Objektdateien
 #        uebersetzt und dem Gesamtprogramm hinzugelinkt
 #
+#        Module aus ../src werden nicht mehr neben der Quelldatei, sondern
+#        im gemeinsamen Verzeichnis
+#
+#           ../lib/<MCU>_<FREQ>_<Kennung>/
+#
+#        abgelegt. Die Kennung ist eine Pruefsumme ueber alle Compiler-
+#        optionen und Defines, Projekte mit gleichen Einstellungen verwenden
+#        damit dieselben Objektdateien (die nur einmal uebersetzt werden).
+#        Abhaengigkeiten von Headerdateien werden mit -MMD erfasst.
+#
+#
+#   DEFS
+#        projektspezifische Einstellungen der Softwaremodule als Defines,
+#        bspw.
+#
+#        DEFS    = -Dboard_version=2 -DBAUDRATE=4800
+#
+#        Headerdateien aus ../include werden NICHT in das Projektverzeich-
+#        nis kopiert und dort geaendert, veraenderbare Einstellungen sind
+#        dort mit #ifndef umschlossen.
+#
 #
 #   PRINT_FL / SCAN_FL
 #        = 1 wenn Unterstuetzung fuer Gleitkommazahlen mittels printf / scanf
@@ -29,6 +50,57 @@
 #        = 0 ohne unterstuetzung
 #
 #
+#   I2C_USI
+#        = 1 i2c_sw.c verwendet das USI-Interface im Two-Wire Modus
+#            (Fast-Mode 400 kHz, SDA = PA6, SCL = PA4)
+#        = 0 oder nicht angegeben: Bitbanging
+#
+#
+#   I2C_BUS_HZ
+#        Taktfrequenz des I2C-Busses in Hz (bspw. 100000, 400000, 1000000).
+#        Ohne Angabe 100 kHz (Bitbanging) bzw. 400 kHz (USI)
+#
+#
+#   I2C_STRETCH_US
+#        max. Wartezeit in us, die ein Slave SCL low halten darf
+#        (Clockstretching). Ohne Angabe 2000 us
+#
+#
+#   PROFILE
+#        Optimierungsprofil (ohne Angabe: -Os, jedes Modul einzeln wie bisher)
+#        = size     : -Os mit Link-Time-Optimization (-flto), unbenutzte
+#                     Funktionen und Daten werden entfernt (-ffunction-
+#                     sections -fdata-sections -Wl,--gc-sections), -mrelax
+#        = speed    : dto. mit -O2
+#        = balanced : wie size, die in HOT_SRCS angegebenen Module werden
+#                     mit -O2 uebersetzt
+#
+#
+#   RAM_BUDGET
+#        RAM in Bytes, das .data, .bss und der Stack zusammen hoechstens
+#        belegen duerfen (ATtiny44: 256). Bei Angabe werden alle Module mit
+#        -fstack-usage -fcallgraph-info=su uebersetzt (avr-gcc ab Version
+#        10), nach dem Linken ermittelt ../stackcheck aus dem Aufrufgraphen
+#        den groessten Stackbedarf von main und den Interruptroutinen.
+#        Wird das Budget ueberschritten, bricht make mit einem Fehler ab.
+#        (zur Laufzeit: src/stackmon.c)
+#
+#
+#   STACK_TARGETS
+#        bei RAM_BUDGET: Funktionen, die ueber Funktionszeiger aufgerufen
+#        werden (stackcheck -i). Ohne Angabe bricht make ab, wenn das
+#        Programm einen Funktionszeiger aufruft, bspw. mit my_printf.c:
+#
+#        STACK_TARGETS = my_putchar pf_ramsink
+#
+#
+#   HOT_SRCS
+#        Module (wie bei SRCS als .o angegeben), die bei PROFILE = balanced
+#        auf Geschwindigkeit optimiert werden, bspw.
+#
+#        HOT_SRCS  = ../src/usi_spi.o
+#
+#
 #   INC_DIR
 #        Suchverzeichnis, in dem zusaetzliche Programmmodule liegen
 #
@@ -56,8 +128,18 @@
 #        make clean         : loescht alle erstellten Dateien (sinnvoll,
 #                             wenn Softwaremodule / Bibliotheken veraendert
 #                             wurden)
+#        make build         : wie make, jedoch ohne vorheriges Loeschen (fuer
+#                             den Gesamtbuild aller Projekte, siehe ../Makefile)
 #        make size          : zeigt die Groesse der erstellten Hex-Datei an
+#        make sizereport    : listet Flash- und RAM-Bedarf je Symbol (Funktion,
+#                             Variable, Konstante), groesste zuerst
 #        make flash         : flasht den Zielcontroller
+#        make libclean      : loescht die gemeinsamen Objektdateien in ../lib
+#        make host          : uebersetzt das Programm mit gcc fuer den PC
+#                             gegen die Registerebene in ../host (siehe
+#                             host/host_hal.h), Ergebnis: $(PROJECT)_host.
+#                             Nicht moeglich fuer Projekte mit Modulen in
+#                             Assembler (.S): bmp180, ws2812
 #
 #
 #   August 2017,  R. Seelig
@@ -67,7 +149,9 @@
 CC        = avr-gcc
 LD        = avr-gcc
 OBJCOPY   = avr-objcopy
+OBJDUMP   = avr-objdump
 SIZE      = avr-size
+NM        = avr-nm
 
 ifeq ($(INC_DIR),)
 	INC_DIR   := -I./ -I../include
@@ -78,16 +162,76 @@ PROGPORT := /dev/ttyUSB0
 endif
 
 
-OBJECTS    = $(PROJECT).o $(SRCS)
+HOST_CC    = gcc
+HOST_DIR   = ../host
+HOST_SRCS  = $(PROJECT).c $(wildcard $(SRCS:.o=.c)) $(HOST_DIR)/host_hal.c
+HOST_ASM   = $(wildcard $(SRCS:.o=.S))
+HOST_FLAGS = -std=gnu99 -O1 -g -I$(HOST_DIR)
 
 CPU        = -mmcu=$(MCU)
 
+OPT_FLAGS  = -Os
+HOT_FLAGS  =
+
+ifeq ($(PROFILE), size)
+  OPT_FLAGS = -Os -flto -ffunction-sections -fdata-sections -mrelax
+endif
+
+ifeq ($(PROFILE), speed)
+  OPT_FLAGS = -O2 -flto -ffunction-sections -fdata-sections -mrelax
+endif
+
+ifeq ($(PROFILE), balanced)
+  OPT_FLAGS = -Os -flto -ffunction-sections -fdata-sections -mrelax
+  HOT_FLAGS = -O2
+endif
+
 #CC_FLAGS   = -Os $(CPU) -std=c99
-CC_FLAGS   = -Os $(CPU)
+CC_FLAGS   = $(OPT_FLAGS) $(CPU)
 
 CC_SYMBOLS = -DF_CPU=$(FREQ)
+
+ifeq ($(I2C_USI), 1)
+  CC_SYMBOLS += -DI2C_USI_TWI
+endif
+
+ifneq ($(I2C_BUS_HZ),)
+  CC_SYMBOLS += -DI2C_BUS_HZ=$(I2C_BUS_HZ)
+endif
+
+ifneq ($(I2C_STRETCH_US),)
+  CC_SYMBOLS += -DI2C_STRETCH_US=$(I2C_STRETCH_US)
+endif
+
+CC_SYMBOLS += $(DEFS)
+
+# statische Stackanalyse, bei LTO zusaetzlich normaler Objektcode (die
+# Analyse bezieht sich dann auf den Code der einzelnen Module)
+STACKCHECK =
+ifneq ($(RAM_BUDGET),)
+  CC_FLAGS  += -fstack-usage -fcallgraph-info=su
+  ifneq ($(PROFILE),)
+    CC_FLAGS += -ffat-lto-objects
+  endif
+  STACKCHECK = ../stackcheck/stackcheck
+endif
+
+# gemeinsame Objektdateien der Module aus ../src
+LIB_KEY   := $(shell echo "$(CC_FLAGS) $(CC_SYMBOLS) $(HOT_SRCS) $(HOT_FLAGS)" | cksum | cut -d' ' -f1)
+LIB_DIR    = ../lib/$(MCU)_$(FREQ)_$(LIB_KEY)
+
+LIB_OBJS   = $(patsubst ../src/%,$(LIB_DIR)/%,$(filter ../src/%,$(SRCS)))
+PRJ_OBJS   = $(filter-out ../src/%,$(SRCS))
+OBJECTS    = $(PROJECT).o $(PRJ_OBJS) $(LIB_OBJS)
+
+DEP_FLAGS  = -MMD -MP
 LD_FLAGS   = $(CPU)
 
+# bei LTO erzeugt der Linker den Code, er benoetigt daher die Optimierungsoptionen
+ifneq ($(PROFILE),)
+  LD_FLAGS += $(OPT_FLAGS) -Wl,--gc-sections
+endif
+
 ifeq ($(PRINT_FL), 1)
   LD_FLAGS += -Wl,-u,vfprintf
 endif
@@ -111,25 +255,69 @@ ifeq ($(MATH), 1)
 endif
 
 
-.PHONY: all clean size compile flash
+.PHONY: all build clean libclean size sizereport compile flash host
 
 all: clean $(PROJECT).hex size
 
+build: $(PROJECT).hex
+
 compile:
 	$(CC) $(CC_FLAGS) $(CC_SYMBOLS) $(INC_DIR) -o $(PROJECT).o $(PROJECT).c
 
 clean:
 	rm -f $(PROJECT).o $(PROJECT).elf $(PROJECT).hex $(PROJECT).map
-	rm -f $(SRCS)
+	rm -f $(SRCS) $(SRCS:.o=.d) $(PROJECT).d
+	rm -f $(PROJECT).su $(PROJECT).ci $(SRCS:.o=.su) $(SRCS:.o=.ci)
+	rm -f $(PROJECT)_host
+
+libclean:
+	rm -rf ../lib
+
+host:
+ifneq ($(HOST_ASM),)
+	@echo "make host: $(PROJECT) verwendet Module in Assembler ($(HOST_ASM)),"
+	@echo "           die nicht fuer den PC uebersetzt werden koennen"
+	@exit 1
+endif
+	$(HOST_CC) $(HOST_FLAGS) $(CC_SYMBOLS) $(INC_DIR) $(HOST_SRCS) -o $(PROJECT)_host
+
+$(patsubst ../src/%,$(LIB_DIR)/%,$(HOT_SRCS)): CC_FLAGS += $(HOT_FLAGS)
 
 .c.o:
-	$(CC) $< -c -o $@ $(CC_FLAGS) $(CC_SYMBOLS) $(INC_DIR)
+	$(CC) $< -c -o $@ $(DEP_FLAGS) $(CC_FLAGS) $(CC_SYMBOLS) $(INC_DIR)
 
 .S.o:
-	$(CC) $< -c -o $@ $(CC_FLAGS) $(CC_SYMBOLS) $(INC_DIR)
+	$(CC) $< -c -o $@ $(DEP_FLAGS) $(CC_FLAGS) $(CC_SYMBOLS) $(INC_DIR)
 
-$(PROJECT).elf: $(OBJECTS)
+# mehrere Projekte koennen (make -j) dieselbe Objektdatei gleichzeitig
+# erzeugen, daher erst in einem temporaeren Verzeichnis erzeugen (dort
+# entstehen auch .d, .su und .ci), dann umbenennen. Die Objektdatei
+# zuletzt, sie zeigt an, dass alle Dateien vorhanden sind
+LIB_CC = @t=$(@D)/tmp.$$$$; mkdir -p $$t &&                                  \
+	$(CC) $< -c -o $$t/$(@F) $(DEP_FLAGS) -MT $@                               \
+	  $(CC_FLAGS) $(CC_SYMBOLS) $(INC_DIR) &&                                  \
+	mv -f $$t/$(@F) $@.$$$$ && mv -f $$t/* $(@D)/ && rmdir $$t &&              \
+	mv -f $@.$$$$ $@ || { rm -rf $$t $@.$$$$; exit 1; }
+
+$(LIB_DIR)/%.o: ../src/%.c
+	@echo "  CC  $< -> $@"
+	$(LIB_CC)
+
+$(LIB_DIR)/%.o: ../src/%.S
+	@echo "  AS  $< -> $@"
+	$(LIB_CC)
+
+-include $(OBJECTS:.o=.d)
+
+$(PROJECT).elf: $(OBJECTS) | $(STACKCHECK)
 	$(LD) $(LD_FLAGS) $^$(LD_SYS_LIB) -o $@
+ifneq ($(RAM_BUDGET),)
+	@$(STACKCHECK) -r $(RAM_BUDGET) $(addprefix -i ,$(STACK_TARGETS)) -s `$(SIZE) $@ | awk 'NR == 2 { print $$2 + $$3 }'` \
+	  $(wildcard $(OBJECTS:.o=.ci)) || { rm -f $@; exit 1; }
+
+$(STACKCHECK): ../stackcheck/stackcheck.c
+	$(HOST_CC) -Os $< -o $@.$$$$ && mv -f $@.$$$$ $@
+endif
 
 $(PROJECT).hex: $(PROJECT).elf
 	@$(OBJCOPY) -j .text -j .data -O ihex $< $@
@@ -140,6 +328,17 @@ $(PROJECT).lst: $(PROJECT).elf
 size: $(PROJECT).elf
 	$(SIZE) -C $(PROJECT).elf --mcu=$(MCU) 1>&2
 
+# Typ t/T: Code und Konstanten (Flash), d/D: initialisierte Variable (Flash
+# und RAM), b/B: Variable (RAM)
+sizereport: $(PROJECT).elf
+	@$(NM) -S --size-sort -r -t d $(PROJECT).elf | awk '                       \
+	  NF == 4 && $$3 ~ /[tT]/ { fl += $$2; printf "  %6d  %6s  %s\n", $$2, "", $$4 } \
+	  NF == 4 && $$3 ~ /[dD]/ { fl += $$2; ram += $$2;                               \
+	                            printf "  %6d  %6d  %s\n", $$2, $$2, $$4 }          \
+	  NF == 4 && $$3 ~ /[bB]/ { ram += $$2; printf "  %6s  %6d  %s\n", "", $$2, $$4 } \
+	  BEGIN { printf "   Flash     RAM  Symbol\n" }                                  \
+	  END   { printf "  ------  ------\n  %6d  %6d  Summe (ohne Vektoren, Startup)\n", fl, ram }'
+
 flash:
 ifeq ($(PROGRAMMER), usbtiny)
 	avrdude -c $(PROGRAMMER) -p $(MCU) $(DUDEOPTS) -V -U flash:w:$(PROJECT).hex
@@ -0,0 +1,232 @@
+/* -------------------------------------------------
+     aafont10d.c
+
+     Graustufen-Zeichensatz fuer lcd_putchar_aa
+     (tftdisplay.c, tft_aafont = 2), erzeugt mit
+     fontcomp -n aafont10d -a 2 -x 10 -y 14 -c 45,58 ../src/font8x8.c
+
+     Zeichen  : 45..58, 10 x 14 Pixel
+     Groesse  : 588 Bytes
+   ------------------------------------------------- */
+
+#include "tftdisplay.h"
+
+// nur mit passendem tft_aafont (sonst fehlt aafont10d beim Linken)
+#if (tft_aafont == 2)
+
+static const uint8_t PROGMEM aafont10d_bitmap[] = {
+  // Ascii 45 = '-'
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x2a,0xaa,0x80,
+  0x2f,0xff,0x80,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  // Ascii 46 = '.'
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x50,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x00,0x50,0x00,
+  0x00,0x00,0x00,
+  // Ascii 47 = '/'
+  0x00,0x0b,0x80,
+  0x00,0x1b,0x80,
+  0x00,0x3e,0x00,
+  0x00,0x79,0x00,
+  0x01,0xf4,0x00,
+  0x06,0xd0,0x00,
+  0x0b,0xc0,0x00,
+  0x2e,0x00,0x00,
+  0x6e,0x00,0x00,
+  0xf8,0x00,0x00,
+  0xe4,0x00,0x00,
+  0xd0,0x00,0x00,
+  0x40,0x00,0x00,
+  0x00,0x00,0x00,
+  // Ascii 48 = '0'
+  0x2f,0xfe,0x00,
+  0x6e,0xae,0x40,
+  0xf8,0x0b,0x80,
+  0xf8,0x1f,0x80,
+  0xf8,0x3f,0x80,
+  0xf9,0x9b,0x80,
+  0xf9,0xcb,0x80,
+  0xfe,0x0b,0x80,
+  0xfe,0x0b,0x80,
+  0xf8,0x0b,0x80,
+  0xba,0xae,0x40,
+  0x2f,0xfe,0x00,
+  0x15,0x54,0x00,
+  0x00,0x00,0x00,
+  // Ascii 49 = '1'
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x0b,0xf4,0x00,
+  0x06,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x00,0x50,0x00,
+  0x00,0x00,0x00,
+  // Ascii 50 = '2'
+  0x0b,0xfe,0x00,
+  0x1b,0xae,0x40,
+  0x2e,0x0b,0x80,
+  0x19,0x0b,0x80,
+  0x00,0x0b,0x80,
+  0x00,0x2e,0x40,
+  0x00,0x3e,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xe4,0x00,
+  0x0b,0xc0,0x00,
+  0x1b,0xea,0x40,
+  0x2f,0xff,0x80,
+  0x15,0x55,0x40,
+  0x00,0x00,0x00,
+  // Ascii 51 = '3'
+  0x0b,0xfe,0x00,
+  0x1b,0xae,0x40,
+  0x2e,0x0b,0x80,
+  0x19,0x0b,0x80,
+  0x00,0x0b,0x80,
+  0x01,0xae,0x40,
+  0x01,0xfe,0x00,
+  0x00,0x0b,0x80,
+  0x15,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x1b,0xae,0x40,
+  0x0b,0xfe,0x00,
+  0x01,0x54,0x00,
+  0x00,0x00,0x00,
+  // Ascii 52 = '4'
+  0x01,0xfe,0x00,
+  0x01,0xfe,0x00,
+  0x0b,0xfe,0x00,
+  0x1b,0xbe,0x00,
+  0x2e,0x3e,0x00,
+  0xb9,0x3e,0x00,
+  0xf8,0x3e,0x00,
+  0xff,0xff,0x80,
+  0xaa,0xbf,0x80,
+  0x00,0x3e,0x00,
+  0x00,0x3e,0x00,
+  0x00,0x3e,0x00,
+  0x00,0x14,0x00,
+  0x00,0x00,0x00,
+  // Ascii 53 = '5'
+  0x2f,0xff,0x80,
+  0x2f,0xaa,0x80,
+  0x2e,0x00,0x00,
+  0x2f,0x55,0x00,
+  0x2f,0xfe,0x00,
+  0x15,0x5b,0x80,
+  0x00,0x0b,0x80,
+  0x00,0x0b,0x80,
+  0x15,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x1b,0xae,0x40,
+  0x0b,0xfe,0x00,
+  0x01,0x54,0x00,
+  0x00,0x00,0x00,
+  // Ascii 54 = '6'
+  0x0b,0xfe,0x00,
+  0x1b,0xae,0x40,
+  0x2e,0x0b,0x80,
+  0x2e,0x06,0x40,
+  0x2e,0x00,0x00,
+  0x2f,0xa9,0x00,
+  0x2f,0xfe,0x00,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x1b,0xae,0x40,
+  0x0b,0xfe,0x00,
+  0x01,0x54,0x00,
+  0x00,0x00,0x00,
+  // Ascii 55 = '7'
+  0x2f,0xff,0x80,
+  0x2a,0xaf,0x80,
+  0x00,0x0b,0x80,
+  0x00,0x0b,0x80,
+  0x00,0x0b,0x80,
+  0x00,0x2e,0x40,
+  0x00,0x3e,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x00,0x50,0x00,
+  0x00,0x00,0x00,
+  // Ascii 56 = '8'
+  0x0b,0xfe,0x00,
+  0x1b,0xae,0x40,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x1b,0xae,0x40,
+  0x0b,0xfe,0x00,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x1b,0xae,0x40,
+  0x0b,0xfe,0x00,
+  0x01,0x54,0x00,
+  0x00,0x00,0x00,
+  // Ascii 57 = '9'
+  0x0b,0xfe,0x00,
+  0x1b,0xae,0x40,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x2e,0x0b,0x80,
+  0x1b,0xaf,0x80,
+  0x0b,0xff,0x80,
+  0x00,0x3e,0x00,
+  0x00,0x79,0x00,
+  0x01,0xf4,0x00,
+  0x06,0xe0,0x00,
+  0x0b,0xc0,0x00,
+  0x01,0x40,0x00,
+  0x00,0x00,0x00,
+  // Ascii 58 = ':'
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x00,0x00,
+  0x00,0x50,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x00,0x00,0x00,
+  0x00,0x50,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x01,0xf4,0x00,
+  0x00,0x50,0x00,
+  0x00,0x00,0x00,
+};
+
+const aafont_t PROGMEM aafont10d = { 10, 14, 45, 58, aafont10d_bitmap };
+
+#endif
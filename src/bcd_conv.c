@@ -0,0 +1,95 @@
+/* -------------------------------------------------------
+                        bcd_conv.c
+
+     Divisionsfreie Umwandlung von Binaerwerten in Dezimal-
+     ziffern (BCD)
+
+     Je Ziffer wird die passende Zehnerpotenz so oft sub-
+     trahiert, wie es moeglich ist (max. 9 Subtraktionen).
+     Auf dem AVR ohne Multiplizierer ist das schneller als
+     Double-Dabble (eine Schiebe- und Korrekturrunde je
+     Bit) oder Multiplikation mit dem Kehrwert.
+
+     MCU   :  alle AVR
+
+     17.10.2026   agent
+   ------------------------------------------------------ */
+
+#include "bcd_conv.h"
+
+static const uint16_t pow10_16[4] PROGMEM =
+  { 10000, 1000, 100, 10 };
+
+static const uint32_t pow10_32[6] PROGMEM =
+  { 1000000000, 100000000, 10000000, 1000000, 100000, 10000 };
+
+
+/* -------------------------------------------------------
+                        bcd_8bit
+
+     Rueckgabe: Zehner im oberen, Einer im unteren Nibble
+   ------------------------------------------------------- */
+uint8_t bcd_8bit(uint8_t value)
+{
+  uint8_t z;
+
+  z= 0;
+  while (value >= 10)
+  {
+    value -= 10;
+    z++;
+  }
+  return (z << 4) | value;
+}
+
+/* -------------------------------------------------------
+                        bcd_dig16
+
+     zerlegt value in anz Dezimalziffern (hoechstwertige
+     Ziffer in dig[0]). Die Zehnerpotenzen oberhalb von
+     anz werden ebenfalls abgezogen, aber nicht gespeichert.
+   ------------------------------------------------------- */
+void bcd_dig16(uint16_t value, uint8_t *dig, uint8_t anz)
+{
+  uint8_t  i, d;
+  uint16_t p;
+
+  for (i= 0; i< 4; i++)                     // 10^4 .. 10^1
+  {
+    p= pgm_read_word(&pow10_16[i]);
+    d= 0;
+    while (value >= p)
+    {
+      value -= p;
+      d++;
+    }
+    if (i >= 5 - anz) *dig++= d;
+  }
+  *dig= value;                              // Einer
+}
+
+/* -------------------------------------------------------
+                        bcd_dig32
+
+     wie bcd_dig16 fuer 32-Bit Werte. Die unteren 4 Stellen
+     werden mit 16-Bit Arithmetik berechnet.
+   ------------------------------------------------------- */
+void bcd_dig32(uint32_t value, uint8_t *dig, uint8_t anz)
+{
+  uint8_t  i, d;
+  uint32_t p;
+
+  for (i= 0; i< 6; i++)                     // 10^9 .. 10^4
+  {
+    p= pgm_read_dword(&pow10_32[i]);
+    d= 0;
+    while (value >= p)
+    {
+      value -= p;
+      d++;
+    }
+    if (i >= 10 - anz) *dig++= d;
+  }
+  if (anz > 4) anz= 4;
+  bcd_dig16(value, dig, anz);               // Rest ist < 10000
+}
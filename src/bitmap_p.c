@@ -0,0 +1,78 @@
+/* -----------------------------------------------------
+                        bitmap_p.c
+
+    Streamingdecoder fuer Bitmaps im Flash (Format
+    siehe bitmap_p.h). Es wird kein Zeilen- oder Bild-
+    puffer benoetigt, der Zustand belegt 8 Byte RAM.
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "bitmap_p.h"
+
+/* -------------------------------------------------------
+                    Decoderzustand
+   ------------------------------------------------------- */
+
+static const uint8_t *bmp_ptr;                        // naechstes Byte im Flash
+static uint8_t bmp_rle;                               // 1 = RLE komprimiert
+static uint8_t bmp_unit;                              // Bytes je Einheit (1 oder 2)
+static uint8_t bmp_cnt;                               // verbleibende Einheiten im Block
+static uint8_t bmp_run;                               // 1 = Wiederholblock
+static uint8_t bmp_idx;                               // Byte innerhalb der Einheit
+static uint8_t bmp_val[2];                            // zu wiederholende Einheit
+
+/* -------------------------------------------------------
+                      bmp_start
+   ------------------------------------------------------- */
+void bmp_start(const uint8_t *img)
+{
+  uint8_t f;
+
+  f= pgm_read_byte(&img[2]);
+  bmp_rle= (f & BMP_RLE) ? 1 : 0;
+  bmp_unit= ((f & 0x7f) == BMP_RGB565) ? 2 : 1;
+  bmp_ptr= img + 3;
+  bmp_cnt= 0;
+  bmp_idx= 0;
+}
+
+/* -------------------------------------------------------
+                      bmp_getbyte
+   ------------------------------------------------------- */
+uint8_t bmp_getbyte(void)
+{
+  uint8_t b;
+
+  if (!bmp_rle) return pgm_read_byte(bmp_ptr++);
+
+  if (!bmp_cnt)                                       // neues Steuerbyte
+  {
+    b= pgm_read_byte(bmp_ptr++);
+    if (b & 0x80)
+    {
+      bmp_run= 1;
+      bmp_cnt= (b & 0x7f) + 2;
+      bmp_val[0]= pgm_read_byte(bmp_ptr++);
+      if (bmp_unit == 2) bmp_val[1]= pgm_read_byte(bmp_ptr++);
+    }
+    else
+    {
+      bmp_run= 0;
+      bmp_cnt= b + 1;
+    }
+  }
+
+  if (bmp_run) b= bmp_val[bmp_idx];
+          else b= pgm_read_byte(bmp_ptr++);
+
+  if (++bmp_idx >= bmp_unit)
+  {
+    bmp_idx= 0;
+    bmp_cnt--;
+  }
+  return b;
+}
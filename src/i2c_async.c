@@ -0,0 +1,401 @@
+/* -----------------------------------------------------
+                        i2c_async.c
+
+    Interruptgesteuerter (nicht blockierender) Software
+    I2C-Bus (Bitbanging im Timer1 Compare-Interrupt)
+
+    Die Eintragsfunktionen legen Start, Datenbytes und
+    Stop in einer Queue ab. Der Timer1 Interrupt arbei-
+    tet die Queue mit einer Zustandsmaschine ab, wobei
+    jeder Aufruf genau eine halbe SCL-Periode erzeugt.
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "i2c_async.h"
+
+#if defined(I2C_USI_TWI)
+  #error "i2c_async.c arbeitet nur mit den Bitbanging-Anschluessen (I2C_USI = 0)"
+#endif
+
+#define I2CQ_EMPTY        0xff
+
+// Timerticks fuer eine halbe Taktperiode
+#define I2CAS_TICKS       ( (F_CPU) / (2ul * (i2c_async_clk)) - 1 )
+
+#if (I2CAS_TICKS > 65535) || (I2CAS_TICKS < 40)
+  #error "i2c_async_clk ist fuer die gegebene Taktfrequenz F_CPU nicht moeglich"
+#endif
+
+// Zustaende der Zustandsmaschine
+enum I2CAS_STATE { ST_IDLE, ST_BITLO, ST_BITHI, ST_ACKLO, ST_ACKHI, ST_ACKRD,
+                   ST_HOLD, ST_RSTART1, ST_RSTART2, ST_STOP1, ST_STOP2 };
+
+/* -------------------------------------------------------
+                       Variable
+   ------------------------------------------------------- */
+
+static uint8_t i2cq_ctl[i2c_async_qsize];             // Eintragstyp
+static uint8_t i2cq_data[i2c_async_qsize];            // Datenbyte / Adresse
+static uint8_t i2cq_rep[i2c_async_qsize];             // Anzahl Wiederholungen - 1
+
+static volatile uint8_t i2cq_head = 0;                // Schreibindex (Hauptprogramm)
+static volatile uint8_t i2cq_tail = 0;                // Leseindex (Interrupt)
+
+static volatile uint8_t i2cas_state = ST_IDLE;
+static uint8_t i2cas_data;                            // aktuelles Byte des Eintrags
+static uint8_t i2cas_rep;
+static uint8_t i2cas_shreg;                           // Schieberegister
+static uint8_t i2cas_bitcnt;
+static uint8_t i2cas_stretch;                         // Anzahl Ticks, die SCL von einem Slave low gehalten wird
+
+volatile uint8_t i2c_async_nackcnt = 0;
+volatile uint8_t i2c_async_errcnt = 0;
+void (*i2c_async_ready)(void) = 0;
+
+
+/* -------------------------------------------------------
+                      i2cq_put
+
+     traegt einen Eintrag in die Queue ein und startet
+     den Interrupt. Ist die Queue voll, wird gewartet.
+   ------------------------------------------------------- */
+static void i2cq_put(uint8_t ctl, uint8_t data, uint8_t rep)
+{
+  uint8_t h, next;
+
+  h= i2cq_head;
+  next= (h + 1) & (i2c_async_qsize - 1);
+  while (next == i2cq_tail);                          // warten bis ein Platz frei ist
+
+  i2cq_ctl[h]= ctl;
+  i2cq_data[h]= data;
+  i2cq_rep[h]= rep;
+  i2cq_head= next;                                    // erst jetzt fuer den Interrupt sichtbar
+
+  TIMSK1 |= 1 << OCIE1A;
+}
+
+/* -------------------------------------------------------
+                      i2cq_fetch
+
+     entnimmt (im Interrupt) den naechsten Eintrag
+
+     Rueckgabe: Eintragstyp oder I2CQ_EMPTY
+   ------------------------------------------------------- */
+static uint8_t i2cq_fetch(void)
+{
+  uint8_t t, ctl;
+
+  t= i2cq_tail;
+  if (t == i2cq_head) return I2CQ_EMPTY;
+
+  ctl= i2cq_ctl[t];
+  i2cas_data= i2cq_data[t];
+  i2cas_rep= i2cq_rep[t];
+  i2cq_tail= (t + 1) & (i2c_async_qsize - 1);
+
+  return ctl;
+}
+
+/* -------------------------------------------------------
+                      i2cas_sdabit
+
+     SCL ist low: naechstes Datenbit auf SDA legen
+   ------------------------------------------------------- */
+static inline void i2cas_sdabit(void)
+{
+  if (i2cas_shreg & 0x80) i2c_sda_hi();
+                     else i2c_sda_lo();
+  i2cas_shreg <<= 1;
+}
+
+/* -------------------------------------------------------
+                      i2cas_loadbyte
+
+     laedt das Byte des aktuellen Eintrags in das Schiebe-
+     register
+   ------------------------------------------------------- */
+static inline void i2cas_loadbyte(void)
+{
+  i2cas_shreg= i2cas_data;
+  i2cas_bitcnt= 8;
+}
+
+/* -------------------------------------------------------
+                      i2cas_next
+
+     SCL ist low, der Bus ist belegt: naechsten Eintrag
+     verarbeiten
+   ------------------------------------------------------- */
+static void i2cas_next(void)
+{
+  switch (i2cq_fetch())
+  {
+    case I2CQ_DATA :
+    {
+      i2cas_loadbyte();
+      i2cas_sdabit();
+      i2cas_state= ST_BITHI;
+      break;
+    }
+    case I2CQ_START :                                 // Repeated Start
+    {
+      i2c_sda_hi();
+      i2cas_state= ST_RSTART1;
+      break;
+    }
+    case I2CQ_STOP :
+    {
+      i2c_sda_lo();
+      i2cas_state= ST_STOP1;
+      break;
+    }
+    default :                                         // Queue leer: Bus halten bis
+    {                                                 // weitere Eintraege folgen
+      i2cas_state= ST_HOLD;
+      TIMSK1 &= ~(1 << OCIE1A);
+      break;
+    }
+  }
+}
+
+/* -------------------------------------------------------
+                      i2cas_sclwait
+
+     Clockstretching: nach einer high-Halbperiode muss SCL
+     auch tatsaechlich high sein. Haelt ein Slave SCL low,
+     wird die Halbperiode um einen Tick verlaengert. Nach
+     i2c_async_stretchmax Ticks wird die Queue verworfen
+     und der Bus freigegeben.
+
+     Rueckgabe: 1 = in diesem Tick nichts weiter tun
+   ------------------------------------------------------- */
+static uint8_t i2cas_sclwait(void)
+{
+  if (i2c_is_scl())
+  {
+    i2cas_stretch= 0;
+    return 0;
+  }
+  i2cas_stretch++;
+  if (i2cas_stretch >= i2c_async_stretchmax)
+  {
+    i2c_async_errcnt++;
+    i2cq_tail= i2cq_head;                             // Queue verwerfen
+    i2c_sda_hi();
+    i2c_scl_hi();
+    i2cas_stretch= 0;
+    i2cas_state= ST_IDLE;
+  }
+  return 1;
+}
+
+/* -------------------------------------------------------
+               Timer1 Compare Match Interruptvektor
+
+     erzeugt bei jedem Aufruf eine halbe Taktperiode
+   ------------------------------------------------------- */
+ISR (TIM1_COMPA_vect)
+{
+  switch (i2cas_state)
+  {
+    case ST_IDLE :                                    // Bus frei (SDA und SCL high)
+    {
+      switch (i2cq_fetch())
+      {
+        case I2CQ_START :
+        {
+          i2c_sda_lo();                               // Startcondition
+          i2cas_loadbyte();
+          i2cas_state= ST_BITLO;
+          break;
+        }
+        case I2CQ_EMPTY :
+        {
+          TIMSK1 &= ~(1 << OCIE1A);
+          if (i2c_async_ready) i2c_async_ready();
+          break;
+        }
+        default : break;                              // Daten / Stop ohne Start: verwerfen
+      }
+      break;
+    }
+
+    case ST_BITLO :
+    {
+      if (i2cas_sclwait()) break;
+      i2c_scl_lo();
+      i2cas_sdabit();
+      i2cas_state= ST_BITHI;
+      break;
+    }
+
+    case ST_BITHI :
+    {
+      i2c_scl_hi();
+      i2cas_bitcnt--;
+      if (i2cas_bitcnt) i2cas_state= ST_BITLO;
+                   else i2cas_state= ST_ACKLO;
+      break;
+    }
+
+    case ST_ACKLO :                                   // 9. Taktimpuls (Ack)
+    {
+      if (i2cas_sclwait()) break;
+      i2c_scl_lo();
+      i2c_sda_hi();
+      i2cas_state= ST_ACKHI;
+      break;
+    }
+
+    case ST_ACKHI :
+    {
+      i2c_scl_hi();
+      i2cas_state= ST_ACKRD;
+      break;
+    }
+
+    case ST_ACKRD :
+    {
+      if (i2cas_sclwait()) break;
+      if (i2c_is_sda()) i2c_async_nackcnt++;
+      i2c_scl_lo();
+      if (i2cas_rep)                                  // Fuellbyte wiederholen
+      {
+        i2cas_rep--;
+        i2cas_loadbyte();
+        i2cas_sdabit();
+        i2cas_state= ST_BITHI;
+      }
+      else
+      {
+        i2cas_next();
+      }
+      break;
+    }
+
+    case ST_HOLD :
+    {
+      i2cas_next();
+      break;
+    }
+
+    case ST_RSTART1 :
+    {
+      i2c_scl_hi();
+      i2cas_state= ST_RSTART2;
+      break;
+    }
+
+    case ST_RSTART2 :
+    {
+      if (i2cas_sclwait()) break;
+      i2c_sda_lo();
+      i2cas_loadbyte();
+      i2cas_state= ST_BITLO;
+      break;
+    }
+
+    case ST_STOP1 :
+    {
+      i2c_scl_hi();
+      i2cas_state= ST_STOP2;
+      break;
+    }
+
+    case ST_STOP2 :
+    {
+      if (i2cas_sclwait()) break;
+      i2c_sda_hi();                                   // Stopcondition, Bus frei
+      i2cas_state= ST_IDLE;
+      break;
+    }
+  }
+}
+
+/* -------------------------------------------------------
+                      i2c_async_init
+
+     initialisiert Busanschluesse und Timer1 (CTC-Mode,
+     Interrupt mit doppelter Busfrequenz)
+   ------------------------------------------------------- */
+void i2c_async_init(void)
+{
+  i2c_master_init();
+
+  TIMSK1 &= ~(1 << OCIE1A);
+  TCCR1A = 0;
+  TCCR1B = (1 << WGM12) | (1 << CS10);                // CTC, Prescaler 1
+  OCR1A = I2CAS_TICKS;
+  TCNT1 = 0;
+
+  i2cq_head= 0;
+  i2cq_tail= 0;
+  i2cas_state= ST_IDLE;
+
+  sei();
+}
+
+/* -------------------------------------------------------
+                  Eintragsfunktionen
+   ------------------------------------------------------- */
+void i2c_async_start(uint8_t addr)
+{
+  i2cq_put(I2CQ_START, addr, 0);
+}
+
+void i2c_async_write(uint8_t data)
+{
+  i2cq_put(I2CQ_DATA, data, 0);
+}
+
+void i2c_async_fill(uint8_t data, uint16_t anz)
+{
+  while (anz > 256)
+  {
+    i2cq_put(I2CQ_DATA, data, 255);
+    anz -= 256;
+  }
+  if (anz) i2cq_put(I2CQ_DATA, data, anz-1);
+}
+
+void i2c_async_stop(void)
+{
+  i2cq_put(I2CQ_STOP, 0, 0);
+}
+
+/* -------------------------------------------------------
+                      i2c_async_busy
+
+     Rueckgabe: 1 = Transfers ausstehend oder Bus belegt
+   ------------------------------------------------------- */
+uint8_t i2c_async_busy(void)
+{
+  if ((i2cq_head != i2cq_tail) || (i2cas_state != ST_IDLE)) return 1;
+  return 0;
+}
+
+/* -------------------------------------------------------
+                      i2c_async_free
+
+     Rueckgabe: Anzahl freier Queueeintraege
+   ------------------------------------------------------- */
+uint8_t i2c_async_free(void)
+{
+  return (i2cq_tail - i2cq_head - 1) & (i2c_async_qsize - 1);
+}
+
+/* -------------------------------------------------------
+                      i2c_async_wait
+
+     wartet, bis alle Eintraege gesendet sind und die
+     Stopcondition erzeugt wurde
+   ------------------------------------------------------- */
+void i2c_async_wait(void)
+{
+  while (i2c_async_busy());
+}
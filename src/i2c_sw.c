@@ -77,19 +77,50 @@ uint8_t i2c_read(uint8_t ack);
 
 /* ---------------------------------------------------------
                            i2c_delay
-       an die "Reaktionszeiten" der Register des STM8 an-
-       gepasste Warteschleife
+       wartet anz halbe Taktperioden des I2C-Busses
    --------------------------------------------------------- */
 void i2c_delay(uint16_t anz)
 {
-  volatile uint16_t count;
+  while (anz--)
+  {
+    __builtin_avr_delay_cycles(I2C_PERIOD_CYCLES / 2);
+  }
+}
+
+uint8_t i2c_error = I2C_OK;
+
+/* ---------------------------------------------------------
+                          i2c_sclwait
+
+       Clockstretching: ein Slave haelt SCL nach der
+       Freigabe durch den Master noch low. Es wird max.
+       I2C_STRETCH_US Mikrosekunden gewartet, danach ist
+       i2c_error = I2C_ERR_TIMEOUT
+
+       Aufruf ueber Makro i2c_sclsync(), das nur dann
+       hierher verzweigt, wenn SCL tatsaechlich low ist
+   --------------------------------------------------------- */
+static void i2c_sclwait(void)
+{
+  uint16_t t;
 
-  for (count= 0; count< anz; count++)
+  for (t= I2C_STRETCH_US; t; t--)
   {
-    _delay_us(1);
+    if (i2c_is_scl()) return;
+    __builtin_avr_delay_cycles(F_CPU / 1000000ul);
   }
+  i2c_error= I2C_ERR_TIMEOUT;
 }
 
+#define i2c_sclsync()     { if (!i2c_is_scl()) i2c_sclwait(); }
+
+// nach Timeout oder blockiertem Bus werden bis zur naechsten Start-
+// condition keine weiteren Taktimpulse erzeugt
+#define i2c_buserr()      ( i2c_error >= I2C_ERR_TIMEOUT )
+
+
+#if !defined(I2C_USI_TWI)
+
 /* #################################################################
      Funktionen fuer I2C - Bus (Softwareimplementierung)
    ################################################################# */
@@ -108,15 +139,35 @@ void i2c_master_init()
 
 /* -------------------------------------------------------
                      i2c_sendstart(void)
-    erzeugt die Startcondition auf dem I2C Bus
+    erzeugt die Startcondition (bzw. Repeated Start) auf
+    dem I2C Bus. SCL ist danach low
+
+    Haelt ein Slave SDA low, wird zuerst versucht den
+    Bus mit i2c_bus_recover freizutakten
    ------------------------------------------------------- */
 void i2c_sendstart(void)
 {
+  i2c_error= I2C_OK;
+
+  i2c_sda_hi();
+  i2c_tlow();
   i2c_scl_hi();
-  long_del();
+  i2c_sclsync();
+  i2c_thigh();
+
+  if (!i2c_is_sda() || i2c_buserr())            // Bus blockiert
+  {
+    if (!i2c_bus_recover())
+    {
+      i2c_error= I2C_ERR_BUS;
+      return;
+    }
+    i2c_error= I2C_OK;
+  }
 
   i2c_sda_lo();
-  long_del();
+  i2c_thigh();
+  i2c_scl_lo();
 }
 
 /* -------------------------------------------------------
@@ -154,43 +205,47 @@ void i2c_startaddr(uint8_t addr, uint8_t rwflag)
    ------------------------------------------------------- */
 void i2c_stop(void)
 {
+   i2c_scl_lo();
    i2c_sda_lo();
-   long_del();
+   i2c_tlow();
    i2c_scl_hi();
-   short_del();
+   i2c_sclsync();
+   i2c_thigh();
    i2c_sda_hi();
-   long_del();
+   i2c_tlow();
 }
 
 /* -------------------------------------------------------
                    i2c_write_nack(uint8_t data)
 
    schreibt einen Wert auf dem I2C Bus OHNE ein Ack-
-   nowledge einzulesen
+   nowledge einzulesen. SCL ist danach low.
+
+   Je Bit eine low- und eine high-Halbperiode, die
+   Wartezeiten sind um die Laufzeit der Schleife verkuerzt
+   (I2C_OVH_LOW / I2C_OVH_HIGH, abgezaehlt in i2c_sw.h).
+   Aenderungen an der Schleife erfordern neue Werte
   ------------------------------------------------------- */
 void i2c_write_nack(uint8_t data)
 {
   uint8_t i;
 
+  if (i2c_buserr()) return;
+
   for(i=0;i<8;i++)
   {
     i2c_scl_lo();
-    short_del();
 
     if(data & 0x80) i2c_sda_hi();
                else i2c_sda_lo();
 
-    short_del();
-
+    i2c_tlow();
     i2c_scl_hi();
-    short_del();
-    wait_del();
-
+    i2c_sclsync();
     data= data<<1;
+    i2c_thigh();
   }
   i2c_scl_lo();
-  short_del();
-
 }
 
 
@@ -205,29 +260,69 @@ void i2c_write_nack(uint8_t data)
    ------------------------------------------------------- */
 uint8_t i2c_write(uint8_t data)
 {
-   uint8_t ack;
+  uint8_t ack;
+
+  if (i2c_buserr()) return 0;
 
-   i2c_write_nack(data);
+  i2c_write_nack(data);
 
   //  9. Taktimpuls (Ack)
 
   i2c_sda_hi();
-  long_del();
-
+  i2c_tlow();
   i2c_scl_hi();
-  long_del();
-
-  i2c_sda_hi();
-  long_del();
+  i2c_sclsync();
+  i2c_thigh();
 
   if (i2c_is_sda()) ack= 0; else ack= 1;
 
   i2c_scl_lo();
-  long_del();
+
+  if (i2c_buserr()) return 0;
+  if (!ack) i2c_error= I2C_ERR_NACK;
 
   return ack;
 }
 
+/* -------------------------------------------------------
+                   i2c_bus_recover
+
+   gibt einen blockierten Bus frei: haelt ein Slave
+   (bspw. nach einem Reset des Masters mitten im Trans-
+   fer) SDA low, werden bis zu 9 Taktimpulse erzeugt,
+   bis der Slave SDA freigibt. Anschliessend folgt eine
+   Stopcondition.
+
+   Rueckgabe:
+               1 : Bus ist frei
+               0 : SDA oder SCL weiterhin low
+   ------------------------------------------------------- */
+uint8_t i2c_bus_recover(void)
+{
+  uint8_t i;
+
+  i2c_sda_hi();
+  for (i= 0; (i< 9) && (!i2c_is_sda()); i++)
+  {
+    i2c_scl_lo();
+    i2c_tlow();
+    i2c_scl_hi();
+    i2c_sclsync();
+    i2c_thigh();
+  }
+
+  i2c_scl_lo();
+  i2c_sda_lo();
+  i2c_tlow();
+  i2c_scl_hi();
+  i2c_sclsync();
+  i2c_thigh();
+  i2c_sda_hi();
+  i2c_tlow();
+
+  return (i2c_is_sda() && i2c_is_scl());
+}
+
 /* -------------------------------------------------------
                    i2c_write16(uint8_t data)
 
@@ -265,39 +360,381 @@ uint8_t i2c_read(uint8_t ack)
   uint8_t data= 0x00;
   uint8_t i;
 
+  if (i2c_buserr()) return 0xff;
+
   i2c_sda_hi();
 
   for(i=0;i<8;i++)
   {
     i2c_scl_lo();
-    short_del();
+    i2c_tlow();
     i2c_scl_hi();
-
-    short_del();
-    wait_del();
+    i2c_sclsync();
+    i2c_thigh();
 
     if(i2c_is_sda()) data|= (0x80>>i);
   }
 
   i2c_scl_lo();
 
+  if (ack) i2c_sda_lo();
+
+  i2c_tlow();
+  i2c_scl_hi();
+  i2c_sclsync();
+  i2c_thigh();
+
+  i2c_scl_lo();
   i2c_sda_hi();
 
-  long_del();
+  return data;
+}
+
+#else
 
-  if (ack)
+/* #################################################################
+     Funktionen fuer I2C - Bus (USI-Interface im Two-Wire Modus)
+
+     Das Schieben der Bits uebernimmt das USI-Datenregister, ge-
+     zaehlt werden die Taktflanken vom 4-Bit Zaehler des USI.
+     Die Software erzeugt nur noch die Flanken auf SCL (USITC).
+
+     Quelle: Atmel Application Note AVR310
+   ################################################################# */
+
+#define usi_sda_hi()      ( sdaport |= (1 << i2c_sdabitnr) )
+#define usi_sda_lo()      ( sdaport &= ~(1 << i2c_sdabitnr) )
+#define usi_scl_hi()      ( sclport |= (1 << i2c_sclbitnr) )
+#define usi_scl_lo()      ( sclport &= ~(1 << i2c_sclbitnr) )
+
+#define usi_tlow()        i2c_tlow()
+#define usi_thigh()       i2c_thigh()
+
+// USISR: Flags loeschen, Zaehler fuer 8 Bit (16 Flanken) bzw. 1 Bit (2 Flanken)
+#define USISR_8BIT        ( (1<<USISIF) | (1<<USIOIF) | (1<<USIPF) | (1<<USIDC) | (0x0 << USICNT0) )
+#define USISR_1BIT        ( (1<<USISIF) | (1<<USIOIF) | (1<<USIPF) | (1<<USIDC) | (0xe << USICNT0) )
+
+// Two-Wire Modus, Software-Clockstrobe, Taktflanke durch USITC
+#define USICR_TWI         ( (1<<USIWM1) | (1<<USICS1) | (1<<USICLK) )
+
+/* -------------------------------------------------------
+                     usi_transfer
+
+    schiebt den Inhalt von USIDR auf den Bus bzw. liest
+    vom Bus ein, bis der USI-Zaehler ueberlaeuft.
+
+    Uebergabe: Startwert fuer USISR (8 oder 1 Bit)
+    Rueckgabe: Inhalt von USIDR nach dem Transfer
+   ------------------------------------------------------- */
+static uint8_t usi_transfer(uint8_t usisr)
+{
+  uint8_t data;
+
+  USISR = usisr;
+  do
   {
-    i2c_sda_lo();
-    long_del();
+    usi_tlow();
+    USICR = USICR_TWI | (1 << USITC);           // steigende Flanke SCL
+    i2c_sclsync();                              // Clockstretching des Slaves abwarten
+    usi_thigh();
+    USICR = USICR_TWI | (1 << USITC);           // fallende Flanke SCL
+  } while (!(USISR & (1 << USIOIF)) && !i2c_buserr());
+
+  usi_tlow();
+  data= USIDR;
+  USIDR = 0xff;                                 // SDA freigeben
+  sdaddr |= (1 << i2c_sdabitnr);
+
+  return data;
+}
+
+/* -------------------------------------------------------
+                   i2c_master_init
+
+    USI in den Two-Wire Modus schalten, SDA und SCL
+    freigeben
+   ------------------------------------------------------- */
+void i2c_master_init()
+{
+  usi_sda_hi();
+  usi_scl_hi();
+  sdaddr |= (1 << i2c_sdabitnr);
+  sclddr |= (1 << i2c_sclbitnr);
+
+  USIDR = 0xff;
+  USICR = USICR_TWI;
+  USISR = USISR_8BIT;
+}
+
+/* -------------------------------------------------------
+                     i2c_sendstart(void)
+    erzeugt die Startcondition (bzw. Repeated Start) auf
+    dem I2C Bus. Haelt ein Slave SDA low, wird zuerst
+    versucht den Bus mit i2c_bus_recover freizutakten
+   ------------------------------------------------------- */
+void i2c_sendstart(void)
+{
+  i2c_error= I2C_OK;
+
+  usi_sda_hi();
+  usi_scl_hi();
+  i2c_sclsync();
+  usi_tlow();
+
+  if (!i2c_is_sda() || i2c_buserr())            // Bus blockiert
+  {
+    if (!i2c_bus_recover())
+    {
+      i2c_error= I2C_ERR_BUS;
+      return;
+    }
+    i2c_error= I2C_OK;
   }
 
-  i2c_scl_hi();
-  long_del();
+  usi_sda_lo();
+  usi_thigh();
+  usi_scl_lo();
+  usi_sda_hi();
+}
 
-  i2c_scl_lo();
-  long_del();
+/* -------------------------------------------------------
+                     i2c_start
+    erzeugt die Startcondition und sendet anschliessend
+    die Deviceadresse
+   ------------------------------------------------------- */
+uint8_t i2c_start(uint8_t addr)
+{
+  i2c_sendstart();
+  return i2c_write(addr);
+}
 
-  i2c_sda_hi();
+/* -------------------------------------------------------
+                   i2c_startaddr
+
+   startet den I2C-Bus und sendet Bauteileadresse.
+   rwflag bestimmt, ob das Device beschrieben oder
+   gelesen werden soll
+  -------------------------------------------------- */
+void i2c_startaddr(uint8_t addr, uint8_t rwflag)
+{
+  i2c_start((addr << 1) | rwflag);
+}
+
+/* -------------------------------------------------------
+                     i2c_stop
+    erzeugt die Stopcondition auf dem I2C Bus
+   ------------------------------------------------------- */
+void i2c_stop(void)
+{
+  usi_sda_lo();
+  usi_scl_hi();
+  i2c_sclsync();
+  usi_thigh();
+  usi_sda_hi();
+  usi_tlow();
+}
+
+/* -------------------------------------------------------
+                   i2c_write_nack(uint8_t data)
+
+   schreibt einen Wert auf dem I2C Bus OHNE ein Ack-
+   nowledge einzulesen
+  ------------------------------------------------------- */
+void i2c_write_nack(uint8_t data)
+{
+  if (i2c_buserr()) return;
+
+  usi_scl_lo();
+  USIDR = data;
+  usi_transfer(USISR_8BIT);
+}
+
+/* -------------------------------------------------------
+                   i2c_write(uint8_t data)
+
+   schreibt einen Wert auf dem I2C Bus.
+
+   Rueckgabe:
+               > 0 wenn Slave ein Acknowledge gegeben hat
+               == 0 wenn kein Acknowledge vom Slave
+   ------------------------------------------------------- */
+uint8_t i2c_write(uint8_t data)
+{
+  if (i2c_buserr()) return 0;
+
+  i2c_write_nack(data);
+
+  sdaddr &= ~(1 << i2c_sdabitnr);               // SDA als Eingang fuer Ack
+  if (usi_transfer(USISR_1BIT) & 0x01)
+  {
+    if (!i2c_buserr()) i2c_error= I2C_ERR_NACK;
+    return 0;
+  }
+  if (i2c_buserr()) return 0;
+  return 1;
+}
+
+/* -------------------------------------------------------
+                   i2c_bus_recover
+
+   gibt einen blockierten Bus frei (bis zu 9 Takt-
+   impulse, bis der Slave SDA freigibt, danach Stop-
+   condition). USIDR = 0xff, damit das USI SDA nicht
+   selbst low haelt.
+
+   Rueckgabe:
+               1 : Bus ist frei
+               0 : SDA oder SCL weiterhin low
+   ------------------------------------------------------- */
+uint8_t i2c_bus_recover(void)
+{
+  uint8_t i;
+
+  USIDR = 0xff;
+  usi_sda_hi();
+  for (i= 0; (i< 9) && (!i2c_is_sda()); i++)
+  {
+    usi_scl_lo();
+    usi_tlow();
+    usi_scl_hi();
+    i2c_sclsync();
+    usi_thigh();
+  }
+
+  usi_scl_lo();
+  usi_sda_lo();
+  usi_tlow();
+  usi_scl_hi();
+  i2c_sclsync();
+  usi_thigh();
+  usi_sda_hi();
+  usi_tlow();
+
+  return (i2c_is_sda() && i2c_is_scl());
+}
+
+/* -------------------------------------------------------
+                   i2c_write16(uint8_t data)
+
+   schreibt einen 16-Bit Wert auf dem I2C Bus.
+
+   Rueckgabe:
+               > 0 wenn Slave ein Acknowledge gegeben hat
+               == 0 wenn kein Acknowledge vom Slave
+   ------------------------------------------------------- */
+uint8_t i2c_write16(uint16_t data)
+{
+  if (!(i2c_write(data >> 8))) return 0;
+  return i2c_write(data & 0xff);
+}
+
+/* -------------------------------------------------------
+                    i2c_read(uint8_t ack)
+
+   liest ein Byte vom I2c Bus.
+
+   Uebergabe:
+               1 : nach dem Lesen wird dem Slave ein
+                   Acknowledge gesendet
+               0 : es wird kein Acknowledge gesendet
+
+   Rueckgabe:
+               gelesenes Byte
+   ------------------------------------------------------- */
+uint8_t i2c_read(uint8_t ack)
+{
+  uint8_t data;
+
+  if (i2c_buserr()) return 0xff;
+
+  sdaddr &= ~(1 << i2c_sdabitnr);               // SDA als Eingang
+  data= usi_transfer(USISR_8BIT);
+
+  if (ack) USIDR = 0x00; else USIDR = 0xff;     // Ack = SDA low
+  usi_transfer(USISR_1BIT);
 
   return data;
 }
+
+#endif
+
+/* #################################################################
+     Blocktransfers (unabhaengig von Bitbanging / USI)
+   ################################################################# */
+
+/* -------------------------------------------------------
+                     i2c_write_buf
+
+   schreibt len Bytes aus dem RAM ab Register reg in
+   einer Transaktion
+
+   Rueckgabe:
+               > 0 wenn alle Bytes quittiert wurden
+               == 0 wenn kein Acknowledge vom Slave
+   ------------------------------------------------------- */
+uint8_t i2c_write_buf(uint8_t addr, uint8_t reg, const uint8_t *buf, uint16_t len)
+{
+  uint8_t ack;
+
+  ack= i2c_start(addr);
+  if (ack) ack= i2c_write(reg);
+  while (ack && len)
+  {
+    ack= i2c_write(*buf++);
+    len--;
+  }
+  i2c_stop();
+
+  return ack;
+}
+
+/* -------------------------------------------------------
+                     i2c_write_buf_P
+
+   wie i2c_write_buf, Daten aus dem Flash
+   ------------------------------------------------------- */
+uint8_t i2c_write_buf_P(uint8_t addr, uint8_t reg, const uint8_t *buf, uint16_t len)
+{
+  uint8_t ack;
+
+  ack= i2c_start(addr);
+  if (ack) ack= i2c_write(reg);
+  while (ack && len)
+  {
+    ack= i2c_write(pgm_read_byte(buf++));
+    len--;
+  }
+  i2c_stop();
+
+  return ack;
+}
+
+/* -------------------------------------------------------
+                     i2c_read_buf
+
+   liest len Bytes ab Register reg. Das letzte Byte
+   wird nicht quittiert (NACK), danach Stopcondition
+
+   Rueckgabe:
+               > 0 wenn das Device geantwortet hat
+               == 0 wenn kein Acknowledge vom Slave
+   ------------------------------------------------------- */
+uint8_t i2c_read_buf(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+  uint8_t ack;
+
+  ack= i2c_start(addr);
+  if (ack) ack= i2c_write(reg);
+  if (ack) ack= i2c_start(addr | 1);              // Repeated Start, lesen
+  if (ack)
+  {
+    while (len)
+    {
+      len--;
+      *buf++= i2c_read(len ? 1 : 0);
+    }
+  }
+  i2c_stop();
+
+  return ack;
+}
@@ -16,6 +16,7 @@
    ------------------------------------------------------ */
 
 #include "lcd_7seg.h"
+#include "bcd_conv.h"
 
 
 // Bitmapmuster der Ziffern
@@ -87,8 +88,7 @@ void lcd7s_outbyte(uint8_t hi_value, uint8_t lo_value)
    ---------------------------------------------------------- */
 void lcd7s_dezout(uint8_t value)
 {
-  lcd7s_buffer= value % 10;
-  lcd7s_buffer |= ((value /10) << 4);
+  lcd7s_buffer= bcd_8bit(value);
 }
 
 /* ----------------------------------------------------------
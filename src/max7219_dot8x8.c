@@ -190,6 +190,34 @@ void m7219_setpgmbmp(const uint8_t *bmp)
   }
 }
 
+#if (bitmap_enable == 1)
+
+/* -----------------------------------------------------------
+     m7219_blit_P
+
+     zeigt eine mit imgconv erzeugte Bitmap (Format
+     BMP_PAGE, 8x8 Pixel, auch RLE komprimiert) aus dem
+     Programmspeicher an.
+
+        *image : Bitmap (bitmap_p.h)
+   ----------------------------------------------------------- */
+void m7219_blit_P(const uint8_t *image)
+{
+  uint8_t i, w;
+
+  if (bmp_format(image) != BMP_PAGE) return;
+
+  w= bmp_width(image);
+  if (w > 8) w= 8;
+  bmp_start(image);
+  for (i= 0; i< w; i++)
+  {
+    m7219_col(i, bmp_getbyte());
+  }
+}
+
+#endif
+
 /* -----------------------------------------------------------
      Framebuffer
    ----------------------------------------------------------- */
@@ -294,7 +322,7 @@ void fbuf_scroll_text_in(uint8_t *dest, uint8_t *txt, int dtime1, int dtime2)
     {
       for (b= 0; b< 8; b++)
       {
-        tmp_buf[b]= reversebyte(pgm_read_byte(&font8x8h[c-32][b]));
+        tmp_buf[b]= reversebyte(font8x8h_byte(c, b));
       }
       fbuf_scroll_in(dest, &tmp_buf[0], dtime1);
       vdelay(dtime2);
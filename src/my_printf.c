@@ -24,74 +24,154 @@
 
      29.08.2018    R. Seelig
 
+     Formatierer mit austauschbarer Ausgabefunktion (Sink), Feldbreite,
+     %u, %ld / %lu, %S (Flashstring), %k mit beliebiger Anzahl Nach-
+     kommastellen sowie Ausgabe in einen RAM-Puffer. Zahlen werden
+     ohne Division mit bcd_dig16 / bcd_dig32 (bcd_conv.c) gewandelt.
+
+     17.10.2026    agent
+
    --------------------------------------------------------------------- */
 
 #include "my_printf.h"
+#include "bcd_conv.h"
 
 char printfkomma = 1;
 
+#if (printf_long_enable == 1)
+
+  typedef uint32_t pf_uint;
+  typedef int32_t  pf_int;
+
+  #define PF_MAXDIG           10
+  #define pf_bcd(v,d)         bcd_dig32(v, d, PF_MAXDIG)
+
+#else
+
+  typedef uint16_t pf_uint;
+  typedef int16_t  pf_int;
+
+  #define PF_MAXDIG           5
+  #define pf_bcd(v,d)         bcd_dig16(v, d, PF_MAXDIG)
+
+#endif
+
+static printf_sink_t pf_sink = my_putchar;              // aktuelle Ausgabefunktion
+static char *pf_sbuf;                                   // Schreibzeiger fuer own_sprintf
+
 
 /* ------------------------------------------------------------
-                            PUTINT
-     gibt einen Integer dezimal aus. Ist Uebergabe
-     "komma" != 0 wird ein "Kommapunkt" mit ausgegeben.
+                           PF_PUTNUM
 
-     Bsp.: 12345 wird als 123.45 ausgegeben.
-     (ermoeglicht Pseudofloatausgaben im Bereich)
+     gibt einen vorzeichenlosen Wert dezimal auf der aktuellen
+     Ausgabefunktion aus.
+
+        neg   : != 0 => Minuszeichen voranstellen
+        komma : Anzahl Nachkommastellen (Pseudofloat), fehlende
+                Stellen werden mit 0 aufgefuellt (5 mit komma= 2
+                ergibt 0.05)
+        width : minimale Feldbreite
+        pad   : Fuellzeichen ' ' oder '0'
+
+     Die Ziffern liefert bcd_dig16 / bcd_dig32 (bcd_conv.c,
+     keine Division, der AVR hat keine)
    ------------------------------------------------------------ */
-void putint(int i, char komma)
+static void pf_putnum(pf_uint val, uint8_t neg, uint8_t komma, uint8_t width, char pad)
 {
-  typedef enum boolean { FALSE, TRUE }bool_t;
+  uint8_t dig[PF_MAXDIG];
+  uint8_t n, i, anz, len;
 
-  static int zz[]      = { 10000, 1000, 100, 10 };
-  bool_t     not_first = FALSE;
+  pf_bcd(val, dig);
+  for (i= 0; (i< PF_MAXDIG-1) && (dig[i] == 0); i++);  // fuehrende Nullen unterdruecken
+  n= PF_MAXDIG - i;                                     // Anzahl signifikanter Ziffern
 
-  uint8_t       zi;
-  int        z, b;
+  anz= (n > komma) ? n : komma + 1;                     // Anzahl auszugebender Ziffern
+  len= anz + neg + (komma ? 1 : 0);
 
-  komma= 5-komma;
+  if (pad != '0')
+  {
+    for (; width > len; width--) pf_sink(' ');
+  }
+  if (neg) pf_sink('-');
+  for (; width > len; width--) pf_sink('0');
 
-  if (!i)
+  for (i= anz; i; i--)                                  // i: Anzahl verbleibender Ziffern
   {
-    my_putchar('0');
+    if (i == komma) pf_sink('.');
+    pf_sink( (i > n) ? '0' : '0' + dig[PF_MAXDIG - i] );
   }
-  else
+}
+
+/* ------------------------------------------------------------
+                           PF_PUTHEX
+
+     gibt einen Wert hexadezimal aus: 2-stellig bis 0xff,
+     4-stellig bis 0xffff, sonst 8-stellig. Ist width groesser,
+     wird mit pad aufgefuellt.
+   ------------------------------------------------------------ */
+static void pf_puthex(pf_uint h, uint8_t width, char pad)
+{
+  uint8_t anz;
+
+  anz= 2;
+  if (h > 0xff) anz= 4;
+#if (printf_long_enable == 1)
+  if (h > 0xffff) anz= 8;
+#endif
+  for (; width > anz; width--) pf_sink(pad);
+
+  while (anz)
   {
-    if(i < 0)
-    {
-      my_putchar('-');
-      i = -i;
-    }
-    for(zi = 0; zi < 4; zi++)
-    {
-      z = 0;
-      b = 0;
+    anz--;
+    hexnibbleout((h >> (anz << 2)) & 0x0f);
+  }
+}
 
-      if  ((zi==komma) && komma)
-      {
-        if (!not_first) my_putchar('0');
-        my_putchar('.');
-        not_first= TRUE;
-      }
+/* ------------------------------------------------------------
+                           PF_PUTSTR
 
-      while(z + zz[zi] <= i)
-      {
-        b++;
-        z += zz[zi];
-      }
-      if(b || not_first)
-      {
-        my_putchar('0' + b);
-        not_first = TRUE;
-      }
-      i -= z;
+     gibt einen String aus dem RAM (flash= 0) oder dem Flash-
+     speicher (flash= 1) rechtsbuendig in der Feldbreite aus
+   ------------------------------------------------------------ */
+static void pf_putstr(const char *p, uint8_t flash, uint8_t width)
+{
+  uint8_t len;
+
+  if (width)
+  {
+    len= 0;
+    while (len < width)
+    {
+      if (!(flash ? pgm_read_byte(p + len) : p[len])) break;
+      len++;
     }
-    if (komma== 4) my_putchar('.');
-    my_putchar('0' + i);
+    for (; width > len; width--) pf_sink(' ');
+  }
+  if (flash)
+  {
+    while (pgm_read_byte(p)) pf_sink(pgm_read_byte(p++));
+  }
+  else
+  {
+    while (*p) pf_sink(*p++);
   }
 }
 
 
+/* ------------------------------------------------------------
+                            PUTINT
+     gibt einen Integer dezimal aus. Ist Uebergabe
+     "komma" != 0 wird ein "Kommapunkt" mit ausgegeben.
+
+     Bsp.: 12345 wird als 123.45 ausgegeben.
+     (ermoeglicht Pseudofloatausgaben im Bereich)
+   ------------------------------------------------------------ */
+void putint(int i, char komma)
+{
+  if (i < 0) pf_putnum(-(pf_int)i, 1, komma, 0, ' ');
+        else pf_putnum(i, 0, komma, 0, ' ');
+}
+
 
 /* --------------------------------------------------
                     HEXNIBBLEOUT
@@ -102,7 +182,7 @@ void putint(int i, char komma)
 void hexnibbleout(uint8_t b)
 {
   if (b< 10) b+= '0'; else b+= 55;
-  my_putchar(b);
+  pf_sink(b);
 }
 
 /* --------------------------------------------------
@@ -114,20 +194,7 @@ void hexnibbleout(uint8_t b)
    -------------------------------------------------- */
 void puthex(uint16_t h)
 {
-  uint8_t b;
-
-  if (h> 0xff)                    // 16 Bit-Wert
-  {
-    b= (h >> 12);
-    hexnibbleout(b);
-    b= (h >> 8) & 0x0f;
-    hexnibbleout(b);
-  }
-  b= h;
-  b= (h >> 4) & 0x0f;
-  hexnibbleout(b);
-  b= h & 0x0f;
-  hexnibbleout(b);
+  pf_puthex(h, 0, '0');
 }
 
 /* --------------------------------------------------
@@ -136,104 +203,219 @@ void puthex(uint16_t h)
    -------------------------------------------------- */
 void my_putramstring(uint8_t *p)
 {
-  do
-  {
-    my_putchar( *p );
-  } while( *p++);
+  pf_putstr((char *)p, 0, 0);
 }
 
 
 /* --------------------------------------------------
-                       OWN_PRINT
+                       OWN_VFPRINTF
 
-                      als Macros:
-                       MY_PRINTF
-                      TINY_PRINTF
-
-     alternativer Ersatz fuer printf.
+     Formatierer, schreibt alle Zeichen direkt in die
+     Ausgabefunktion sink (kein Zwischenpuffer).
 
-     Aufruf:
-
-         own_printf(PSTR("Ergebnis= %d"),zahl);
+     Platzhalter:  %[0][breite][.nachkomma][l]typ
 
-     oder durch define-Makro (besser):
-
-         tiny_printf("Ergebnis= %d",zahl);
-         my_printf("Ergebnis= %d",zahl);
-
-     Platzhalterfunktionen:
-
-        %s     : Ausgabe Textstring
+        %s     : Ausgabe Textstring aus dem RAM
+        %S     : Ausgabe Textstring aus dem Flash
+                 (PSTR, PROGMEM)
         %d     : dezimale Ausgabe
+        %u     : dezimale Ausgabe ohne Vorzeichen
         %x     : hexadezimale Ausgabe
                  ist Wert > 0xff erfolgt 4-stellige
                  Ausgabe
                  is Wert <= 0xff erfolgt 2-stellige
                  Ausgabe
         %k     : Integerausgabe als Pseudokommazahl
-                 12345 wird als 123.45 ausgegeben
+                 12345 wird als 123.45 ausgegeben.
+                 Anzahl Nachkommastellen ist
+                 printfkomma oder die Angabe nach dem
+                 Punkt (%.3k)
         %c     : Ausgabe als Asciizeichen
 
+        l      : 32-Bit Argument (long) fuer d, u, x, k
+
+        breite : minimale Feldbreite, fuehrende 0
+                 fuellt mit Nullen auf (%05d)
    -------------------------------------------------- */
-void own_printf(const uint8_t *s,...)
+void own_vfprintf(printf_sink_t sink, const uint8_t *s, va_list ap)
 {
-  int       arg1;
-  uint8_t   *arg2;
-  char      ch;
-  va_list   ap;
+  printf_sink_t oldsink;
+  pf_int        arg;
+  char          ch, pad;
+  uint8_t       width, komma, islong;
+
+  oldsink= pf_sink;
+  pf_sink= sink;
 
-  va_start(ap,(const)s);
-  do
+  while ((ch= pgm_read_byte(s++)))
   {
-    ch= pgm_read_byte(s);
-    if(ch== 0) return;
+    if (ch != '%')
+    {
+      pf_sink(ch);
+      continue;
+    }
+
+    // Platzhalter: Fuellzeichen, Feldbreite, Nachkommastellen, Laenge
+    pad= ' ';
+    width= 0;
+    komma= printfkomma;
+    islong= 0;
 
-    if(ch=='%')            // Platzhalterzeichen
+    ch= pgm_read_byte(s++);
+    if (ch == '0')
     {
-      uint8_t token= pgm_read_byte(++s);
-      switch(token)
+      pad= '0';
+      ch= pgm_read_byte(s++);
+    }
+    while ((ch >= '0') && (ch <= '9'))
+    {
+      width= (width * 10) + (ch - '0');
+      ch= pgm_read_byte(s++);
+    }
+    if (ch == '.')
+    {
+      komma= 0;
+      ch= pgm_read_byte(s++);
+      while ((ch >= '0') && (ch <= '9'))
       {
-        case 'd':          // dezimale Ausgabe
-        {
-          arg1= va_arg(ap,int);
-          putint(arg1,0);
-          break;
-        }
-        case 'x':          // hexadezimale Ausgabe
-        {
-          arg1= va_arg(ap,int);
-          puthex(arg1);
-          break;
-        }
-        case 'k':          // Integerausgabe mit Komma: 12896 zeigt 128.96 an
-        {
-          arg1= va_arg(ap,int);
-          putint(arg1, printfkomma);
-          break;
-        }
-        case 'c':          // Zeichenausgabe
-        {
-          arg1= va_arg(ap,int);
-          my_putchar(arg1);
-          break;
-        }
-        case '%':
+        komma= (komma * 10) + (ch - '0');
+        ch= pgm_read_byte(s++);
+      }
+    }
+    if (ch == 'l')
+    {
+      islong= 1;
+      ch= pgm_read_byte(s++);
+    }
+
+    switch(ch)
+    {
+      case 'd':            // dezimale Ausgabe
+      case 'k':            // Integerausgabe mit Komma: 12896 zeigt 128.96 an
+      case 'u':            // vorzeichenlose Ausgabe
+      case 'x':            // hexadezimale Ausgabe
+      {
+        if (islong) arg= (pf_int)va_arg(ap, long);      // ohne printf_long_enable auf 16 Bit gekuerzt
+        else
         {
-          my_putchar(token);
-          break;
+          if (ch == 'd' || ch == 'k') arg= va_arg(ap, int);
+                                 else arg= va_arg(ap, unsigned int);
         }
-        case 's':
+
+        if (ch == 'x')
+          pf_puthex(arg, width, pad);
+        else
         {
-          arg2= va_arg(ap,char *);
-          my_putramstring(arg2);
-          break;
+          if (ch != 'k') komma= 0;
+          if ((ch != 'u') && (arg < 0)) pf_putnum(-arg, 1, komma, width, pad);
+                                   else pf_putnum(arg, 0, komma, width, pad);
         }
+        break;
+      }
+      case 'c':            // Zeichenausgabe
+      {
+        pf_sink(va_arg(ap, int));
+        break;
+      }
+      case 's':            // String aus dem RAM
+      case 'S':            // String aus dem Flash
+      {
+        pf_putstr(va_arg(ap, char *), (ch == 'S'), width);
+        break;
+      }
+      case '%':
+      {
+        pf_sink(ch);
+        break;
+      }
+      case 0:              // Formatstring endet mit '%'
+      {
+        s--;
+        break;
       }
     }
-    else
-    {
-      my_putchar(ch);
-    }
-    s++;
-  }while (ch != '\0');
+  }
+
+  pf_sink= oldsink;
+}
+
+
+/* --------------------------------------------------
+                       OWN_PRINT
+
+                      als Macros:
+                       MY_PRINTF
+                      TINY_PRINTF
+
+     alternativer Ersatz fuer printf, Ausgabe ueber
+     my_putchar.
+
+     Aufruf:
+
+         own_printf(PSTR("Ergebnis= %d"),zahl);
+
+     oder durch define-Makro (besser):
+
+         tiny_printf("Ergebnis= %d",zahl);
+         my_printf("Ergebnis= %d",zahl);
+
+     Platzhalter siehe own_vfprintf
+   -------------------------------------------------- */
+void own_printf(const uint8_t *s,...)
+{
+  va_list   ap;
+
+  va_start(ap, s);
+  own_vfprintf(my_putchar, s, ap);
+  va_end(ap);
+}
+
+/* --------------------------------------------------
+                       OWN_FPRINTF
+
+                      als Macro:
+                      MY_FPRINTF
+
+     wie own_printf, Ausgabe jedoch ueber die
+     angegebene Funktion sink
+
+     Bsp.:  my_fprintf(uart_putchar, "T= %k", t);
+            my_fprintf(oled_putchar, "%5u", n);
+   -------------------------------------------------- */
+void own_fprintf(printf_sink_t sink, const uint8_t *s,...)
+{
+  va_list   ap;
+
+  va_start(ap, s);
+  own_vfprintf(sink, s, ap);
+  va_end(ap);
+}
+
+/* --------------------------------------------------
+                       OWN_SPRINTF
+
+                      als Macro:
+                      MY_SPRINTF
+
+     schreibt in den RAM-Puffer buf (mit abschlies-
+     sender 0). Der Puffer muss gross genug sein !
+
+     Rueckgabe: Anzahl geschriebener Zeichen (ohne 0)
+   -------------------------------------------------- */
+static void pf_ramsink(char c)
+{
+  *pf_sbuf++= c;
+}
+
+uint8_t own_sprintf(char *buf, const uint8_t *s,...)
+{
+  va_list   ap;
+
+  pf_sbuf= buf;
+  va_start(ap, s);
+  own_vfprintf(pf_ramsink, s, ap);
+  va_end(ap);
+  *pf_sbuf= 0;
+
+  return pf_sbuf - buf;
 }
@@ -49,8 +49,6 @@ Hinweis:
 
   Die Prototypen aus tx4_n5110.h
 
-  void spi_init(void);
-  unsigned char spi_out(uint8_t data);
   void wrcmd(uint8_t command);                            // sende ein Kommando
   void lcd_init();                                        // initialisiere das Display
   void wrdata(uint8_t dat);                               // sende ein Datum
@@ -68,73 +66,6 @@ char wherex= 0;
 char wherey= 0;
 char invchar= 0;               // = 1 fuer inversive Textausgabe
 
-/* -------------------- SPI Interface -------------------------- */
-
-/* -------------------------------------------------------------
-   SPI_INIT
-
-     Anschlusspins des SPI-Interface konfigurieren
-   ------------------------------------------------------------- */
-void spi_init(void)
-{
-  SPI_DDR |= (1 << SPI_MOSI_PIN) | (1 << SPI_CLK_PIN) | (1 << SPI_SS_PIN);
-
-  SPI_DDR &= ~(1 << SPI_MISO_PIN);
-  SPI_PORT |= (1 << SPI_MISO_PIN);
-}
-
-
-#if (hardware_spi == 1)
-
-  /* -------------------------------------------------------------
-     SPI_OUT
-
-        Byte ueber USI Hardware senden / empfangen
-        data ==> zu sendendes Datum
-     ------------------------------------------------------------- */
-  unsigned char spi_out(uint8_t data)
-  {
-    volatile uint8_t r;
-
-    USIDR = data;
-    USISR = (1 << USIOIF);
-
-    while ( (USISR & (1 << USIOIF)) == 0 )
-    {
-      USICR = (1 << USIWM0) | (1 << USICS1) | (1 << USICLK) | (1 << USITC);
-    }
-    return USIDR;
-  }
-#endif
-
-#if (hardware_spi == 0)
-
-  /* -------------------------------------------------------------
-     SPI_OUT
-
-        Byte ueber Software SPI senden / empfangen
-        data ==> zu sendendes Datum
-     ------------------------------------------------------------- */
-  unsigned char spi_out(uint8_t data)
-  {
-    char a;
-
-    for (a=0;a<8;a++)
-    {
-      if((data & 0x80)> 0) { LCD_PORT |= (1 << SPI_MOSI_PIN); }
-                      else { LCD_PORT &= ~(1 << SPI_MOSI_PIN); }
-
-      LCD_PORT |= (1 << SPI_CLK_PIN);                           // Taktleitung auf 1
-      LCD_PORT &= ~(1 << SPI_CLK_PIN);                          // und wieder auf 0
-
-      data <<= 1;
-    }
-
-  }
-
-#endif
-
-
 /* -------------------------------------------------------------
    WRCMD
 
@@ -198,13 +129,13 @@ void wrdata(uint8_t data)
    ------------------------------------------------------------- */
 void lcd_init(uint8_t contrast, uint8_t bias, uint8_t temp)
 {
-  LCD_DDR |= (1 << LCD_RST_PIN) | (1 << LCD_DC_PIN);     // Set LCD Output pins
+  LCD_DDR |= (1 << LCD_RST_PIN) | (1 << LCD_DC_PIN) | (1 << LCD_CE_PIN);     // Set LCD Output pins
   LCD_PORT &= ~(1 << LCD_RST_PIN);                       // Resets LCD controler
   _delay_ms(1);
   LCD_PORT |= (1 << LCD_RST_PIN);                        // Set LCD CE = 1 (Disabled)
   LCD_PORT |= (1 << LCD_CE_PIN);
 
-  spi_init();
+  spi_init();                             // MOSI, SCK (usi_spi.c)
 
   // LCD Controller Kommandos  (eigentliches initialisieren)
 
@@ -294,7 +225,7 @@ void lcd_putchar_d(char ch)
 
   for (b= 0;b<5;b++)
   {
-    rb= pgm_read_byte(&(fonttab[ch-32][b]));
+    rb= font5x7_byte(ch, b);
     if (invchar) {rb= ~rb;}
     wrdata(rb);
   }
@@ -331,3 +262,69 @@ void putromstring(const unsigned char *dataPtr)
   for (c=pgm_read_byte(dataPtr); c; ++dataPtr, c=pgm_read_byte(dataPtr)) lcd_putchar_d(c);
 }
 
+#if (stripout_enable == 1)
+
+  /* ---------------------------------------------------
+     LCD_STRIPOUT
+
+     gibt einen Streifen aus strip_render.c aus. Die
+     Adresse wird einmal gesetzt, danach werden alle
+     Bytes ohne Umschalten von DC / CE gesendet
+
+       page  : Pageadresse (Pixelzeilen page*8 .. page*8+7)
+       buf   : Streifenpuffer, Bit 0 = oberste Zeile
+       width : Anzahl Bytes (Spalten)
+     ---------------------------------------------------*/
+  void lcd_stripout(uint8_t page, uint8_t *buf, uint8_t width)
+  {
+    wrcmd(0x80);
+    wrcmd(0x40 | page);
+
+    LCD_PORT |= (1 << LCD_DC_PIN);                   // Datenmodus
+    LCD_PORT &= ~(1 << LCD_CE_PIN);
+    spi_outbuf(buf, width);
+    LCD_PORT |= (1 << LCD_CE_PIN);
+    gotoxy(wherex, wherey);
+  }
+
+#endif
+
+#if (bitmap_enable == 1)
+
+  /* ---------------------------------------------------
+     LCD_BLIT_P
+
+     gibt eine mit imgconv erzeugte Bitmap (Format
+     BMP_PAGE, auch RLE komprimiert) aus dem Flash aus.
+     Je Page wird die Adresse einmal gesetzt, die Bild-
+     daten werden ohne Puffer aus dem Decoder gesendet
+
+       x     : linke Spalte (Pixel)
+       page  : obere Page (Pixelzeilen page*8 ..)
+       image : Bitmap (bitmap_p.h)
+     ---------------------------------------------------*/
+  void lcd_blit_P(uint8_t x, uint8_t page, const uint8_t *image)
+  {
+    uint8_t w, p, pages, i;
+    USI_SPI_DECL
+
+    if (bmp_format(image) != BMP_PAGE) return;
+
+    w= bmp_width(image);
+    pages= bmp_height(image) >> 3;
+    bmp_start(image);
+
+    for (p= 0; p< pages; p++)
+    {
+      wrcmd(0x80 | x);
+      wrcmd(0x40 | (page + p));
+
+      LCD_PORT |= (1 << LCD_DC_PIN);                 // Datenmodus
+      LCD_PORT &= ~(1 << LCD_CE_PIN);
+      for (i= 0; i< w; i++) spi_fast(bmp_getbyte());
+      LCD_PORT |= (1 << LCD_CE_PIN);
+    }
+    gotoxy(wherex, wherey);
+  }
+
+#endif
@@ -40,6 +40,29 @@ uint8_t doublechar= 0;                          // Flag fuer Zeichenausgabe in g
 uint8_t bkcolor= 0;                             // Hintergrundfarbe (0 = schwarz)
 uint8_t textcolor= 1;                           // Textfarbe (1 = weiss)
 
+#if (oled_framebuffer == 1)
+
+  #define FB_WIDTH      (oled_fbwin_cols * 8)   // Bytes je Page im Puffer
+
+  static uint8_t fb[oled_fbwin_rows][FB_WIDTH];
+  static uint8_t fb_dmin[oled_fbwin_rows];      // erste geaenderte Spalte einer Page
+  static uint8_t fb_dmax[oled_fbwin_rows];      // letzte geaenderte Spalte (dmin > dmax: unveraendert)
+  static uint8_t fb_posinvalid = 1;             // Adresszeiger des Displays steht nicht auf aktxp, aktyp
+
+  static void fb_clear(uint8_t value);
+
+  static void fb_sent(uint8_t px, uint8_t page, uint8_t value);
+
+  // vor direkter Ausgabe den Adresszeiger des Displays setzen
+  #define fb_syncpos()  { if (fb_posinvalid) oled_setpos(); }
+
+#else
+
+  #define fb_syncpos()
+  #define fb_sent(px, page, value)
+
+#endif
+
 
 /* -------------------------------------------------------
                    ssd1306_writecmd
@@ -48,6 +71,7 @@ uint8_t textcolor= 1;                           // Textfarbe (1 = weiss)
    ------------------------------------------------------- */
 void ssd1306_writecmd(uint8_t cmd)
 {
+  oled_sync();
   i2c_start(ssd1306_addr);
   i2c_write(0x00);
   i2c_write(cmd);
@@ -61,6 +85,7 @@ void ssd1306_writecmd(uint8_t cmd)
    ------------------------------------------------------- */
 void ssd1306_writedata(uint8_t data)
 {
+  oled_sync();
   i2c_start(ssd1306_addr);
   i2c_write(0x40);
   i2c_write(data);
@@ -74,7 +99,11 @@ void ssd1306_writedata(uint8_t data)
    ------------------------------------------------------- */
 void ssd1306_init(void)
 {
-  i2c_master_init();
+  #if (oled_async == 1)
+    i2c_async_init();
+  #else
+    i2c_master_init();
+  #endif
   //Init LCD
 
   ssd1306_writecmd(0x8d);      // Ladungspumpe an
@@ -83,6 +112,38 @@ void ssd1306_init(void)
   _delay_ms(150);
   ssd1306_writecmd(0xa1);      // Segment Map
   ssd1306_writecmd(0xc0);      // Direction Map
+
+  #if (oled_framebuffer == 1)
+    fb_clear(0x00);
+  #endif
+}
+
+/*  ---------------------------------------------------------
+                            oled_setpos
+
+     setzt den Adresszeiger des Displays auf die Text-
+     position aktxp, aktyp
+    --------------------------------------------------------- */
+static void oled_setpos(void)
+{
+  uint8_t x, y;
+
+  x= aktxp * 8;
+  y= 7-aktyp;
+
+#if (oled_framebuffer == 1)
+  fb_posinvalid= 0;
+#endif
+
+  oled_sync();
+  i2c_start(ssd1306_addr);
+  i2c_write(0x00);
+
+  i2c_write(0xb0 | (y & 0x0f));
+  i2c_write(0x10 | (x >> 4 & 0x0f));
+  i2c_write(x & 0x0f);
+
+  i2c_stop();
 }
 
 /*  ---------------------------------------------------------
@@ -91,24 +152,125 @@ void ssd1306_init(void)
      legt die naechste Textausgabeposition auf dem
      Display fest. Koordinaten 0,0 bezeichnet linke obere
      Position
+
+     Im Framebuffermodus wird der Adresszeiger des Displays
+     erst vor der naechsten direkten Ausgabe gesetzt.
     --------------------------------------------------------- */
 void gotoxy(uint8_t x, uint8_t y)
 {
   aktxp= x;
   aktyp= y;
-  x *= 8;
-  y= 7-y;
 
-  i2c_start(ssd1306_addr);
-  i2c_write(0x00);
+#if (oled_framebuffer == 1)
+  fb_posinvalid= 1;
+#else
+  oled_setpos();
+#endif
+}
 
-  i2c_write(0xb0 | (y & 0x0f));
-  i2c_write(0x10 | (x >> 4 & 0x0f));
-  i2c_write(x & 0x0f);
+#if (oled_framebuffer == 1)
 
-  i2c_stop();
+/*  ---------------------------------------------------------
+                            fb_inwin
+
+     Rueckgabe: 1 = Textposition x,y liegt im Fenster des
+                    Framebuffers
+    --------------------------------------------------------- */
+static uint8_t fb_inwin(uint8_t x, uint8_t y)
+{
+  return ( ((uint8_t)(x - oled_fbwin_x) < oled_fbwin_cols) &&
+           ((uint8_t)(y - oled_fbwin_y) < oled_fbwin_rows) );
+}
+
+/*  ---------------------------------------------------------
+                            fb_putbyte
+
+     schreibt Spalte col (0..7) der Zeichenposition x,y in
+     den Framebuffer und merkt geaenderte Spalten vor
+    --------------------------------------------------------- */
+static void fb_putbyte(uint8_t x, uint8_t y, uint8_t col, uint8_t value)
+{
+  uint8_t r, c;
+
+  r= y - oled_fbwin_y;
+  c= ((x - oled_fbwin_x) << 3) + col;
+
+  if (fb[r][c] == value) return;
+  fb[r][c]= value;
+  if (c < fb_dmin[r]) fb_dmin[r]= c;
+  if (c > fb_dmax[r]) fb_dmax[r]= c;
+}
+
+/*  ---------------------------------------------------------
+                            fb_sent
+
+     ein Byte wurde direkt an Pixelspalte px, Page page
+     (0 = oben, wie gotoxy) gesendet. Liegt es im Fenster,
+     wird es in den Framebuffer uebernommen, damit der
+     Puffer dem Displayinhalt entspricht (keine Markierung
+     als geaendert, das Display hat den Wert bereits)
+    --------------------------------------------------------- */
+static void fb_sent(uint8_t px, uint8_t page, uint8_t value)
+{
+  uint8_t r, c;
+
+  r= page - oled_fbwin_y;
+  c= px - (oled_fbwin_x * 8);
+  if ((r < oled_fbwin_rows) && (c < FB_WIDTH)) fb[r][c]= value;
+}
+
+/*  ---------------------------------------------------------
+                            fb_clear
+
+     fuellt den Framebuffer mit value (der Displayinhalt
+     wurde bereits geloescht, es ist nichts zu senden)
+    --------------------------------------------------------- */
+static void fb_clear(uint8_t value)
+{
+  uint8_t r, c;
+
+  for (r= 0; r< oled_fbwin_rows; r++)
+  {
+    for (c= 0; c< FB_WIDTH; c++) fb[r][c]= value;
+    fb_dmin[r]= 0xff;
+    fb_dmax[r]= 0;
+  }
+}
+
+/*  ---------------------------------------------------------
+                            oled_flush
+
+     sendet die geaenderten Spalten des Framebuffers, je
+     Page ein Adresskommando und ein Datenblock
+    --------------------------------------------------------- */
+void oled_flush(void)
+{
+  uint8_t r, x;
+
+  for (r= 0; r< oled_fbwin_rows; r++)
+  {
+    if (fb_dmin[r] > fb_dmax[r]) continue;
+
+    x= (oled_fbwin_x * 8) + fb_dmin[r];
+
+    oled_sync();
+    i2c_start(ssd1306_addr);
+    i2c_write(0x00);
+    i2c_write(0xb0 | ((7 - (oled_fbwin_y + r)) & 0x0f));
+    i2c_write(0x10 | (x >> 4 & 0x0f));
+    i2c_write(x & 0x0f);
+    i2c_stop();
+
+    i2c_write_buf(ssd1306_addr, 0x40, &fb[r][fb_dmin[r]], fb_dmax[r] - fb_dmin[r] + 1);
+
+    fb_dmin[r]= 0xff;
+    fb_dmax[r]= 0;
+  }
+  fb_posinvalid= 1;
 }
 
+#endif
+
 
 /*  ---------------------------------------------------------
                            clrscr
@@ -118,6 +280,52 @@ void gotoxy(uint8_t x, uint8_t y)
     --------------------------------------------------------- */
 void clrscr(void)
 {
+#if (oled_async == 1)
+
+  // Horizontaler Adressmodus: der gesamte Displayspeicher wird mit einem
+  // einzigen Fuelleintrag (1024 Bytes) im Hintergrund beschrieben
+
+  i2c_async_start(ssd1306_addr);
+  i2c_async_write(0x00);
+
+  i2c_async_write(0x8d);            // Ladungspumpe an
+  i2c_async_write(0x14);
+  i2c_async_write(0xaf);            // Display on
+  i2c_async_write(0xa1);            // Segment Map
+  i2c_async_write(0xc0);            // Direction Map
+
+  i2c_async_write(0x20);            // horizontaler Adressmodus
+  i2c_async_write(0x00);
+  i2c_async_write(0x21);            // Spalten 0..127
+  i2c_async_write(0x00);
+  i2c_async_write(0x7f);
+  i2c_async_write(0x22);            // Pages 0..7
+  i2c_async_write(0x00);
+  i2c_async_write(0x07);
+  i2c_async_stop();
+
+  i2c_async_start(ssd1306_addr);
+  i2c_async_write(0x40);
+  if (bkcolor) i2c_async_fill(0xff, 1024); else i2c_async_fill(0x00, 1024);
+  i2c_async_stop();
+
+  i2c_async_start(ssd1306_addr);
+  i2c_async_write(0x00);
+  i2c_async_write(0x20);            // zurueck in den Page-Adressmodus
+  i2c_async_write(0x02);
+  i2c_async_write(0xb7);            // entspricht gotoxy(0,0)
+  i2c_async_write(0x10);
+  i2c_async_write(0x00);
+  i2c_async_stop();
+
+  aktxp= 0;
+  aktyp= 0;
+  #if (oled_framebuffer == 1)
+    fb_posinvalid= 0;
+  #endif
+
+#else
+
   uint8_t x,y;
 
   i2c_start(ssd1306_addr);
@@ -157,6 +365,12 @@ void clrscr(void)
 
   }
   gotoxy(0,0);
+
+#endif
+
+#if (oled_framebuffer == 1)
+  if (bkcolor) fb_clear(0xff); else fb_clear(0x00);
+#endif
 }
 
 /*  ---------------------------------------------------------
@@ -178,6 +392,8 @@ void oled_putchar(uint8_t ch)
 
   if (ch== 0) return;
 
+  oled_sync();
+
   if (ch== 13)                                          // Fuer <printf> "/r" Implementation
   {
     aktxp= 0;
@@ -200,6 +416,15 @@ void oled_putchar(uint8_t ch)
       aktxp--;
       gotoxy(aktxp, aktyp);
 
+      #if (oled_framebuffer == 1)
+        if (fb_inwin(aktxp, aktyp))
+        {
+          for (i= 0; i< 8; i++) fb_putbyte(aktxp, aktyp, i, (!textcolor) ? 0xff : 0x00);
+          return;
+        }
+      #endif
+
+      fb_syncpos();
       i2c_start(ssd1306_addr);
       i2c_write(0x40);
       for (i= 0; i< 8; i++)
@@ -218,7 +443,7 @@ void oled_putchar(uint8_t ch)
     for (i= 0; i< 8; i++)
     {
       // Zeichen auf ein 16x16 Zeichen vergroessern
-      z1= pgm_read_byte(&(font8x8h[ch-' '][i]));
+      z1= font8x8h_byte(ch, i);
       z2[i]= 0;
       for (b= 0; b< 8; b++)
       {
@@ -230,6 +455,34 @@ void oled_putchar(uint8_t ch)
       }
     }
 
+    #if (oled_framebuffer == 1)
+      // Zeichen vollstaendig im Fenster: 2x2 Zeichenpositionen im Puffer
+      if (fb_inwin(aktxp, aktyp) && fb_inwin(aktxp+1, aktyp+1))
+      {
+        for (i= 0; i< 8; i++)
+        {
+          z= z2[i];
+          if ((!textcolor)) z= ~z;
+          b= i*2;
+          fb_putbyte(aktxp + (b >> 3), aktyp, b & 7, z >> 8);
+          fb_putbyte(aktxp + (b >> 3), aktyp, (b & 7) + 1, z >> 8);
+          fb_putbyte(aktxp + (b >> 3), aktyp+1, b & 7, z);
+          fb_putbyte(aktxp + (b >> 3), aktyp+1, (b & 7) + 1, z);
+        }
+        aktxp +=2;
+        if (aktxp> 15)
+        {
+          aktxp= 0;
+          aktyp +=2;
+        }
+        gotoxy(aktxp,aktyp);
+        return;
+      }
+    #endif
+
+    // teilweise im Fenster liegende Zeichen werden direkt gesendet und
+    // mit fb_sent in den Framebuffer uebernommen
+    fb_syncpos();
     i2c_start(ssd1306_addr);
     i2c_write(0x40);
     for (i= 0; i< 8; i++)
@@ -239,9 +492,12 @@ void oled_putchar(uint8_t ch)
       z= z >> 8;
       i2c_write(z);
       i2c_write(z);
+      fb_sent((aktxp * 8) + (i * 2), aktyp, z);
+      fb_sent((aktxp * 8) + (i * 2) + 1, aktyp, z);
     }
     i2c_stop();
     gotoxy(aktxp, aktyp+1);
+    fb_syncpos();
 
     i2c_start(ssd1306_addr);
     i2c_write(0x40);
@@ -252,6 +508,8 @@ void oled_putchar(uint8_t ch)
       z= z & 0xff;
       i2c_write(z);
       i2c_write(z);
+      fb_sent((aktxp * 8) + (i * 2), aktyp, z);
+      fb_sent((aktxp * 8) + (i * 2) + 1, aktyp, z);
     }
     i2c_stop();
 
@@ -266,15 +524,44 @@ void oled_putchar(uint8_t ch)
   }
   else
   {
+    #if (oled_framebuffer == 1)
+      if (fb_inwin(aktxp, aktyp))
+      {
+        for (i= 0; i< 8; i++)
+        {
+          b= font8x8h_byte(ch, i);
+          if ((!textcolor)) b= ~b;
+          fb_putbyte(aktxp, aktyp, i, b);
+        }
+        aktxp++;
+        if (aktxp> 15)
+        {
+          aktxp= 0;
+          aktyp++;
+        }
+        gotoxy(aktxp,aktyp);
+        return;
+      }
+    #endif
 
-    i2c_start(ssd1306_addr);
-    i2c_write(0x40);
-    for (i= 0; i< 8; i++)
+    fb_syncpos();
+    #if (font8x8h_compressed == 0)
+      if (textcolor)
+      {
+        i2c_write_buf_P(ssd1306_addr, 0x40, &font8x8h[ch-' '][0], 8);
+      }
+      else
+    #endif
     {
-      if ((!textcolor)) i2c_write(~(pgm_read_byte(&(font8x8h[ch-' '][i]))));
-                   else i2c_write(pgm_read_byte(&(font8x8h[ch-' '][i])));
+      i2c_start(ssd1306_addr);
+      i2c_write(0x40);
+      for (i= 0; i< 8; i++)
+      {
+        if (textcolor) i2c_write(font8x8h_byte(ch, i));
+                  else i2c_write(~(font8x8h_byte(ch, i)));
+      }
+      i2c_stop();
     }
-    i2c_stop();
     aktxp++;
     if (aktxp> 15)
     {
@@ -285,3 +572,53 @@ void oled_putchar(uint8_t ch)
   }
 }
 
+#if (bitmap_enable == 1)
+
+/*  ---------------------------------------------------------
+                           oled_blit_P
+
+      gibt eine mit imgconv erzeugte Bitmap (Format
+      BMP_PAGER, Bit 7 = oben, auch RLE komprimiert) aus
+      dem Flash aus. Je Page ein Adresskommando und ein
+      Datenblock, die Bilddaten kommen ohne Puffer aus dem
+      Decoder. Bytes im Fenster des Framebuffers werden
+      in den Puffer uebernommen.
+
+        x     : linke Spalte (Pixel)
+        page  : obere Page (0 = oben, wie gotoxy)
+        image : Bitmap (bitmap_p.h)
+    --------------------------------------------------------- */
+void oled_blit_P(uint8_t x, uint8_t page, const uint8_t *image)
+{
+  uint8_t w, p, pages, i, b;
+
+  if (bmp_format(image) != BMP_PAGER) return;
+
+  w= bmp_width(image);
+  pages= bmp_height(image) >> 3;
+  bmp_start(image);
+
+  for (p= 0; p< pages; p++)
+  {
+    oled_sync();
+    i2c_start(ssd1306_addr);
+    i2c_write(0x00);
+    i2c_write(0xb0 | ((7 - (page + p)) & 0x0f));
+    i2c_write(0x10 | (x >> 4 & 0x0f));
+    i2c_write(x & 0x0f);
+    i2c_stop();
+
+    i2c_start(ssd1306_addr);
+    i2c_write(0x40);
+    for (i= 0; i< w; i++)
+    {
+      b= bmp_getbyte();
+      i2c_write(b);
+      fb_sent(x + i, page + p, b);
+    }
+    i2c_stop();
+  }
+  gotoxy(aktxp, aktyp);
+}
+
+#endif
@@ -76,68 +76,6 @@ uint8_t doublechar;
 uint8_t bkcolor= 0;
 uint8_t textcolor= 1;
 
-/* -------------------------------------------------------------
-                           spi_init
-
-     Anschlusspins des SPI-Interface konfigurieren
-   ------------------------------------------------------------- */
-void spi_init(void)
-{
-  sw_mosiinit();
-  sw_csinit();
-  sw_resinit();
-  sw_dcinit();
-  sw_sckinit();
-}
-
-
-#if (hardware_spi == 0)
-
-  /* -----------------------------------------------------
-                             spi_out
-
-          Byte ueber Software SPI senden / empfangen
-          data ==> zu sendendes Datum
-     ----------------------------------------------------- */
-  void spi_out(uint8_t value)
-  {
-    char a;
-
-    for (a= 0; a< 8; a++)
-    {
-      if((value & 0x80)> 0) { mosi_set(); }
-                       else { mosi_clr(); }
-      // Taktimpuls erzeugen
-      sck_set();
-      sck_clr();
-      value= value << 1;
-    }
-  }
-#endif
-
-#if (hardware_spi == 1)
-
-  /* -------------------------------------------------------------
-                             spi_out
-
-        Byte ueber USI Hardware senden / empfangen
-        data ==> zu sendendes Datum
-     ------------------------------------------------------------- */
-  unsigned char spi_out(uint8_t data)
-  {
-    volatile uint8_t r;
-
-    USIDR = data;
-    USISR = (1 << USIOIF);
-
-    while ( (USISR & (1 << USIOIF)) == 0 )
-    {
-      USICR = (1 << USIWM0) | (1 << USICS1) | (1 << USICLK) | (1 << USITC);
-    }
-    return USIDR;
-  }
-#endif
-
 
 /*  ---------------------------------------------------------
                         ssd1306_init
@@ -145,7 +83,10 @@ void spi_init(void)
     --------------------------------------------------------- */
 void ssd1306_init(void)
 {
-  spi_init();
+  spi_init();                   // MOSI, SCK (usi_spi.c)
+  sw_csinit();
+  sw_resinit();
+  sw_dcinit();
 
   oled_enable();
   delay(10);
@@ -204,6 +145,10 @@ void oled_setxybyte(uint8_t x, uint8_t y, uint8_t value)
 void clrscr(void)
 {
   uint8_t x,y;
+  uint8_t fill;
+  USI_SPI_DECL
+
+  fill= bkcolor ? 0xff : 0x00;
 
   oled_enable();
 
@@ -235,7 +180,7 @@ void clrscr(void)
     oled_datamode();
     for (x= 0; x< 128; x++)
     {
-      if (bkcolor) spi_out(0xff); else spi_out(0x00);
+      spi_fast(fill);
     }
   }
 
@@ -333,7 +278,7 @@ void oled_putchar(uint8_t ch)
     for (i= 0; i< 8; i++)
     {
       // Zeichen auf ein 16x16 Zeichen vergroessern
-      z1= pgm_read_byte(&(font8x8h[ch-' '][i]));
+      z1= font8x8h_byte(ch, i);
       z2[i]= 0;
       for (b= 0; b< 8; b++)
       {
@@ -375,8 +320,8 @@ void oled_putchar(uint8_t ch)
   {
     for (i= 0; i< 8; i++)
     {
-      if ((!textcolor)) spi_out(~(pgm_read_byte(&(font8x8h[ch-' '][i]))));
-                   else spi_out(pgm_read_byte(&(font8x8h[ch-' '][i])));
+      if ((!textcolor)) spi_out(~(font8x8h_byte(ch, i)));
+                   else spi_out(font8x8h_byte(ch, i));
     }
     aktxp++;
     if (aktxp> 15)
@@ -406,3 +351,75 @@ uint8_t reversebyte(uint8_t value)
   return hb;
 }
 
+#if (stripout_enable == 1)
+
+  static const uint8_t nibrev[16] PROGMEM =
+    { 0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf };
+
+  /*  ---------------------------------------------------------
+                           oled_stripout
+
+         gibt einen Streifen aus strip_render.c aus. Die Page
+         wird einmal adressiert, danach werden alle Spalten
+         am Stueck gesendet.
+
+         Das Display ist (wie bei gotoxy) auf dem Kopf
+         montiert: Pagereihenfolge und Bitreihenfolge inner-
+         halb eines Bytes sind gegenueber dem Streifenpuffer
+         (Bit 0 = oben) vertauscht.
+
+           page  : 0 = oberster Streifen
+           buf   : Streifenpuffer
+           width : Anzahl Spalten
+      --------------------------------------------------------- */
+  void oled_stripout(uint8_t page, uint8_t *buf, uint8_t width)
+  {
+    uint8_t b;
+    USI_SPI_DECL
+
+    oled_setpageadr(0, page);
+    while (width--)
+    {
+      b= *buf++;
+      spi_fast((pgm_read_byte(&nibrev[b & 0x0f]) << 4) | pgm_read_byte(&nibrev[b >> 4]));
+    }
+    gotoxy(aktxp, aktyp);
+  }
+
+#endif
+
+#if (bitmap_enable == 1)
+
+  /*  ---------------------------------------------------------
+                           oled_blit_P
+
+         gibt eine mit imgconv erzeugte Bitmap (Format
+         BMP_PAGER, Bit 7 = oben, auch RLE komprimiert) aus
+         dem Flash aus. Je Page wird einmal adressiert, die
+         Bilddaten werden ohne Puffer aus dem Decoder
+         gesendet.
+
+           x     : linke Spalte (Pixel)
+           page  : obere Page (0 = oben, wie gotoxy)
+           image : Bitmap (bitmap_p.h)
+      --------------------------------------------------------- */
+  void oled_blit_P(uint8_t x, uint8_t page, const uint8_t *image)
+  {
+    uint8_t w, p, pages, i;
+    USI_SPI_DECL
+
+    if (bmp_format(image) != BMP_PAGER) return;
+
+    w= bmp_width(image);
+    pages= bmp_height(image) >> 3;
+    bmp_start(image);
+
+    for (p= 0; p< pages; p++)
+    {
+      oled_setpageadr(x, page + p);
+      for (i= 0; i< w; i++) spi_fast(bmp_getbyte());
+    }
+    gotoxy(aktxp, aktyp);
+  }
+
+#endif
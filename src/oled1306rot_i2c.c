@@ -243,18 +243,20 @@ void oled_putchar(uint8_t ch)
     ox= aktxp;
     gotoxy(aktxp + 2, aktyp);
 
+    // Zeichen auf ein 16x16 Zeichen vergroessern. Die Bytes werden der
+    // Reihe nach gelesen (ein komprimierter Zeichensatz wird dann nur
+    // einmal dekodiert) und gespiegelt abgelegt
     for (i= 0; i< 8; i++)
     {
-      // Zeichen auf ein 16x16 Zeichen vergroessern
-      z1= pgm_read_byte(&(font8x8h[ch-' '][7-i]));
+      z1= font8x8h_byte(ch, i);
       z1= reversebyte(z1);
-      z2[i]= 0;
+      z2[7-i]= 0;
       for (b= 0; b< 8; b++)
       {
         if (z1 & (1 << b))
         {
-          z2[i] |= (1 << (b*2));
-          z2[i] |= (1 << ((b*2)+1));
+          z2[7-i] |= (1 << (b*2));
+          z2[7-i] |= (1 << ((b*2)+1));
         }
       }
     }
@@ -298,14 +300,17 @@ void oled_putchar(uint8_t ch)
   else                          // nicht doublechar
   {
     ox= aktxp;
+
+    // Bytes der Reihe nach lesen (s.o.), gespiegelt ausgeben
+    for (i= 0; i< 8; i++) z2[7-i]= font8x8h_byte(ch, i);
+
     gotoxy(aktxp + 1, aktyp);
     i2c_start(ssd1306_addr);
     i2c_write(0x40);
 
     for (i= 0; i< 8; i++)
     {
-      outbyte= pgm_read_byte( &(font8x8h[ch-' '][7-i]) );
-      outbyte= reversebyte(outbyte);
+      outbyte= reversebyte(z2[i]);
       if ((!textcolor)) i2c_write(~(outbyte) );
                    else i2c_write(outbyte);
     }
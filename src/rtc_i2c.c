@@ -135,23 +135,33 @@ uint8_t rtc_getwtag(struct my_datum *date)
       rtc_readdate
 
       liest den DS1307 Baustein in eine Struktur
-      my_datum ein.
+      my_datum ein. Die Register 0..6 werden in
+      einer einzigen I2C-Transaktion gelesen.
 
       Rueckgabe:
           Werte der gelesenen RTC in der Struktur
-          my_datum
+          my_datum. Antwortet der Baustein nicht
+          (NACK, Timeout, Bus blockiert), sind alle
+          Werte 0, die Ursache steht in i2c_error
    -------------------------------------------------- */
 struct my_datum rtc_readdate(void)
 {
   struct my_datum date;
+  uint8_t reg[7];
+  uint8_t i;
 
-  date.sek= rtc_read(0) & 0x7f;
-  date.min= rtc_read(1) & 0x7f;
-  date.std= rtc_read(2) & 0x3f;
-  date.tag= rtc_read(4) & 0x3f;
-  date.monat= rtc_read(5) & 0x1f;
-  date.jahr= rtc_read(6);
-  date.dow= rtc_getwtag(&date);
+  if (!i2c_read_buf(rtc_addr, 0, reg, 7) || (i2c_error >= I2C_ERR_TIMEOUT))
+  {
+    for (i= 0; i< 7; i++) reg[i]= 0;
+  }
+
+  date.sek= reg[0] & 0x7f;
+  date.min= reg[1] & 0x7f;
+  date.std= reg[2] & 0x3f;
+  date.tag= reg[4] & 0x3f;
+  date.monat= reg[5] & 0x1f;
+  date.jahr= reg[6];
+  date.dow= (date.tag) ? rtc_getwtag(&date) : 0;
 
   return date;
 }
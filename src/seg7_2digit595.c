@@ -18,6 +18,7 @@
    ---------------------------------------------------------- */
 
 #include "seg7_2digit595.h"
+#include "bcd_conv.h"
 
 
 // Bitmapmuster der Ziffern
@@ -113,8 +114,7 @@ void digit2_init(void)
    ---------------------------------------------------------- */
 void digit2_dezout(uint8_t value)
 {
-  digit2_value= value % 10;
-  digit2_value |= ((value /10) << 4);
+  digit2_value= bcd_8bit(value);
 }
 
 /* ----------------------------------------------------------
@@ -70,6 +70,7 @@
 */
 
 #include "seg7_hc595.h"
+#include "bcd_conv.h"
 
 // Pufferspeicher der anzuzeigenden Ziffern
 uint8_t seg7_4digit[4] = { 0xff, 0xff, 0xff, 0xff };
@@ -155,14 +156,14 @@ void digit4_outbyte(uint8_t value)
     --------------------------------------------------------- */
 void digit4_setdez(int value)
 {
-  uint8_t i,v;
+  uint8_t i;
+  uint8_t dig[4];
 
+  bcd_dig16(value, dig, 4);
   for (i= 0; i< 4; i++)
   {
-    v= value % 10;
     seg7_4digit[i] &= 0x80;             // eventuellen DP belassen
-    seg7_4digit[i] |= (~led7sbmp[v]) & 0x7f;
-    value= value / 10;
+    seg7_4digit[i] |= (~led7sbmp[dig[3-i]]) & 0x7f;
   }
 }
 
@@ -177,10 +178,11 @@ void digit4_setdez(int value)
     --------------------------------------------------------- */
 void digit4_setdez8bit(uint8_t value, uint8_t pos)
 {
+    value= bcd_8bit(value);
     seg7_4digit[1+pos] &= 0x80;             // eventuellen DP belassen
     seg7_4digit[0+pos] &= 0x80;             // eventuellen DP belassen
-    seg7_4digit[1+pos] |= (~led7sbmp[value / 10]) & 0x7f;
-    seg7_4digit[0+pos] |= (~led7sbmp[value % 10]) & 0x7f;
+    seg7_4digit[1+pos] |= (~led7sbmp[value >> 4]) & 0x7f;
+    seg7_4digit[0+pos] |= (~led7sbmp[value & 0x0f]) & 0x7f;
 }
 
 /*  -------------------- DIGIT4_SETHEX ---------------------
@@ -58,6 +58,7 @@
 */
 
 #include "seg7_tm1637.h"
+#include "bcd_conv.h"
 
 /* ----------------------------------------------------------
                      Globale Variable
@@ -227,13 +228,13 @@ void tm1637_setseg(uint8_t pos, uint8_t seg)
     --------------------------------------------------------- */
 void tm1637_setdez(int value)
 {
-  uint8_t i,v;
+  uint8_t i;
+  uint8_t dig[4];
 
-  for (i= 4; i> 0; i--)
+  bcd_dig16(value, dig, 4);
+  for (i= 0; i< 4; i++)
   {
-    v= value % 10;
-    tm1637_setbmp(i-1, led7sbmp[v]);
-    value= value / 10;
+    tm1637_setbmp(i, led7sbmp[dig[i]]);
   }
 }
 
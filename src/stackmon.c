@@ -0,0 +1,86 @@
+/* ------------------------------------------------------------------
+                              stackmon.c
+
+     Stackueberwachung durch "Bemalen" des freien RAM's
+     (Beschreibung siehe stackmon.h)
+
+     MCU   : ATtiny44
+
+     17.10.2026 agent
+   ------------------------------------------------------------------ */
+
+#include "stackmon.h"
+
+#if defined(in_host_hal)
+
+  // auf dem PC (../host) gibt es keinen AVR-Stack
+  uint16_t stack_unused(void)    { return 0; }
+  uint16_t stack_highwater(void) { return 0; }
+
+#else
+
+  extern uint8_t _end;                  // Ende von .bss (avr-libc Linkerskript)
+  extern uint8_t __stack;               // oberstes RAM-Byte (RAMEND)
+
+  #define str(x)        #x
+  #define xstr(x)       str(x)
+
+  /* --------------------------------------------------------
+                          stack_paint
+
+       fuellt das freie RAM mit STACK_CANARY. Laeuft in .init3
+       (Stackzeiger und r1 = 0 sind gesetzt, .data und .bss
+       noch nicht initialisiert), daher nur Assembler ohne
+       Stackbenutzung und ohne Operanden (naked).
+     -------------------------------------------------------- */
+  void stack_paint(void) __attribute__ ((naked, used, section (".init3")));
+
+  void stack_paint(void)
+  {
+    __asm volatile
+    (
+      "    ldi  r30, lo8(_end)      \n\t"
+      "    ldi  r31, hi8(_end)      \n\t"
+      "    ldi  r24, " xstr(STACK_CANARY) "   \n\t"
+      "    ldi  r25, hi8(__stack)   \n\t"
+      "    rjmp 2f                  \n\t"
+      "1:  st   Z+, r24             \n\t"
+      "2:  cpi  r30, lo8(__stack)   \n\t"
+      "    cpc  r31, r25            \n\t"
+      "    brlo 1b                  \n\t"
+      "    breq 1b                  \n\t"
+    );
+  }
+
+  /* --------------------------------------------------------
+                          stack_unused
+
+       zaehlt die noch unveraenderten Bytes ab dem Ende von
+       .bss
+     -------------------------------------------------------- */
+  uint16_t stack_unused(void)
+  {
+    const uint8_t *p;
+    uint16_t      cnt;
+
+    p= &_end;
+    cnt= 0;
+    while ((p <= &__stack) && (*p == STACK_CANARY))
+    {
+      p++;
+      cnt++;
+    }
+    return cnt;
+  }
+
+  /* --------------------------------------------------------
+                          stack_highwater
+
+       groesste bisher benutzte Stacktiefe in Bytes
+     -------------------------------------------------------- */
+  uint16_t stack_highwater(void)
+  {
+    return (uint16_t)(&__stack - &_end) + 1 - stack_unused();
+  }
+
+#endif
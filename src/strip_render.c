@@ -0,0 +1,282 @@
+/* -----------------------------------------------------
+                        strip_render.c
+
+    Streifen-Rendering (partieller Framebuffer) fuer
+    Displays, deren Bildspeicher nicht in das RAM passt
+
+    Die Szene wird vom Hauptprogramm in strip_draw ge-
+    zeichnet. Fuer jeden 8 Pixel hohen Streifen wird der
+    Puffer geloescht, strip_draw aufgerufen und der
+    Streifen mit strip_output am Stueck zum Display
+    geschickt. Die Zeichenfunktionen verwerfen alles,
+    was ausserhalb des aktuellen Streifens liegt.
+
+    Gegenueber putpixel (Adressierung fuer jeden Punkt)
+    entfaellt die Adressierung je Pixel, Ueberzeichnen
+    (Text ueber Linien etc.) ist moeglich, ohne dass
+    Zwischenzustaende sichtbar werden.
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include <string.h>
+
+#include "strip_render.h"
+
+#if ((strip_yres & 7) != 0) || (strip_yres > 256) || (strip_xres > 255)
+  #error "strip_yres muss ein Vielfaches von 8 sein, max. 255 x 256 Pixel"
+#endif
+
+#if (strip_font == 1)
+  #define strip_lastascii       lastascii
+  #define strip_fontbytes       5
+#elif (strip_font == 2)
+  #define strip_lastascii       130
+  #define strip_fontbytes       8
+#endif
+
+/* -------------------------------------------------------
+                       Variable
+   ------------------------------------------------------- */
+
+uint8_t strip_buf[strip_xres];
+uint8_t strip_y0;
+uint8_t strip_bkcolor= 0;
+
+void (*strip_draw)(void) = 0;
+void (*strip_output)(uint8_t page, uint8_t *buf, uint8_t width) = 0;
+
+
+/* -------------------------------------------------------
+                      strip_apply
+
+     setzt, loescht oder invertiert die in mask gesetzten
+     Bits der Pufferspalte x
+   ------------------------------------------------------- */
+static inline void strip_apply(uint8_t x, uint8_t mask, uint8_t col)
+{
+  if (col == 1)      strip_buf[x] |= mask;
+  else if (col == 0) strip_buf[x] &= ~mask;
+  else               strip_buf[x] ^= mask;
+}
+
+/* -------------------------------------------------------
+                      strip_renderrows
+
+     zeichnet alle Streifen, die Pixelzeilen aus dem
+     Bereich y1..y2 enthalten
+   ------------------------------------------------------- */
+void strip_renderrows(uint8_t y1, uint8_t y2)
+{
+  uint8_t page, lastpage;
+
+  if (!strip_output) return;                          // keine Ausgabefunktion gesetzt
+  if (y2 >= strip_yres) y2= strip_yres-1;
+  page= y1 >> 3;
+  lastpage= y2 >> 3;
+
+  while (page <= lastpage)
+  {
+    strip_y0= page << 3;
+    memset(strip_buf, strip_bkcolor ? 0xff : 0x00, strip_xres);
+    if (strip_draw) strip_draw();
+    strip_output(page, strip_buf, strip_xres);
+    page++;
+  }
+}
+
+/* -------------------------------------------------------
+                      strip_render
+
+     zeichnet das gesamte Display
+   ------------------------------------------------------- */
+void strip_render(void)
+{
+  strip_renderrows(0, strip_yres-1);
+}
+
+/* -------------------------------------------------------
+                      strip_fillrect
+
+     fuellt ein Rechteck. Fuer den aktuellen Streifen
+     ergibt sich eine einzige Bitmaske, die auf alle
+     Spalten x1..x2 angewendet wird
+   ------------------------------------------------------- */
+void strip_fillrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  int16_t  tmp;
+  uint8_t  x, xe, mask;
+
+  if (x1 > x2) { tmp= x1; x1= x2; x2= tmp; }
+  if (y1 > y2) { tmp= y1; y1= y2; y2= tmp; }
+
+  // auf Display und Streifen begrenzen
+  if ((x2 < 0) || (x1 >= strip_xres)) return;
+  if ((y2 < strip_y0) || (y1 > strip_y0+7)) return;
+  if (x1 < 0) x1= 0;
+  if (x2 >= strip_xres) x2= strip_xres-1;
+  if (y1 < strip_y0) y1= strip_y0;
+  if (y2 > strip_y0+7) y2= strip_y0+7;
+
+  mask= (0xff << (uint8_t)(y1 - strip_y0)) & (0xff >> (uint8_t)(strip_y0 + 7 - y2));
+
+  xe= x2;
+  for (x= x1; ; x++)
+  {
+    strip_apply(x, mask, col);
+    if (x == xe) break;
+  }
+}
+
+/* -------------------------------------------------------
+                  strip_putpixel / hline / vline
+   ------------------------------------------------------- */
+void strip_putpixel(int16_t x, int16_t y, uint8_t col)
+{
+  uint8_t r;
+
+  if ((x < 0) || (x >= strip_xres)) return;
+  r= (uint8_t)(y - strip_y0);
+  if ((y < strip_y0) || (r > 7)) return;
+
+  strip_apply(x, 1 << r, col);
+}
+
+void strip_hline(int16_t x1, int16_t x2, int16_t y, uint8_t col)
+{
+  strip_fillrect(x1, y, x2, y, col);
+}
+
+void strip_vline(int16_t x, int16_t y1, int16_t y2, uint8_t col)
+{
+  strip_fillrect(x, y1, x, y2, col);
+}
+
+/* -------------------------------------------------------
+                      strip_line
+
+     Linie nach Bresenham. Die Linie wird immer von oben
+     nach unten gezeichnet, so dass die Berechnung ab-
+     gebrochen werden kann, sobald der Streifen ver-
+     lassen wird
+   ------------------------------------------------------- */
+void strip_line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  int16_t dx, dy, sx, err, e2, tmp, ybot;
+
+  if (y1 == y2) { strip_hline(x1, x2, y1, col); return; }
+  if (x1 == x2) { strip_vline(x1, y1, y2, col); return; }
+
+  if (y1 > y2)
+  {
+    tmp= x1; x1= x2; x2= tmp;
+    tmp= y1; y1= y2; y2= tmp;
+  }
+
+  ybot= strip_y0 + 7;
+  if ((y2 < strip_y0) || (y1 > ybot)) return;
+
+  dx= x2 - x1;
+  sx= 1;
+  if (dx < 0) { dx= -dx; sx= -1; }
+  dy= y1 - y2;                                        // negativ
+  err= dx + dy;
+
+  for (;;)
+  {
+    strip_putpixel(x1, y1, col);
+    if ((x1 == x2) && (y1 == y2)) break;
+    e2= 2 * err;
+    if (e2 >= dy) { err += dy; x1 += sx; }
+    if (e2 <= dx)
+    {
+      err += dx;
+      y1++;
+      if (y1 > ybot) break;                           // Streifen verlassen
+    }
+  }
+}
+
+/* -------------------------------------------------------
+                      strip_rect
+   ------------------------------------------------------- */
+void strip_rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t col)
+{
+  strip_hline(x1, x2, y1, col);
+  strip_hline(x1, x2, y2, col);
+  strip_vline(x1, y1, y2, col);
+  strip_vline(x2, y1, y2, col);
+}
+
+#if (strip_font != 0)
+
+  #if (strip_font == 2)
+
+    // font8x8h hat Bit 7 als oberste Pixelzeile: Bitreihenfolge umdrehen
+    static const uint8_t nibrev[16] PROGMEM =
+      { 0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf };
+
+    static uint8_t strip_revbyte(uint8_t b)
+    {
+      return (pgm_read_byte(&nibrev[b & 0x0f]) << 4) | pgm_read_byte(&nibrev[b >> 4]);
+    }
+
+  #endif
+
+  /* -------------------------------------------------------
+                        strip_putchar
+
+       zeichnet ein Zeichen mit linker oberer Ecke x,y.
+       Ein Zeichen kann auf 2 Streifen verteilt sein, die
+       Fontspalte wird dazu um den Abstand zum Streifen-
+       anfang verschoben. Der Hintergrund bleibt erhalten.
+     ------------------------------------------------------- */
+  int16_t strip_putchar(int16_t x, int16_t y, uint8_t ch, uint8_t col)
+  {
+    int16_t  ofs;
+    uint8_t  i, b;
+
+    ofs= y - strip_y0;
+    if ((ofs <= -8) || (ofs >= 8)) return x + strip_fontx;
+
+    if ((ch < 32) || (ch > strip_lastascii)) ch= 92;
+
+    for (i= 0; i< strip_fontbytes; i++, x++)
+    {
+      if ((x < 0) || (x >= strip_xres)) continue;
+      #if (strip_font == 1)
+        b= font5x7_byte(ch, i);
+      #else
+        b= strip_revbyte(font8x8h_byte(ch, i));
+      #endif
+      if (ofs >= 0) b <<= (uint8_t)ofs;
+               else b >>= (uint8_t)(-ofs);
+      if (b) strip_apply(x, b, col);
+    }
+    return x + (strip_fontx - strip_fontbytes);
+  }
+
+  /* -------------------------------------------------------
+                  strip_putstring / strip_putstring_P
+     ------------------------------------------------------- */
+  int16_t strip_putstring(int16_t x, int16_t y, char *s, uint8_t col)
+  {
+    while (*s)
+    {
+      x= strip_putchar(x, y, *s++, col);
+    }
+    return x;
+  }
+
+  int16_t strip_putstring_P(int16_t x, int16_t y, const char *s, uint8_t col)
+  {
+    uint8_t c;
+
+    for (c= pgm_read_byte(s); c; ++s, c= pgm_read_byte(s)) x= strip_putchar(x, y, c, col);
+    return x;
+  }
+
+#endif
@@ -271,69 +271,6 @@ uint8_t  fntfilled = 1;         // gibt an, ob eine Zeichenausgabe ueber einen H
 
 
 
-/* -------------------------------------------------------------
-   SPI_INIT
-
-     Anschlusspins des SPI-Interface konfigurieren
-   ------------------------------------------------------------- */
-void spi_init(void)
-{
-  mosi_init();
-  clk_init();
-  ce_init();
-}
-
-
-#if (hardware_spi == 1)
-
-  /* -------------------------------------------------------------
-     SPI_OUT
-
-        Byte ueber USI Hardware senden / empfangen
-        data ==> zu sendendes Datum
-     ------------------------------------------------------------- */
-  uint8_t spi_out(uint8_t data)
-  {
-    volatile uint8_t r;
-
-    USIDR = data;
-    USISR = (1 << USIOIF);
-
-    while ( (USISR & (1 << USIOIF)) == 0 )
-    {
-      USICR = (1 << USIWM0) | (1 << USICS1) | (1 << USICLK) | (1 << USITC);
-    }
-    return USIDR;
-  }
-#endif
-
-#if (hardware_spi == 0)
-
-  /* -------------------------------------------------------------
-     SPI_OUT
-
-        Byte ueber Software SPI senden / empfangen
-        data ==> zu sendendes Datum
-     ------------------------------------------------------------- */
-  uint8_t spi_out(uint8_t data)
-  {
-    char a;
-
-    for (a=0;a<8;a++)
-    {
-      if((data & 0x80)> 0) mosi_set(); else mosi_clr();
-
-      clk_set();                          // Taktleitung auf 1
-      clk_clr();                          // und wieder auf 0
-
-      data <<= 1;
-    }
-
-  }
-
-#endif
-
-
 /* -------------------------------------------------------------
    spi_lcdout
 
@@ -352,6 +289,14 @@ void spi_lcdout(uint8_t data)
   #endif
 }
 
+// Byte im Burst senden (ausgerollter USI-Takt aus usi_spi.h), ggf. mit
+// Wartezyklus fuer langsame Controller
+#if ( (ili9225 ==1) | (tft_wait == 1))
+  #define tft_fast(b)     { spi_fast(b); __asm volatile ("nop\n\r"); }
+#else
+  #define tft_fast(b)     spi_fast(b)
+#endif
+
 /* -------------------------------------------------------------
      wrcmd
 
@@ -403,6 +348,54 @@ void wrdata16(int data)
     spi_lcdout(data2);
 }
 
+#if (_yres == 128)
+  #define tft_ramyofs     (32+_lcyofs)              // erste sichtbare Zeile im Display-Ram
+#else
+  #define tft_ramyofs     0
+#endif
+
+#if (tft_scroll == 1)
+
+  #if (ili9225 == 1)
+    #error "tft_scroll ist fuer ili9225 nicht verfuegbar"
+  #endif
+
+  static uint16_t scrollofs = 0;                  // Verschiebung zwischen Y-Koordinate und Ram-Zeile
+
+  /* ----------------------------------------------------------
+       scroll_y
+
+       rechnet eine (physikalische) Y-Koordinate in die Zeile
+       des Scrollbereichs im Display-Ram um, in der sie bei
+       der aktuellen Scrollposition liegt
+     ---------------------------------------------------------- */
+  static uint16_t scroll_y(uint16_t y)
+  {
+    y += scrollofs;
+    if (y >= _yres) y -= _yres;
+    return y;
+  }
+
+  /* ----------------------------------------------------------
+       scroll_define
+
+       legt den gesamten sichtbaren Bereich als vertikalen
+       Scrollbereich fest (VSCRDEF) und setzt die Scroll-
+       position zurueck (VSCRSADD)
+     ---------------------------------------------------------- */
+  static void scroll_define(void)
+  {
+    scrollofs= 0;
+    wrcmd(vscrdef);
+    wrdata16(tft_ramyofs);                        // feststehender Bereich oben
+    wrdata16(_yres);                              // Scrollbereich
+    wrdata16(tft_gramrows - tft_ramyofs - _yres); // feststehender Bereich unten
+    wrcmd(vscrsadd);
+    wrdata16(tft_ramyofs);
+  }
+
+#endif
+
 /* -------------------------------------------------------------
     lcd_init
 
@@ -453,6 +446,10 @@ void lcd_init()
     }
   }
   ce_clr();
+
+  #if (tft_scroll == 1)
+    scroll_define();
+  #endif
 }
 
 
@@ -463,6 +460,11 @@ void lcd_init()
    ---------------------------------------------------------- */
 void set_ram_address (uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
+  #if (tft_scroll == 1)
+    y2= scroll_y(y1) + (y2 - y1);                 // Fenster darf nicht ueber die
+    y1= scroll_y(y1);                             // Umbruchzeile gehen
+  #endif
+
   wrcmd(coladdr);
   wrdata(x1 >> 8);
   wrdata(x1);
@@ -519,6 +521,10 @@ void setpage(int startpage)
    ---------------------------------------------------------- */
 void setxypos(int x, int y)
 {
+      #if (tft_scroll == 1)
+        y= scroll_y(y);
+      #endif
+
       #if (mirror == 1)
         setcol(_xres-x);
       #else
@@ -535,6 +541,247 @@ void setxypos(int x, int y)
     wrcmd(writereg);
 }
 
+/* ----------------------------------------------------------
+     window_fill
+
+     setzt ein Adressfenster und fuellt es mit einer Farbe.
+     DC wird nur einmal gesetzt, die Farbe im ausgerollten
+     USI-Burst gesendet. Keine Drehung nach outmode und
+     keine Pruefung der Koordinaten !
+
+       x1,y1 : linke obere Ecke im Display-Ram
+       x2,y2 : rechte untere Ecke
+       color : RGB565 Farbwert
+   ---------------------------------------------------------- */
+static void window_fill(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+  uint16_t w, x;
+  uint8_t  colhi, collo;
+  USI_SPI_DECL
+
+  #if (tft_scroll == 1)
+    if (scroll_y(y2) < scroll_y(y1))              // Fenster ueber der Umbruchzeile: teilen
+    {
+      w= _yres - 1 - scroll_y(y1);
+      window_fill(x1, y1, x2, y1 + w, color);
+      y1 += w + 1;
+    }
+  #endif
+
+  w= x2 - x1 + 1;
+  colhi= color >> 8;
+  collo= color & 0xff;
+
+  set_ram_address(x1, y1, x2, y2);
+  dc_set();
+
+  for (; y1 <= y2; y1++)
+  {
+    for (x= w; x; x--)
+    {
+      tft_fast(colhi);
+      tft_fast(collo);
+    }
+  }
+}
+
+/* ----------------------------------------------------------
+     rect_transform
+
+     rechnet die Ecken eines Rechtecks nach outmode in
+     Displaykoordinaten um (wie putpixel), sortiert und
+     begrenzt sie auf das Display
+
+     Rueckgabe: 0 = Rechteck liegt ausserhalb des Displays
+   ---------------------------------------------------------- */
+static uint8_t rect_transform(int *x1, int *y1, int *x2, int *y2)
+{
+  int t1, t2;
+
+  switch (outmode)
+  {
+    case 1  :  t1= *x1; t2= *x2;
+               *x1= *y1; *x2= *y2;
+               *y1= _yres-1-t1; *y2= _yres-1-t2;
+               break;
+    case 2  :  t1= *x1; t2= *x2;
+               *x1= _xres-1-*y1; *x2= _xres-1-*y2;
+               *y1= t1; *y2= t2;
+               break;
+    case 3  :  *x1= _xres-1-*x1; *x2= _xres-1-*x2;
+               *y1= _yres-1-*y1; *y2= _yres-1-*y2;
+               break;
+    default :  break;
+  }
+
+  if (*x1 > *x2) { t1= *x1; *x1= *x2; *x2= t1; }
+  if (*y1 > *y2) { t1= *y1; *y1= *y2; *y2= t1; }
+
+  if ((*x2 < 0) || (*x1 >= _xres) || (*y2 < 0) || (*y1 >= _yres)) return 0;
+  if (*x1 < 0) *x1= 0;
+  if (*y1 < 0) *y1= 0;
+  if (*x2 >= _xres) *x2= _xres-1;
+  if (*y2 >= _yres) *y2= _yres-1;
+  return 1;
+}
+
+/* ----------------------------------------------------------
+     fillrect
+
+     zeichnet ein ausgefuelltes Rechteck. Fuer das gesamte
+     Rechteck wird nur ein einziges Adressfenster gesetzt
+
+       x1,y1 : eine Ecke des Rechtecks
+       x2,y2 : gegenueberliegende Ecke
+       color : RGB565 Farbwert
+   ---------------------------------------------------------- */
+void fillrect(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  if (rect_transform(&x1, &y1, &x2, &y2))
+    window_fill(x1, y1, x2, y2, color);
+}
+
+/* ----------------------------------------------------------
+     hline / vline
+
+     waagerechte bzw. senkrechte Linie als 1 Pixel breites
+     Rechteck
+   ---------------------------------------------------------- */
+void hline(int x1, int x2, int y, uint16_t color)
+{
+  fillrect(x1, y, x2, y, color);
+}
+
+void vline(int x, int y1, int y2, uint16_t color)
+{
+  fillrect(x, y1, x, y2, color);
+}
+
+/* ----------------------------------------------------------
+     blit
+
+     kopiert ein RGB565 Bild aus dem RAM auf das Display.
+     Bei outmode 0 wird das Bild in einem einzigen Adress-
+     fenster uebertragen, bei gedrehter Ausgabe (outmode
+     1..3) punktweise ueber putpixel.
+     Das Bild muss vollstaendig auf dem Display liegen
+
+       x,y   : linke obere Ecke
+       w,h   : Breite und Hoehe in Pixel
+       image : Farbwerte zeilenweise, w*h Eintraege
+   ---------------------------------------------------------- */
+void blit(int x, int y, uint8_t w, uint8_t h, const uint16_t *image)
+{
+  uint16_t anz;
+  uint8_t  xi, yi;
+  USI_SPI_DECL
+
+  if (outmode)
+  {
+    for (yi= 0; yi< h; yi++)
+    {
+      for (xi= 0; xi< w; xi++)
+      {
+        putpixel(x+xi, y+yi, *image++);
+      }
+    }
+    return;
+  }
+
+  #if (tft_scroll == 1)
+    anz= _yres - scroll_y(y);                     // Zeilen bis zur Umbruchzeile
+    if (anz < h)
+    {
+      blit(x, y, w, anz, image);
+      image += anz * w;
+      y += anz;
+      h -= anz;
+    }
+  #endif
+
+  set_ram_address(x, y, x+w-1, y+h-1);
+  dc_set();
+
+  anz= (uint16_t)w * h;
+  while (anz--)
+  {
+    tft_fast(*image >> 8);
+    tft_fast(*image & 0xff);
+    image++;
+  }
+}
+
+#if (bitmap_enable == 1)
+
+  /* ----------------------------------------------------------
+     blit_stream
+
+     gibt h Zeilen zu je w Pixel aus dem Bitmapdecoder
+     (bitmap_p.c) aus, Aufteilung wie bei blit
+     ---------------------------------------------------------- */
+  static void blit_stream(int x, int y, uint8_t w, uint8_t h)
+  {
+    uint16_t anz, color;
+    uint8_t  xi, yi;
+    USI_SPI_DECL
+
+    if (outmode)
+    {
+      for (yi= 0; yi< h; yi++)
+      {
+        for (xi= 0; xi< w; xi++)
+        {
+          color= bmp_getbyte() << 8;
+          color |= bmp_getbyte();
+          putpixel(x+xi, y+yi, color);
+        }
+      }
+      return;
+    }
+
+    #if (tft_scroll == 1)
+      anz= _yres - scroll_y(y);                   // Zeilen bis zur Umbruchzeile
+      if (anz < h)
+      {
+        blit_stream(x, y, w, anz);
+        y += anz;
+        h -= anz;
+      }
+    #endif
+
+    set_ram_address(x, y, x+w-1, y+h-1);
+    dc_set();
+
+    anz= (uint16_t)w * h;
+    while (anz--)
+    {
+      tft_fast(bmp_getbyte());
+      tft_fast(bmp_getbyte());
+    }
+  }
+
+  /* ----------------------------------------------------------
+     blit_P
+
+     gibt eine mit imgconv erzeugte RGB565 Bitmap (auch
+     RLE komprimiert) aus dem Flash aus. Die Bilddaten
+     werden ohne Puffer in ein einziges Adressfenster
+     gestreamt (bei gedrehter Ausgabe punktweise).
+     Das Bild muss vollstaendig auf dem Display liegen
+
+       x,y   : linke obere Ecke
+       image : Bitmap im Format BMP_RGB565 (bitmap_p.h)
+     ---------------------------------------------------------- */
+  void blit_P(int x, int y, const uint8_t *image)
+  {
+    if (bmp_format(image) != BMP_RGB565) return;
+
+    bmp_start(image);
+    blit_stream(x, y, bmp_width(image), bmp_height(image));
+  }
+
+#endif
+
 /* ----------------------------------------------------------
      putpixel
 
@@ -575,26 +822,78 @@ void putpixel(int x, int y,uint16_t color)
 
 void clrscr()
 {
-  int      x,y;
-  uint8_t  colouthi, coloutlo;
+  #if (tft_scroll == 1)
+    scroll_define();
+  #endif
+  window_fill(0, 0, _xres-1, _yres-1, bkcolor);
+}
 
-  set_ram_address(0,0,_xres-1,_yres-1);
+#if (tft_scroll == 1)
 
-  colouthi = bkcolor >> 8;
-  coloutlo = bkcolor & 0xff;
+  /* ----------------------------------------------------------
+       lcd_scrollup
 
-  dc_set();
+       schiebt den Displayinhalt um rows Pixelzeilen nach
+       oben (Hardwarescrolling, nur ein Kommando). Die oben
+       herausfallenden Zeilen werden vorher mit bkcolor
+       geloescht und erscheinen unten als leere Zeilen.
+       Bei outmode 3 wird der Scrollbereich in Gegenrichtung
+       verschoben, outmode 1 und 2 werden nicht unterstuetzt.
 
-  for (y= 0; y< _yres; y++)
+       Fuer lcd_stripout muss rows ein Vielfaches von 8 sein
+
+         rows : Anzahl Pixelzeilen (< _yres)
+     ---------------------------------------------------------- */
+  void lcd_scrollup(uint8_t rows)
   {
-    for (x= 0; x< _xres; x++)
+    fillrect(0, 0, _xres-1, rows-1, bkcolor);
+
+    if (outmode == 3) scrollofs += _yres - rows;
+                 else scrollofs += rows;
+    if (scrollofs >= _yres) scrollofs -= _yres;
+
+    wrcmd(vscrsadd);
+    wrdata16(scrollofs + tft_ramyofs);
+  }
+
+#endif
+
+#if (ili9225 == 0)
+
+  /* ----------------------------------------------------------
+       lcd_partialarea
+
+       schaltet den Partial-Mode ein: nur die Zeilen y1..y2
+       werden vom Controller angezeigt, der Rest bleibt
+       dunkel (geringerer Refreshaufwand / Stromverbrauch).
+       outmode 3 wird beruecksichtigt
+
+       lcd_normalmode
+
+       schaltet auf die Anzeige des gesamten Displays zurueck
+     ---------------------------------------------------------- */
+  void lcd_partialarea(uint16_t y1, uint16_t y2)
+  {
+    uint16_t tmp;
+
+    if (outmode == 3)
     {
-      wrdata(colouthi);
-      wrdata(coloutlo);
+      tmp= _yres-1-y1;
+      y1= _yres-1-y2;
+      y2= tmp;
     }
+    wrcmd(ptlar);
+    wrdata16(y1 + tft_ramyofs);
+    wrdata16(y2 + tft_ramyofs);
+    wrcmd(ptlon);
   }
 
-}
+  void lcd_normalmode(void)
+  {
+    wrcmd(noron);
+  }
+
+#endif
 
 /* ----------------------------------------------------------
    rgbfromvalue
@@ -651,6 +950,124 @@ void gotoxy(unsigned char x, unsigned char y)
 }
 
 
+/* --------------------------------------------------
+     glyph_window
+
+     setzt das Adressfenster fuer ein Zeichen an der
+     (logischen) Position x,y mit Breite w und Hoehe h.
+     Bei outmode 3 liegt das Fenster gespiegelt, die
+     Pixel muessen dann von rechts unten nach links oben
+     gesendet werden. Anschliessend ist DC gesetzt
+   -------------------------------------------------- */
+static void glyph_window(int x, int y, uint8_t w, uint8_t h)
+{
+  if (outmode == 3)
+    set_ram_address(_xres-x-w, _yres-y-h, _xres-1-x, _yres-1-y);
+  else
+    set_ram_address(x, y, x+w-1, y+h-1);
+  dc_set();
+}
+
+/* --------------------------------------------------
+     glyph_mode
+
+     prueft, ob ein Zeichen der Groesse w*h an der
+     Textcursorposition ueber ein Adressfenster ausge-
+     geben werden kann
+
+     Rueckgabe: 0 = nein (ausserhalb des Displays,
+                    outmode 1 / 2)
+                1 = ein Fenster fuer das ganze Zeichen
+                2 = ein Fenster je Pixelzeile (Zeichen
+                    liegt ueber der Umbruchzeile des
+                    Scrollbereichs)
+   -------------------------------------------------- */
+static uint8_t glyph_mode(uint8_t w, uint8_t h)
+{
+  #if (tft_scroll == 1)
+    int py;
+  #endif
+
+  if ((outmode != 0) && (outmode != 3)) return 0;
+  if ((aktxp < 0) || (aktyp < 0) || (aktxp+w > _xres) || (aktyp+h > _yres)) return 0;
+
+  #if (tft_scroll == 1)
+    py= (outmode == 3) ? _yres-aktyp-h : aktyp;
+    if (scroll_y(py+h-1) < scroll_y(py)) return 2;
+  #endif
+  return 1;
+}
+
+static const uint8_t PROGMEM nibrev[16] =
+  { 0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf };
+
+/* --------------------------------------------------
+     putglyph
+
+     gibt ein Zeichen aus font8x8 (mit Hintergrund,
+     fntfilled = 1) ueber ein einziges Adressfenster
+     aus. Jede Fontzeile wird einmal gelesen (bei
+     outmode 3 gespiegelt) und fuer textsize 1 doppelt
+     gesendet, je Pixel bleibt nur eine Bitabfrage
+
+       ch   : Zeichen
+       mode : Rueckgabe von glyph_mode
+   -------------------------------------------------- */
+static void putglyph(uint8_t ch, uint8_t mode)
+{
+  uint8_t  i, rep, row, b, bits, n;
+  uint8_t  scale, w, h;
+  uint8_t  fghi, fglo, bghi, bglo;
+  USI_SPI_DECL
+
+  scale= textsize + 1;
+  w= fontsizex * scale;
+  h= fontsizey * scale;
+
+  fghi= textcolor >> 8; fglo= textcolor & 0xff;
+  bghi= bkcolor >> 8;   bglo= bkcolor & 0xff;
+
+  if (mode == 1) glyph_window(aktxp, aktyp, w, h);
+
+  for (i= 0; i< fontsizey; i++)
+  {
+    if (outmode == 3)
+    {
+      row= fontsizey-1-i;
+      b= font8x8_byte(ch, row);
+      b= (pgm_read_byte(&nibrev[b & 0x0f]) << 4) | pgm_read_byte(&nibrev[b >> 4]);
+    }
+    else
+    {
+      row= i;
+      b= font8x8_byte(ch, row);
+    }
+
+    for (rep= 0; rep< scale; rep++)
+    {
+      if (mode == 2)
+      {
+        glyph_window(aktxp, aktyp + row*scale + ((outmode == 3) ? scale-1-rep : rep), w, 1);
+      }
+      bits= b;
+      for (n= fontsizex; n; n--)
+      {
+        if (bits & 0x80)
+        {
+          tft_fast(fghi); tft_fast(fglo);
+          if (scale == 2) { tft_fast(fghi); tft_fast(fglo); }
+        }
+        else
+        {
+          tft_fast(bghi); tft_fast(bglo);
+          if (scale == 2) { tft_fast(bghi); tft_fast(bglo); }
+        }
+        bits <<= 1;
+      }
+    }
+  }
+}
+
 /* --------------------------------------------------
      lcd_putchar
 
@@ -676,16 +1093,42 @@ void lcd_putchar(uint8_t ch)
   if (ch== 10)                                          // fuer <printf> "/n" Implementation
   {
     aktyp= aktyp+fontsizey+(fontsizey*textsize);
+    #if (tft_scroll == 1)
+      if (aktyp+fontsizey+(fontsizey*textsize) > _yres) // Terminalmodus: letzte Zeile erreicht,
+      {                                                 // Display um eine Textzeile scrollen
+        lcd_scrollup(fontsizey+(fontsizey*textsize));
+        aktyp= aktyp-fontsizey-(fontsizey*textsize);
+      }
+    #endif
     return;
   }
 
+  #if (tft_scroll == 1)
+    if (aktxp+fontsizex+(fontsizex*textsize) > _xres)  // automatischer Zeilenumbruch
+    {
+      lcd_putchar(13);
+      lcd_putchar(10);
+    }
+  #endif
+
+  if (fntfilled)                                        // Zeichen mit Hintergrund: ein
+  {                                                     // Adressfenster je Zeichen
+    i= glyph_mode(fontsizex+(fontsizex*textsize), fontsizey+(fontsizey*textsize));
+    if (i)
+    {
+      putglyph(ch, i);
+      aktxp= aktxp+fontsizex+(fontsizex*textsize);
+      return;
+    }
+  }
+
   fmask= 1<<(fontsizex-1);
 
   oldx= aktxp;
   oldy= aktyp;
   for (i=0; i<fontsizey; i++)
   {
-    b= pgm_read_byte(&(font8x8[(ch-32)][i]));
+    b= font8x8_byte(ch, i);
     fontint= b;
 
     for (i2= 0; i2<fontsizex; i2++)
@@ -723,6 +1166,162 @@ void lcd_putchar(uint8_t ch)
   aktxp= aktxp+fontsizex+(fontsizex*textsize);
 }
 
+#if (tft_aafont != 0)
+
+  #define aa_levels       (1 << tft_aafont)
+
+  static aafont_t aafont;                       // Kopie der Fontbeschreibung
+  static uint16_t aaramp[aa_levels];            // Farbverlauf bkcolor .. textcolor
+  static uint16_t aaramp_fg, aaramp_bg;         // Farben, fuer die aaramp berechnet ist
+
+  /* --------------------------------------------------
+       aa_mkramp
+
+       berechnet (nur bei Farbwechsel) die Mischfarben
+       zwischen bkcolor und textcolor fuer alle Stufen
+     -------------------------------------------------- */
+  static void aa_mkramp(void)
+  {
+    uint8_t i;
+    int16_t r, g, b, dr, dg, db;
+
+    if ((aaramp_fg == textcolor) && (aaramp_bg == bkcolor)) return;
+    aaramp_fg= textcolor;
+    aaramp_bg= bkcolor;
+
+    r= bkcolor >> 11; g= (bkcolor >> 5) & 0x3f; b= bkcolor & 0x1f;
+    dr= (textcolor >> 11) - r;
+    dg= ((textcolor >> 5) & 0x3f) - g;
+    db= (textcolor & 0x1f) - b;
+
+    for (i= 0; i< aa_levels; i++)
+    {
+      aaramp[i]= ((r + dr * i / (aa_levels-1)) << 11) |
+                 ((g + dg * i / (aa_levels-1)) << 5)  |
+                  (b + db * i / (aa_levels-1));
+    }
+  }
+
+  /* --------------------------------------------------
+       lcd_setaafont
+
+       waehlt den Graustufen-Zeichensatz fuer
+       lcd_putchar_aa
+
+         font : Fontbeschreibung im Flash (PROGMEM)
+     -------------------------------------------------- */
+  void lcd_setaafont(const aafont_t *font)
+  {
+    memcpy_P(&aafont, font, sizeof(aafont_t));
+  }
+
+  /* --------------------------------------------------
+       lcd_putchar_aa
+
+       gibt ein Zeichen des Graustufen-Zeichensatzes
+       an der Textcursorposition ueber ein Adressfenster
+       aus (immer mit Hintergrund). Die Pixelwerte werden
+       je Byte herausgeschoben und ueber aaramp in
+       RGB565 umgesetzt.
+
+       Zeichen, die nicht vollstaendig auf das Display
+       passen, werden nicht gezeichnet (bei outmode 1 / 2
+       werden keine Zeichen gezeichnet)
+     -------------------------------------------------- */
+  void lcd_putchar_aa(uint8_t ch)
+  {
+    uint8_t  mode, i, row, k, j, n, skip, rowbytes;
+    uint8_t  b, v;
+    uint16_t col;
+    const uint8_t *gp, *rp;
+    USI_SPI_DECL
+
+    if (ch== 13)
+    {
+      aktxp= 0;
+      return;
+    }
+    if (ch== 10)
+    {
+      aktyp += aafont.height;
+      #if (tft_scroll == 1)
+        if (aktyp + aafont.height > _yres)
+        {
+          lcd_scrollup(aafont.height);
+          aktyp -= aafont.height;
+        }
+      #endif
+      return;
+    }
+    #if (tft_scroll == 1)
+      if (aktxp + aafont.width > _xres)
+      {
+        lcd_putchar_aa(13);
+        lcd_putchar_aa(10);
+      }
+    #endif
+
+    mode= glyph_mode(aafont.width, aafont.height);
+    if ((ch < aafont.first) || (ch > aafont.last)) mode= 0;
+    if (!mode)
+    {
+      aktxp += aafont.width;
+      return;
+    }
+
+    aa_mkramp();
+    rowbytes= ((uint16_t)aafont.width * tft_aafont + 7) >> 3;
+    gp= aafont.bitmap + (uint16_t)(ch - aafont.first) * rowbytes * aafont.height;
+
+    if (mode == 1) glyph_window(aktxp, aktyp, aafont.width, aafont.height);
+
+    for (i= 0; i< aafont.height; i++)
+    {
+      row= (outmode == 3) ? aafont.height-1-i : i;
+      rp= gp + row * rowbytes;
+      if (mode == 2) glyph_window(aktxp, aktyp + row, aafont.width, 1);
+
+      n= aafont.width;
+      if (outmode == 3)
+      {
+        // von rechts nach links: Fuellpixel am Zeilenende zuerst verwerfen
+        skip= rowbytes * (8 / tft_aafont) - n;
+        k= rowbytes;
+        while (n)
+        {
+          b= pgm_read_byte(rp + --k);
+          j= 8 / tft_aafont;
+          for (; skip; skip--, j--) b >>= tft_aafont;
+          for (; j && n; j--, n--)
+          {
+            v= b & (aa_levels-1);
+            b >>= tft_aafont;
+            col= aaramp[v];
+            tft_fast(col >> 8); tft_fast(col & 0xff);
+          }
+        }
+      }
+      else
+      {
+        k= 0;
+        while (n)
+        {
+          b= pgm_read_byte(rp + k++);
+          for (j= 8 / tft_aafont; j && n; j--, n--)
+          {
+            v= b >> (8 - tft_aafont);
+            b <<= tft_aafont;
+            col= aaramp[v];
+            tft_fast(col >> 8); tft_fast(col & 0xff);
+          }
+        }
+      }
+    }
+    aktxp += aafont.width;
+  }
+
+#endif
+
 /* ----------------------------------------------------------
    lcd_putramstring
 
@@ -751,3 +1350,50 @@ void lcd_putromstring(const unsigned char *dataPtr)
   for (c=pgm_read_byte(dataPtr); c; ++dataPtr, c=pgm_read_byte(dataPtr)) lcd_putchar(c);
 }
 
+#if (stripout_enable == 1)
+
+  /* ----------------------------------------------------------
+     lcd_stripout
+
+     gibt einen 1-Bit Streifen aus strip_render.c aus. Fuer
+     den Streifen wird einmalig ein Adressfenster gesetzt,
+     danach werden alle Pixel zeilenweise ohne weitere
+     Adressierung gesendet. Gesetzte Bits werden in der
+     Farbe textcolor, geloeschte in bkcolor ausgegeben
+     (outmode wird nicht beruecksichtigt)
+
+       page  : Pixelzeilen page*8 .. page*8+7
+       buf   : Streifenpuffer, Bit 0 = oberste Zeile
+       width : Anzahl Spalten
+     ---------------------------------------------------------- */
+  void lcd_stripout(uint8_t page, uint8_t *buf, uint8_t width)
+  {
+    uint8_t  x, mask;
+    uint8_t  fghi, fglo, bghi, bglo;
+    USI_SPI_DECL
+
+    fghi= textcolor >> 8; fglo= textcolor & 0xff;
+    bghi= bkcolor >> 8;   bglo= bkcolor & 0xff;
+
+    set_ram_address(0, page << 3, width-1, (page << 3) + 7);
+    dc_set();
+
+    for (mask= 1; mask; mask <<= 1)
+    {
+      for (x= 0; x< width; x++)
+      {
+        if (buf[x] & mask)
+        {
+          tft_fast(fghi);
+          tft_fast(fglo);
+        }
+        else
+        {
+          tft_fast(bghi);
+          tft_fast(bglo);
+        }
+      }
+    }
+  }
+
+#endif
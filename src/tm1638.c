@@ -28,6 +28,7 @@
     07.03.2019  R. Seelig
    ------------------------------------------------------------------ */
 #include "tm1638.h"
+#include "bcd_conv.h"
 
 // Globale Variable
 
@@ -322,16 +323,14 @@ void tm1638_setdp(uint8_t pos, uint8_t enable)
     --------------------------------------------------------- */
 void tm1638_setdez(int32_t value, uint8_t pos, uint8_t nozero)
 {
-  int32_t teiler = 10000000;
   uint8_t i, v, b;
+  uint8_t dig[8];
 
-  for (i= 0; i< pos; i++) teiler /= 10;
+  bcd_dig32(value, dig, 8-pos);
   fb1638_clr();
   for (i= 0; i< 8-pos; i++)
   {
-    v= value / teiler;
-    value= value - ( v * teiler);
-    teiler /= 10;
+    v= dig[i];
     if ((i== (8-pos-1) && nozero)) nozero= 0;
     if (v || !nozero)
     {
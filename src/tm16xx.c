@@ -46,6 +46,7 @@
 */
 
 #include "tm16xx.h"
+#include "bcd_conv.h"
 
 /* ----------------------------------------------------------
                      Globale Variable
@@ -285,15 +286,15 @@ void tm16_setseg(uint8_t pos, uint8_t seg)
     --------------------------------------------------------- */
 void tm16_setdez(int value, uint8_t dpanz)
 {
-  uint8_t i,v, bmp;
+  uint8_t i, bmp;
+  uint8_t dig[4];
 
-  for (i= 4; i> 0; i--)
+  bcd_dig16(value, dig, 4);
+  for (i= 0; i< 4; i++)
   {
-    v= value % 10;
-    bmp= led7sbmp[v];
-    if (dpanz== 5-i) bmp= bmp | 0x80;     // Dezimalpunkt setzen
-    tm16_setbmp(i-1, bmp);
-    value= value / 10;
+    bmp= led7sbmp[dig[i]];
+    if (dpanz== 4-i) bmp= bmp | 0x80;     // Dezimalpunkt setzen
+    tm16_setbmp(i, bmp);
   }
 }
 
@@ -313,15 +314,15 @@ void tm16_setdez(int value, uint8_t dpanz)
       --------------------------------------------------------- */
   void tm16_setdez6digit(uint32_t value, uint8_t dpanz)
   {
-    uint8_t i,v, bmp;
+    uint8_t i, bmp;
+    uint8_t dig[6];
 
-    for (i= 6; i> 0; i--)
+    bcd_dig32(value, dig, 6);
+    for (i= 0; i< 6; i++)
     {
-      v= value % 10;
-      bmp= led7sbmp[v];
-      if (dpanz== 7-i) bmp= bmp | 0x80;     // Dezimalpunkt setzen
-      tm16_setbmp(i-1, bmp);
-      value= value / 10;
+      bmp= led7sbmp[dig[i]];
+      if (dpanz== 6-i) bmp= bmp | 0x80;     // Dezimalpunkt setzen
+      tm16_setbmp(i, bmp);
     }
   }
 #endif
@@ -344,10 +345,9 @@ void tm16_setdez(int value, uint8_t dpanz)
   void tm16_setdez6digit_nonull(int32_t value, uint8_t dpanz)
   {
     uint8_t  i,v, bmp, first;
-    uint32_t teiler;
+    uint8_t  dig[6];
     uint8_t  negflag;
 
-    teiler= 100000;
     first= 1;
     negflag= 0;
     if (value< 0)
@@ -357,11 +357,10 @@ void tm16_setdez(int value, uint8_t dpanz)
       negflag++;
     }
 
+    bcd_dig32(value, dig, 6);
     for (i= 1; i< 7; i++)
     {
-      v= value / teiler;
-      value= value - (v * teiler);
-      teiler= teiler / 10;
+      v= dig[i-1];
 
       bmp= led7sbmp[v];
       if (dpanz== 7-i) bmp= bmp | 0x80;     // Dezimalpunkt setzen
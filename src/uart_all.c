@@ -45,8 +45,6 @@
 
 #include "uart_all.h"
 
-#define echo_enable    0
-
 
 /* ##########################################################
          Liste der unterstuetzten AVR-Controller
@@ -80,6 +78,9 @@
     #define UDRE0       UDRE
     #define UDR0        UDR
     #define RXC0        RXC
+    #define RXCIE0      RXCIE
+    #define FE0         FE
+    #define DOR0        DOR
 
   #endif
 
@@ -89,6 +90,45 @@
 
 #endif
 
+#if (uart_rxfifo_size & (uart_rxfifo_size - 1))
+  #error "uart_rxfifo_size muss eine Zweierpotenz sein"
+#endif
+
+/* ##########################################################
+          Empfangspuffer (gemeinsam fuer alle Controller)
+   ########################################################## */
+
+static volatile uint8_t rxfifo[uart_rxfifo_size];
+static volatile uint8_t rxfifo_head = 0;                  // Schreibindex (Interrupt)
+static volatile uint8_t rxfifo_tail = 0;                  // Leseindex
+
+volatile uint8_t uart_err_overrun = 0;
+volatile uint8_t uart_err_frame = 0;
+volatile uint8_t uart_err_noise = 0;
+
+#define uart_errinc(cnt)      { if (cnt != 0xff) cnt++; }
+
+/* ----------------------------------------------------------
+                         rxfifo_put
+
+     legt ein empfangenes Zeichen im Puffer ab (wird aus
+     dem Empfangsinterrupt heraus aufgerufen)
+   ---------------------------------------------------------- */
+static inline void rxfifo_put(uint8_t ch)
+{
+  uint8_t h, next;
+
+  h= rxfifo_head;
+  next= (h + 1) & (uart_rxfifo_size - 1);
+  if (next == rxfifo_tail)                                // Puffer voll
+  {
+    uart_errinc(uart_err_overrun);
+    return;
+  }
+  rxfifo[h]= ch;
+  rxfifo_head= next;
+}
+
 /* ##########################################################
           MCU mit USI-Serial (ATtinyx4, ATtinyx5)
    ########################################################## */
@@ -195,9 +235,8 @@
   static volatile enum USISERIAL_SEND_STATE usiserial_send_state = AVAILABLE;
   static volatile uint8_t usiserial_tx_data;
 
-  volatile bool usiserial_readfinished= true;
-  volatile bool serialdataready = false;                  // zeigt an, ob ein Datum eingegangen ist
-  volatile uint8_t serialinput;                           // letztes eingegangenes Datum
+  static volatile uint8_t rx_data;                        // empfangenes Datum bis zur Stopbitpruefung
+  static volatile uint8_t rx_stopbit = 0;                 // 1 = naechster Compare Match tastet das Stopbit ab
 
 
   /* ------------------------------------------------------------------------
@@ -279,15 +318,17 @@
   }
 
   /* ------------------------------------------------------------------
-                               serialreceived
+                              rx_restart
 
-       setzt Flag, dass ein Datum eingegangen ist
-       und speichert dieses Datum
+       Empfang beenden und Pinchange-Interrupt fuer das naechste
+       Startbit wieder zulassen
      ------------------------------------------------------------------ */
-  void serialreceived(uint8_t data)
+  static inline void rx_restart(void)
   {
-    serialdataready = true;
-    serialinput = data;
+    TIMSK0 &= ~(1 << OCIE0A);
+    rx_stopbit= 0;
+    GIFR = 1 << PCIF0;                                    // Pinchange Interrupt Flag quittieren
+    GIMSK |= 1 << PCIE0;                                  // und Pinchange Interrupts wieder zulassen
   }
 
 
@@ -322,8 +363,6 @@
   {
     uint8_t pinbVal;
 
-    usiserial_readfinished= false;
-
     pinbVal = USI_PIN;
     if (!(pinbVal & 1 << USI_DI))                         // wird nur eingelesen, wenn DI == 0
     {
@@ -335,10 +374,27 @@
   /* ------------------------------------------------------------------
                   Timer 0 Compare Match Interruptvektor
 
-       startet in der zeitlichen Mitte von Bit 0
+       wird in der zeitlichen Mitte des Startbits aufgerufen und
+       startet dort die USI. Nach dem Empfang der Datenbits wird
+       hier in der Mitte des Stopbits dieses ueberprueft.
      ------------------------------------------------------------------ */
   ISR (TIM0_COMPA_vect)
   {
+    if (rx_stopbit)                                       // Mitte des Stopbits
+    {
+      if (USI_PIN & (1 << USI_DI)) rxfifo_put(rx_data);
+                              else uart_errinc(uart_err_frame);
+      rx_restart();
+      return;
+    }
+
+    if (USI_PIN & (1 << USI_DI))                          // Startbit nicht mehr vorhanden: Stoerimpuls
+    {
+      uart_errinc(uart_err_noise);
+      rx_restart();
+      return;
+    }
+
     TIMSK0 &= ~(1 << OCIE0A);                             // COMPA sperren
     TCNT0 = 0;                                            // Zaehler auf 0
     OCR0A = FULL_BIT_TICKS;                               // einzelne zeitliche Bitbreite
@@ -387,14 +443,14 @@
     else
     {
       USICR  =  0;                                       // Disable USI
-
-      serialreceived(reverse_byte(temp));
-
-      GIFR = 1 << PCIF0;                                 // Pinchange Interrupt Flag quittieren
-      GIMSK |= 1 << PCIE0;                               // und Pinchange Interrupts wieder zulassen
-
-      usiserial_readfinished= true;
       USISR |= 1 << USIOIF;                              // Interrupt quittieren
+
+      // Timer0 laeuft weiter, der naechste Compare Match liegt in der
+      // Mitte des Stopbits
+      rx_data= reverse_byte(temp);
+      rx_stopbit= 1;
+      TIFR0 = 1 << OCF0A;
+      TIMSK0 |= 1 << OCIE0A;
     }
 
     sei();
@@ -434,52 +490,36 @@
        schreibt ein Zeichen auf der USI-Schnittstelle, die als UART
        konfiguriert ist. TxD ist Anschluss D0 (entspricht wirklich
        MISO Anschluss der SPI Schnittstelle)
+
+       Die USI arbeitet halbduplex: ein laufender Empfang wird bis
+       einschliesslich der Abtastung des Stopbits abgewartet, danach
+       ist der Pinchange-Interrupt bis zum Ende des Frames gesperrt.
+       Trifft waehrend des Sendens ein Startbit ein, ist dieses
+       Zeichen verloren und wird in uart_err_overrun gezaehlt.
      ------------------------------------------------------------------ */
   void uart_putchar(uint8_t c)
   {
-    uart_func= TXD;
     while (!usiserial_send_available());
-    usiserial_send_byte(c);
-    while (!usiserial_send_available());
-    uart_func= RXD;
-  }
 
+    for (;;)                                              // Empfang abwarten
+    {
+      cli();
+      if (GIMSK & (1 << PCIE0)) break;
+      sei();
+    }
+    GIMSK &= ~(1 << PCIE0);                               // Startbits waehrend des Sendens sperren
+    GIFR = 1 << PCIF0;
+    uart_func= TXD;
+    sei();
 
-  /* ------------------------------------------------------------------
-                                uart_getchar
-
-       liest ein Zeichen auf der USI-Schnittstelle ein, die als UART
-       konfiguriert ist. RxD ist Anschluss DI (das entspricht wirklich
-       MOSI - Anschluss der SPI Schnittstelle)
-     ------------------------------------------------------------------ */
-  uint8_t uart_getchar(void)
-  {
-    uint8_t ch;
-
-    while(!(serialdataready))
-    while(!(usiserial_readfinished));
-    serialdataready= false;
-    ch= serialinput;
-
-    _delay_us((100000 / (BAUDRATE / 100)));       // warten bis 10 Bits (Startbit, Stopbit, 8 Datenbits) eingelesen sind
-
-    #if (echo_enable == 1)
-      uart_putchar(ch)
-    #endif
-
-    return ch;
-  }
-
-  /* ------------------------------------------------------------------
-                                uart_ischar
+    usiserial_send_byte(c);
+    while (!usiserial_send_available());
 
-       testet, ob auf der USI-Schnittstelle die als UART konfiguriert
-       ist, ein Zeichen eingetroffen ist. Hierbei wird dieses Zeichen
-       jedoch NICHT gelesen.
-     ------------------------------------------------------------------ */
-  uint8_t uart_ischar(void)
-  {
-    if (serialdataready) return 1; else return 0;
+    cli();
+    if (GIFR & (1 << PCIF0)) uart_errinc(uart_err_overrun);
+    uart_func= RXD;
+    rx_restart();
+    sei();
   }
 
 
@@ -523,15 +563,40 @@
 
   #if defined __AVR_ATmega8__
 
-    UCSR0B |= (1<<RXEN0) | (1<<TXEN0);
+    UCSR0B |= (1<<RXEN0) | (1<<TXEN0) | (1<<RXCIE0);
     UCSRC  = (1<<URSEL) | (1<<UCSZ01) | (1<<UCSZ00);
 
   #else
 
-    UCSR0B = (1<<RXEN0)|(1<<TXEN0);                       // Transmitter und Receiver enable
+    UCSR0B = (1<<RXEN0)|(1<<TXEN0)|(1<<RXCIE0);           // Transmitter, Receiver und Empfangsinterrupt enable
     UCSR0C = (3<<UCSZ00);                                 // 8 Datenbit, 1 Stopbit
 
   #endif
+
+    sei();
+  }
+
+  /* --------------------------------------------------
+      Empfangsinterrupt: Zeichen in den Puffer
+     -------------------------------------------------- */
+  #if defined __AVR_ATmega8__
+    ISR (USART_RXC_vect)
+  #else
+    ISR (USART_RX_vect)
+  #endif
+  {
+    uint8_t status, ch;
+
+    status= UCSR0A;                                       // Status vor dem Datenregister lesen
+    ch= UDR0;
+
+    if (status & (1<<DOR0)) uart_errinc(uart_err_overrun);
+    if (status & (1<<FE0))
+    {
+      uart_errinc(uart_err_frame);
+      return;
+    }
+    rxfifo_put(ch);
   }
 
   /* --------------------------------------------------
@@ -544,41 +609,117 @@
     UDR0 = ch;                                            // Zeichen senden
   }
 
-  /* --------------------------------------------------
-      testen, ob ein Zeichen auf der Schnittstelle
-      ansteht
-     -------------------------------------------------- */
+/* ##########################################################
+                    Ende Hardware UART
+   ########################################################## */
+#endif
 
-  uint8_t uart_ischar( void )
-  {
-    return (UCSR0A & (1<<RXC0));
-  }
+/* ##########################################################
+           Lesen aus dem Empfangspuffer (alle Controller)
+   ########################################################## */
 
-  /* --------------------------------------------------
-      Zeichen von serieller Schnittstelle lesen
-     -------------------------------------------------- */
+/* ----------------------------------------------------------
+                        uart_ischar
 
-  uint8_t uart_getchar( void )
-  {
-    while(!(UCSR0A & (1<<RXC0)));                         // warten bis Zeichen eintrifft
+     testet, ob ein Zeichen im Empfangspuffer ansteht.
+     Hierbei wird dieses Zeichen jedoch NICHT gelesen.
+   ---------------------------------------------------------- */
+uint8_t uart_ischar( void )
+{
+  return (rxfifo_head != rxfifo_tail);
+}
 
-  #if (echo_enable == 1)
+/* ----------------------------------------------------------
+                        uart_getchar
 
-    char ch;
-    ch= UDR0;
-    uart_putchar(ch);
-    return ch;
+     liest ein Zeichen aus dem Empfangspuffer, ist dieser
+     leer, wird gewartet
+   ---------------------------------------------------------- */
+uint8_t uart_getchar( void )
+{
+  uint8_t t, ch;
 
-  #else
+  while (!uart_ischar());                                 // warten bis Zeichen eintrifft
 
-    return UDR0;
+  t= rxfifo_tail;
+  ch= rxfifo[t];
+  rxfifo_tail= (t + 1) & (uart_rxfifo_size - 1);
 
+  #if (echo_enable == 1)
+    uart_putchar(ch);
   #endif
+
+  return ch;
+}
+
+/* ----------------------------------------------------------
+                          uart_read
+
+     liest bis zu len Zeichen nach buf. Ist der Puffer leer,
+     wird insgesamt max. timeout_ms Millisekunden auf weitere
+     Zeichen gewartet (timeout_ms= 0: nur bereits empfangene
+     Zeichen lesen)
+
+     Rueckgabe: Anzahl gelesener Zeichen
+   ---------------------------------------------------------- */
+uint8_t uart_read(uint8_t *buf, uint8_t len, uint16_t timeout_ms)
+{
+  uint8_t anz= 0;
+
+  while (anz < len)
+  {
+    if (uart_ischar())
+    {
+      *buf++= uart_getchar();
+      anz++;
+    }
+    else
+    {
+      if (!timeout_ms) break;
+      _delay_ms(1);                                       // Zeichen laufen waehrenddessen im Puffer auf
+      timeout_ms--;
+    }
+  }
+  return anz;
+}
+
+#if (uart_lineassembly == 1)
+
+  static char linebuf[uart_linebuf_size];
+  static uint8_t linelen = 0;
+
+  void (*uart_linecallback)(char *line, uint8_t len) = 0;
+
+  /* ------------------------------------------------------------
+                            uart_linepoll
+
+       ist zyklisch im Hauptprogramm aufzurufen. Setzt die
+       empfangenen Zeichen zu einer Zeile zusammen und ruft bei
+       '\r' uart_linecallback mit der (mit 0 abgeschlossenen)
+       Zeile auf. '\n' wird ignoriert, Zeichen ueber die Puffer-
+       laenge hinaus werden verworfen.
+     ------------------------------------------------------------ */
+  void uart_linepoll(void)
+  {
+    uint8_t ch;
+
+    while (uart_ischar())
+    {
+      ch= uart_getchar();
+      if (ch == 0x0d)
+      {
+        linebuf[linelen]= 0;
+        if (uart_linecallback) uart_linecallback(linebuf, linelen);
+        linelen= 0;
+      }
+      else
+      if ((ch != 0x0a) && (linelen < (uart_linebuf_size - 1)))
+      {
+        linebuf[linelen++]= ch;
+      }
+    }
   }
 
-/* ##########################################################
-                    Ende Hardware UART
-   ########################################################## */
 #endif
 
 #if (readint_enable == 1)
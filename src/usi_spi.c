@@ -0,0 +1,118 @@
+/* -----------------------------------------------------
+                        usi_spi.c
+
+    SPI-Master ueber das USI (oder Bitbanging) fuer die
+    Displaytreiber
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "usi_spi.h"
+
+/* -------------------------------------------------------------
+                           spi_init
+
+     Anschlusspins des SPI-Interface konfigurieren
+   ------------------------------------------------------------- */
+void spi_init(void)
+{
+  spi_mosi_init();
+  spi_sck_init();
+  spi_miso_init();
+  #if (hardware_spi == 0)
+    spi_sck_clr();
+  #endif
+}
+
+#if (hardware_spi == 1)
+
+  /* -------------------------------------------------------------
+                           spi_out
+
+        Byte ueber USI Hardware senden / empfangen
+        data ==> zu sendendes Datum
+     ------------------------------------------------------------- */
+  uint8_t spi_out(uint8_t data)
+  {
+    USI_SPI_DECL
+
+    spi_fast(data);
+    return USIDR;
+  }
+
+#else
+
+  /* -------------------------------------------------------------
+                           spi_out
+
+        Byte ueber Software SPI senden / empfangen
+        data ==> zu sendendes Datum
+     ------------------------------------------------------------- */
+  uint8_t spi_out(uint8_t data)
+  {
+    uint8_t a;
+
+    for (a= 0; a< 8; a++)
+    {
+      if (data & 0x80) spi_mosi_set(); else spi_mosi_clr();
+      data <<= 1;
+      spi_sck_set();                                  // Taktleitung auf 1
+      if (spi_is_miso()) data |= 1;
+      spi_sck_clr();                                  // und wieder auf 0
+    }
+    return data;
+  }
+
+#endif
+
+/* -------------------------------------------------------------
+                           spi_outbuf
+
+     sendet anz Bytes aus dem RAM
+   ------------------------------------------------------------- */
+void spi_outbuf(const uint8_t *buf, uint16_t anz)
+{
+  USI_SPI_DECL
+
+  while (anz--)
+  {
+    spi_fast(*buf++);
+  }
+}
+
+/* -------------------------------------------------------------
+                           spi_outbuf_P
+
+     sendet anz Bytes aus dem Flash
+   ------------------------------------------------------------- */
+void spi_outbuf_P(const uint8_t *buf, uint16_t anz)
+{
+  USI_SPI_DECL
+
+  while (anz--)
+  {
+    spi_fast(pgm_read_byte(buf++));
+  }
+}
+
+/* -------------------------------------------------------------
+                           spi_fill16
+
+     sendet anz mal den 16-Bit Wert value (MSB zuerst)
+   ------------------------------------------------------------- */
+void spi_fill16(uint16_t value, uint16_t anz)
+{
+  uint8_t hi, lo;
+  USI_SPI_DECL
+
+  hi= value >> 8;
+  lo= value & 0xff;
+  while (anz--)
+  {
+    spi_fast(hi);
+    spi_fast(lo);
+  }
+}
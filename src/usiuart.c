@@ -6,6 +6,7 @@
 
      Verwendet USI-Overflow, Pinchange0 und Timer0 Compare Match
      Interrupt
+     (im Vollduplex-Betrieb zusaetzlich Timer1 Compare Match A)
 
 
      MCU   : ATtiny44
@@ -45,6 +46,10 @@ PCINT6 - OC1A - SDA - MOSI - DI - ADC6 - PA6  | 7   y   8 |  PA5 - ADC5 - DO - M
 
 #include "usiuart.h"
 
+#if (autobaud_enable == 1)
+  #include <util/delay_basic.h>
+#endif
+
 
 /* -----------------------------------------------------------------------
    Prescaler Berechnung in Abhaengigkeit der Taktrate und clockselect setzen
@@ -52,7 +57,7 @@ PCINT6 - OC1A - SDA - MOSI - DI - ADC6 - PA6  | 7   y   8 |  PA5 - ADC5 - DO - M
    fuer F_CPU angeben
    ----------------------------------------------------------------------- */
 
-#define CYCLES_PER_BIT        ( (F_CPU) / (BAUDRATE) )
+#define CYCLES_PER_BIT        ( ((F_CPU) + (BAUDRATE) / 2) / (BAUDRATE) )
 #if (CYCLES_PER_BIT > 255)
   #define DIVISOR             8
   #define CLOCKSELECT         2
@@ -61,8 +66,40 @@ PCINT6 - OC1A - SDA - MOSI - DI - ADC6 - PA6  | 7   y   8 |  PA5 - ADC5 - DO - M
   #define CLOCKSELECT         1
 #endif
 
-#define FULL_BIT_TICKS        ( (CYCLES_PER_BIT) / (DIVISOR) )
+#if (uart_txfifo_size & (uart_txfifo_size - 1))
+  #error "uart_txfifo_size muss eine Zweierpotenz sein"
+#endif
+
+#if (uart_fullduplex == 1)
+  // Timer1 (Prescaler 1) Ticks pro Bit fuer den Sender
+  #define TX_BIT_TICKS        ( (CYCLES_PER_BIT) - 1 )
+  #if (TX_BIT_TICKS > 65535)
+    #error "BAUDRATE fuer den Timer1 Sender zu niedrig"
+  #endif
+
+  // TCCR1A: OC1B bei Compare Match setzen bzw. loeschen (CTC, WGM11:10 = 0)
+  #define TX_OC1B_SET         ( (1 << COM1B1) | (1 << COM1B0) )
+  #define TX_OC1B_CLR         ( 1 << COM1B1 )
+#endif
+
+#define FULL_BIT_TICKS        ( ((CYCLES_PER_BIT) + (DIVISOR) / 2) / (DIVISOR) )
 #define HALF_BIT_TICKS        ( FULL_BIT_TICKS / 2)
+#define BIT_OCR               ( FULL_BIT_TICKS - 1 )    // CTC: Periodendauer ist OCR0A + 1
+
+#if (FULL_BIT_TICKS > 256)
+  #error "BAUDRATE fuer die gegebene Taktfrequenz F_CPU zu niedrig"
+#endif
+
+/* -----------------------------------------------------------------------
+     Fehlerbudget: die tatsaechliche Bitzeit (ganzzahlige Timerticks)
+     darf max. BAUD_TOLERANCE Promille von der Sollbitzeit abweichen
+   ----------------------------------------------------------------------- */
+#define BIT_CYCLES_REAL       ( (FULL_BIT_TICKS) * (DIVISOR) )
+
+#if ((BIT_CYCLES_REAL) * (BAUDRATE) * 1000 > (F_CPU) * (1000 + (BAUD_TOLERANCE))) || \
+    ((BIT_CYCLES_REAL) * (BAUDRATE) * 1000 < (F_CPU) * (1000 - (BAUD_TOLERANCE)))
+  #error "Abweichung der Baudrate zu gross, andere Kombination von F_CPU und BAUDRATE waehlen"
+#endif
 
 // Anzahl der Takte nach Eingang eines Pin-Changes bis zum Start des USI-Timers
 #define START_DELAY           (99)
@@ -73,20 +110,70 @@ PCINT6 - OC1A - SDA - MOSI - DI - ADC6 - PA6  | 7   y   8 |  PA5 - ADC5 - DO - M
 
 #define TIMER_START_DELAY     ( START_DELAY  / DIVISOR )
 
-#if (HALF_BIT_TICKS - TIMER_START_DELAY)>0
+// Anzahl der Takte nach Eingang eines Pin-Changes bis zum Setzen von TCNT0
+// im Pinchange-Interrupt (Schnellstart)
+#define START_DELAY_FAST      24
 
-  #define TIMER_TICKS         ( HALF_BIT_TICKS - TIMER_START_DELAY )
+/* -----------------------------------------------------------------------
+     Start des Empfangs:
+
+     RX_FASTSTART 0 : Pinchange startet Timer0, in der Mitte des Startbits
+                      startet der Compare Match Interrupt die USI
+                      (AVR307)
+
+     RX_FASTSTART 1 : Timer0 laeuft staendig mit der Bitzeit. Der Pinchange
+                      Interrupt setzt TCNT0 so, dass der erste Compare
+                      Match in der Mitte des Startbits liegt und startet
+                      die USI sofort mit 9 Abtastungen (Startbit wird
+                      hinausgeschoben). Damit entfaellt die Latenz des
+                      zweiten Interrupts, notwendig fuer 57600 / 115200
+                      Baud und fuer die automatische Baudratenerkennung.
+   ----------------------------------------------------------------------- */
+#if (autobaud_enable == 1) || (HALF_BIT_TICKS < (TIMER_START_DELAY + TIMER_MIN))
+
+  #define RX_FASTSTART        1
+
+  // Timerticks vom Setzen von TCNT0 bis zur Mitte des Startbits
+  #define RX_WAIT_TICKS       ( ((CYCLES_PER_BIT) / 2 - (START_DELAY_FAST)) / (DIVISOR) )
 
-  #if (TIMER_TICKS < TIMER_MIN)
-    #warning TIMER_TICKS zu langsam, niedrigere Baudrate waehlen
+  #if ((CYCLES_PER_BIT) / 2 < (START_DELAY_FAST + DIVISOR))
+    #error "BAUDRATE fuer die gegebene Taktfrequenz F_CPU zu hoch"
   #endif
 
+  #define RX_PRELOAD          ( BIT_OCR - RX_WAIT_TICKS )
+
 #else
 
-  #error "TIMER_TICKS unzulaessige Werte: F_CPU, BAUDRATE and START_DELAY muessen unterschiedliche Werte besitzen"
-  #define TIMER_TICKS         1
+  #define RX_FASTSTART        0
+  #define TIMER_TICKS         ( HALF_BIT_TICKS - TIMER_START_DELAY )
 
-  #endif
+#endif
+
+/* -----------------------------------------------------------------------
+     Timerwerte, die bei automatischer Baudratenerkennung zur Laufzeit
+     gesetzt werden
+   ----------------------------------------------------------------------- */
+#if (autobaud_enable == 1)
+
+  // max. Anzahl Timer0 Ueberlaeufe fuer 8 Bitzeiten (= niedrigste Baudrate)
+  #define AUTOBAUD_MAXOVF     ( (256 * 8 * 8) / 256 )
+
+  static uint8_t  rt_bit_ocr     = BIT_OCR;
+  static uint8_t  rt_clockselect = CLOCKSELECT;
+  static uint8_t  rt_rx_preload  = RX_PRELOAD;
+  static uint16_t rt_bit_cycles  = CYCLES_PER_BIT;
+
+  #define RT_BIT_OCR          rt_bit_ocr
+  #define RT_CLOCKSELECT      rt_clockselect
+  #define RT_RX_PRELOAD       rt_rx_preload
+
+#else
+
+  #define RT_BIT_OCR          BIT_OCR
+  #define RT_CLOCKSELECT      CLOCKSELECT
+  #define RT_RX_PRELOAD       RX_PRELOAD
+
+#endif
 
 
 // Enumerator Statusvariable send
@@ -103,6 +190,18 @@ static volatile enum UART_FUNC uart_func = RXD;
 static volatile enum USISERIAL_SEND_STATE usiserial_send_state = AVAILABLE;
 static volatile uint8_t usiserial_tx_data;
 
+static uint8_t txfifo[uart_txfifo_size];                // Sendepuffer
+static volatile uint8_t txfifo_head = 0;                // Schreibindex
+static volatile uint8_t txfifo_tail = 0;                // Leseindex (Interrupt)
+
+volatile uint16_t uart_txoverflow = 0;
+
+#if (uart_fullduplex == 1)
+  static uint16_t tx_shreg;                             // Schieberegister Sender (Daten + Stopbits)
+  static uint8_t tx_bitcnt;                             // noch zu sendende Bits des Frames
+  static uint8_t tx_active;                             // 1 = letztes Stopbit wird noch gesendet
+#endif
+
 volatile bool usiserial_readfinished= true;
 volatile bool serialdataready = false;                  // zeigt an, ob ein Datum eingegangen ist
 volatile uint8_t serialinput;                           // letztes eingegangenes Datum
@@ -155,21 +254,24 @@ static uint8_t reverse_byte (uint8_t x)
 }
 
 
+#if (uart_fullduplex == 0)
+
 /* ------------------------------------------------------------------
-                          usiserial_send_byte
+                          usiserial_start_tx
+
+     startet das Senden eines Bytes (wird auch aus dem USI-Overflow
+     Interrupt heraus fuer das naechste Byte im Sendepuffer aufgerufen)
    ------------------------------------------------------------------ */
-void usiserial_send_byte(uint8_t data)
+static void usiserial_start_tx(uint8_t data)
 {
-  while (usiserial_send_get_state() != AVAILABLE);      // wiederholen bis vorrausgegangener Frame gesendet ist
-
   usiserial_send_set_state(FIRST);
   usiserial_set_tx_data(reverse_byte(data));
 
   // Konifguration Timer0
   TCCR0A = 2 << WGM00;                                  // CTC mode
-  TCCR0B = CLOCKSELECT;                                 // Rrescaler auf clk oder clk / 8 setzen
+  TCCR0B = RT_CLOCKSELECT;                              // Rrescaler auf clk oder clk / 8 setzen
   GTCCR |= 1 << PSR10;                                  // Reset prescaler
-  OCR0A = FULL_BIT_TICKS;                               // Trigger
+  OCR0A = RT_BIT_OCR;                                   // Trigger
   TCNT0 = 0;                                            // Count up from 0
 
   // Konfiguration USI, Startbit senden und 7 Datenbits
@@ -186,6 +288,100 @@ void usiserial_send_byte(uint8_t data)
       (16 - 8);                                         // und Zaehler fuer 8 Bits
 }
 
+/* ------------------------------------------------------------------
+                          usiserial_send_byte
+   ------------------------------------------------------------------ */
+void usiserial_send_byte(uint8_t data)
+{
+  while (usiserial_send_get_state() != AVAILABLE);      // wiederholen bis vorrausgegangener Frame gesendet ist
+
+  usiserial_start_tx(data);
+}
+
+#endif
+
+/* ------------------------------------------------------------------
+                            uart_txkick
+
+     startet das Senden aus dem Sendepuffer, falls der Sender
+     gerade nichts zu tun hat
+   ------------------------------------------------------------------ */
+#if (uart_fullduplex == 1)
+
+static void uart_txkick(void)
+{
+  cli();
+  if (!(TIMSK1 & (1 << OCIE1A)))                        // Sender laeuft nicht: Interrupt starten,
+  {                                                     // das Startbit wird beim naechsten Compare
+    TIFR1 = 1 << OCF1A;                                 // Match geladen
+    TIMSK1 |= 1 << OCIE1A;
+  }
+  sei();
+}
+
+/* ------------------------------------------------------------------
+                Timer 1 Compare Match Interruptvektor
+
+     Vollduplex-Sender: wird zu jeder Bitgrenze aufgerufen. Der Pin
+     OC1B (PA5) wurde soeben von der Hardware auf den Pegel des
+     aktuellen Bits gesetzt, hier wird der Pegel fuer das naechste
+     Bit eingestellt.
+   ------------------------------------------------------------------ */
+ISR (TIM1_COMPA_vect)
+{
+  uint8_t t;
+
+  if (tx_bitcnt)                                        // Datenbits und Stopbits
+  {
+    if (tx_shreg & 1) TCCR1A = TX_OC1B_SET;
+                 else TCCR1A = TX_OC1B_CLR;
+    tx_shreg >>= 1;
+    tx_bitcnt--;
+    return;
+  }
+
+  t= txfifo_tail;
+  if (t != txfifo_head)                                 // naechstes Zeichen: Startbit
+  {
+    tx_shreg= txfifo[t] | 0xff00;                       // 8 Datenbits, LSB zuerst, danach Stopbits
+    tx_bitcnt= 8 + (STOPBITS);
+    txfifo_tail= (t + 1) & (uart_txfifo_size - 1);
+    tx_active= 1;
+    TCCR1A = TX_OC1B_CLR;
+  }
+  else if (tx_active)                                   // Puffer leer, Leitung bleibt high,
+  {                                                     // Ende des Stopbits noch abwarten
+    tx_active= 0;
+    TCCR1A = TX_OC1B_SET;
+  }
+  else
+  {
+    TIMSK1 &= ~(1 << OCIE1A);                           // Frame komplett gesendet
+  }
+}
+
+#else
+
+static void uart_txkick(void)
+{
+  uint8_t t;
+
+  cli();
+  t= txfifo_tail;
+  // Sender frei und kein Empfang aktiv (waehrend eines Empfangsframes ist der
+  // Pinchange-Interrupt gesperrt, gesendet wird dann am Ende des Empfangs)
+  if ((usiserial_send_get_state() == AVAILABLE) && (GIMSK & (1 << PCIE0)) && (t != txfifo_head))
+  {
+    uart_func= TXD;
+    GIMSK &= ~(1 << PCIE0);                             // Empfang waehrend des Sendens sperren
+    txfifo_tail= (t + 1) & (uart_txfifo_size - 1);
+    usiserial_start_tx(txfifo[t]);
+  }
+  sei();
+}
+
+#endif
+
 /* ------------------------------------------------------------------
                              serialreceived
 
@@ -199,6 +395,49 @@ void serialreceived(uint8_t data)
 }
 
 
+#if (RX_FASTSTART == 1)
+
+/* ------------------------------------------------------------------
+                       Pinchange Interruptvektor
+
+     Schnellstart: Timer0 laeuft bereits mit der Bitzeit, TCNT0 wird
+     so gesetzt, dass der erste Compare Match (= erste Abtastung der
+     USI) in der Mitte des Startbits liegt. Die USI schiebt 9 Bits
+     ein, das Startbit faellt dabei aus dem Datenregister heraus.
+
+     Die ersten Anweisungen sind zeitkritisch (START_DELAY_FAST) !
+   ------------------------------------------------------------------ */
+ISR (PCINT0_vect)
+{
+  if (!(USI_PIN & (1 << USI_DI)))                       // wird nur eingelesen, wenn DI == 0
+  {
+    TCNT0 = RT_RX_PRELOAD;
+    GTCCR = 1 << PSR10;                                 // Prescaler reset
+
+    // USI-Overflow zulassen, Timer 0 ist Taktquelle fuer USI
+    USICR = 1 << USIOIE | 0 << USIWM0 | 1 << USICS0;
+    USISR = 1 << USIOIF | (16 - 9);                     // Startbit + 8 Datenbits
+
+    GIMSK &= ~(1 << PCIE0);                             // Pinchange bis Ende des Frames sperren
+  }
+  usiserial_readfinished= false;
+}
+
+/* ------------------------------------------------------------------
+                             rx_timerinit
+
+     Timer0 im CTC-Modus mit der Bitzeit freilaufend starten
+   ------------------------------------------------------------------ */
+static void rx_timerinit(void)
+{
+  TIMSK0 &= ~(1 << OCIE0A);
+  TCCR0A = 2 << WGM00;                                  // CTC mode
+  TCCR0B = RT_CLOCKSELECT;
+  OCR0A = RT_BIT_OCR;
+}
+
+#else
+
 /* ------------------------------------------------------------------
                           on_serial_pinchange
 
@@ -249,7 +488,7 @@ ISR (TIM0_COMPA_vect)
 {
   TIMSK0 &= ~(1 << OCIE0A);                             // COMPA sperren
   TCNT0 = 0;                                            // Zaehler auf 0
-  OCR0A = FULL_BIT_TICKS;                               // einzelne zeitliche Bitbreite
+  OCR0A = BIT_OCR;                                      // einzelne zeitliche Bitbreite
 
   // USI-Overflow zulassen, Timer 0 ist Taktquelle fuer USI
   USICR = 1 << USIOIE | 0 << USIWM0 | 1 << USICS0;
@@ -259,6 +498,9 @@ ISR (TIM0_COMPA_vect)
 }
 
 
+#endif
+
+
 /* ------------------------------------------------------------------
                      USI Overflow Interruptvektor
 
@@ -270,6 +512,7 @@ ISR (USI_OVF_vect)
 
   cli();
 
+#if (uart_fullduplex == 0)
   if (uart_func == TXD)
   {
     if (usiserial_send_get_state() == FIRST)
@@ -289,20 +532,46 @@ ISR (USI_OVF_vect)
       USICR = 0;                                       // USI disable
       USISR |= 1 << USIOIF;                            // Interrupt quittieren
 
-      usiserial_send_set_state(AVAILABLE);
+      if (txfifo_tail != txfifo_head)                  // naechstes Zeichen aus dem Sendepuffer
+      {
+        usiserial_start_tx(txfifo[txfifo_tail]);
+        txfifo_tail= (txfifo_tail + 1) & (uart_txfifo_size - 1);
+      }
+      else                                             // Puffer leer: zurueck auf Empfang
+      {
+        usiserial_send_set_state(AVAILABLE);
+        uart_func= RXD;
+        GIFR = 1 << PCIF0;
+        GIMSK |= 1 << PCIE0;
+      }
     }
   }
   else
+#endif
   {
     USICR  =  0;                                       // Disable USI
 
     serialreceived(reverse_byte(temp));
 
-    GIFR = 1 << PCIF0;                                 // Pinchange Interrupt Flag quittieren
-    GIMSK |= 1 << PCIE0;                               // und Pinchange Interrupts wieder zulassen
-
     usiserial_readfinished= true;
     USISR |= 1 << USIOIF;                              // Interrupt quittieren
+
+#if (uart_fullduplex == 1)
+    GIFR = 1 << PCIF0;                                 // Pinchange Interrupt Flag quittieren
+    GIMSK |= 1 << PCIE0;                               // und Pinchange Interrupts wieder zulassen
+#else
+    if (txfifo_tail != txfifo_head)                    // waehrend des Empfangs eingetragene
+    {                                                  // Zeichen jetzt senden
+      uart_func= TXD;
+      usiserial_start_tx(txfifo[txfifo_tail]);
+      txfifo_tail= (txfifo_tail + 1) & (uart_txfifo_size - 1);
+    }
+    else
+    {
+      GIFR = 1 << PCIF0;                               // Pinchange Interrupt Flag quittieren
+      GIMSK |= 1 << PCIE0;                             // und Pinchange Interrupts wieder zulassen
+    }
+#endif
   }
 
   sei();
@@ -333,6 +602,21 @@ void uart_init()
   GIMSK |= 1 << PCIE0;              // Enable pin change interrupts (PCINT0--PCINT7)
   PCMSK0 |= 1 << USI_PCINT;         // Enable pin change on pin PA6
 
+#if (RX_FASTSTART == 1)
+  rx_timerinit();
+#endif
+
+#if (uart_fullduplex == 1)
+  // Timer1 als Bittakt fuer den Sender, OC1B (PA5) zunaechst auf high zwingen
+  TIMSK1 &= ~(1 << OCIE1A);
+  TCCR1A = TX_OC1B_SET;
+  TCCR1C = 1 << FOC1B;
+  TCCR1B = (1 << WGM12) | (1 << CS10);  // CTC, Prescaler 1
+  OCR1A = TX_BIT_TICKS;
+  OCR1B = TX_BIT_TICKS;             // Pegelwechsel zeitgleich mit dem Compare A Interrupt
+  TCNT1 = 0;
+#endif
+
   sei();
 }
 
@@ -342,14 +626,64 @@ void uart_init()
      schreibt ein Zeichen auf der USI-Schnittstelle, die als UART
      konfiguriert ist. TxD ist Anschluss D0 (entspricht wirklich
      MISO Anschluss der SPI Schnittstelle)
+
+     Das Zeichen wird in den Sendepuffer geschrieben, gewartet wird
+     nur, wenn der Puffer voll ist.
    ------------------------------------------------------------------ */
 void uart_putchar(char c)
 {
-  uart_func= TXD;
-  while (!usiserial_send_available());
-  usiserial_send_byte(c);
-  while (!usiserial_send_available());
-  uart_func= RXD;
+  uint8_t h, next;
+
+  h= txfifo_head;
+  next= (h + 1) & (uart_txfifo_size - 1);
+  while (next == txfifo_tail);                          // Puffer voll: warten
+
+  txfifo[h]= c;
+  txfifo_head= next;
+  uart_txkick();
+}
+
+/* ------------------------------------------------------------------
+                              uart_write
+
+     schreibt bis zu len Zeichen in den Sendepuffer ohne zu warten.
+     Zeichen, die keinen Platz mehr finden, werden in uart_txover-
+     flow gezaehlt.
+
+     Rueckgabe: Anzahl der uebernommenen Zeichen
+   ------------------------------------------------------------------ */
+uint8_t uart_write(const uint8_t *buf, uint8_t len)
+{
+  uint8_t h, next, anz;
+
+  h= txfifo_head;
+  for (anz= 0; anz< len; anz++)
+  {
+    next= (h + 1) & (uart_txfifo_size - 1);
+    if (next == txfifo_tail) break;
+    txfifo[h]= *buf++;
+    h= next;
+  }
+  txfifo_head= h;
+  uart_txoverflow += len - anz;
+  uart_txkick();
+
+  return anz;
+}
+
+/* ------------------------------------------------------------------
+                              uart_txflush
+
+     wartet, bis der Sendepuffer leer und das letzte Zeichen
+     gesendet ist
+   ------------------------------------------------------------------ */
+void uart_txflush(void)
+{
+#if (uart_fullduplex == 1)
+  while (TIMSK1 & (1 << OCIE1A));
+#else
+  while ((txfifo_tail != txfifo_head) || (!usiserial_send_available()));
+#endif
 }
 
 
@@ -369,7 +703,11 @@ uint8_t uart_getchar(void)
   serialdataready= false;
   ch= serialinput;
 
+#if (autobaud_enable == 1)
+  _delay_loop_2((uint16_t)(((uint32_t)rt_bit_cycles * 10) >> 2));   // 10 Bits warten (4 Takte je Schleife)
+#else
   _delay_us((100000 / (BAUDRATE / 100)));       // warten bis 10 Bits (Startbit, Stopbit, 8 Datenbits) eingelesen sind
+#endif
 
   return ch;
 }
@@ -385,3 +723,112 @@ uint8_t uart_ischar(void)
 {
   if (serialdataready) return 1; else return 0;
 }
+
+
+#if (autobaud_enable == 1)
+
+/* ------------------------------------------------------------------
+                             ab_waitlevel
+
+     wartet (mit Ueberlaufzaehlung von Timer0) bis RxD den Pegel
+     level besitzt
+
+     Rueckgabe: 0 = Zeitueberschreitung
+   ------------------------------------------------------------------ */
+static uint16_t ab_ovf;
+
+static uint8_t ab_waitlevel(uint8_t level)
+{
+  while ((USI_PIN & (1 << USI_DI)) != level)
+  {
+    if (TIFR0 & (1 << TOV0))
+    {
+      TIFR0 = 1 << TOV0;
+      ab_ovf++;
+      if (ab_ovf > AUTOBAUD_MAXOVF) return 0;
+    }
+  }
+  return 1;
+}
+
+/* ------------------------------------------------------------------
+                             uart_autobaud
+
+     automatische Baudratenerkennung: die Gegenstelle sendet das
+     Synchronisationszeichen 0x55 ('U'). Gemessen wird mit Timer0
+     (Prescaler 1) die Zeit von der fallenden Flanke des Startbits
+     bis zur fallenden Flanke von Bit 7 (= 8 Bitzeiten), daraus
+     werden Timer0 (Empfang und USI-Senden) bzw. Timer1 (Senden im
+     Vollduplex-Betrieb) neu eingestellt.
+
+     Die Funktion blockiert bis das Synchronisationszeichen einge-
+     troffen ist, der Sendepuffer sollte leer sein (uart_txflush).
+
+     Die Flanken werden abgefragt und nicht per Pinchange-Interrupt
+     vermessen: die Funktion blockiert ohnehin, und ohne Interrupt-
+     latenz schwankt der Zeitpunkt des Auslesens nicht.
+
+     Rueckgabe: Takte pro Bit (Baudrate = F_CPU / Rueckgabewert),
+                0 = Messung fehlgeschlagen, Einstellung unveraendert
+   ------------------------------------------------------------------ */
+uint16_t uart_autobaud(void)
+{
+  uint8_t  edge, div, ticks, wait;
+  uint16_t cyc;
+  uint32_t total;
+
+  GIMSK &= ~(1 << PCIE0);                               // Empfang waehrend der Messung sperren
+  TIMSK0 &= ~(1 << OCIE0A);
+  TCCR0A = 0;                                           // Normal mode
+  TCCR0B = 1;                                           // Prescaler 1
+
+  do
+  {
+    ab_ovf= 0;
+    ab_waitlevel(1 << USI_DI);                          // Ruhepegel abwarten
+    while (USI_PIN & (1 << USI_DI));                    // fallende Flanke Startbit
+    TCNT0 = 0;
+    TIFR0 = 1 << TOV0;
+    ab_ovf= 0;
+
+    for (edge= 4; edge; edge--)                         // 4 weitere fallende Flanken (Bit 1, 3, 5, 7)
+    {
+      if (!ab_waitlevel(1 << USI_DI)) break;
+      if (!ab_waitlevel(0)) break;
+    }
+  } while (edge);                                       // Zeitueberschreitung: neu versuchen
+
+  ticks= TCNT0;
+  if ((TIFR0 & (1 << TOV0)) && (ticks < 128)) ab_ovf++; // Ueberlauf waehrend des Auslesens
+  total= ((uint32_t)ab_ovf << 8) | ticks;
+
+  cyc= (total + 4) >> 3;                                // Takte pro Bit
+
+  // Timer0 Einstellungen berechnen und pruefen
+  if (cyc > 255) div= 8; else div= 1;
+  ticks= (cyc + div / 2) / div;
+  if ((cyc > 256 * 8) || (cyc / 2 < START_DELAY_FAST + div)) cyc= 0;
+  else
+  {
+    wait= (cyc / 2 - START_DELAY_FAST) / div;
+
+    rt_bit_cycles= cyc;
+    rt_bit_ocr= ticks - 1;
+    rt_rx_preload= rt_bit_ocr - wait;
+    rt_clockselect= (div == 8) ? 2 : 1;
+
+    #if (uart_fullduplex == 1)
+      OCR1A = cyc - 1;
+      OCR1B = cyc - 1;
+    #endif
+  }
+
+  ab_waitlevel(1 << USI_DI);                            // Stopbit des Synchronisationszeichens
+  rx_timerinit();
+  GIFR = 1 << PCIF0;
+  GIMSK |= 1 << PCIE0;
+
+  return cyc;
+}
+
+#endif
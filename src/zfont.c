@@ -0,0 +1,67 @@
+/* -----------------------------------------------------
+                        zfont.c
+
+    Decoder fuer komprimierte Zeichensaetze und Bitmaps
+    (Format siehe zfont.h)
+
+    Zeichensatz, Blocknummer und Beginn des zuletzt ge-
+    lesenen Blocks werden gemerkt. Die weiteren Bytes
+    desselben Blocks werden ohne Suche direkt aus der
+    Maske gelesen.
+
+    MCU   :  ATtiny44
+    Takt  :  8 MHz intern
+
+    17.10.2026   agent
+  ------------------------------------------------------ */
+
+#include "zfont.h"
+
+static const zfont_t *zf_font = 0;                    // zuletzt gelesener Zeichensatz
+static uint8_t zf_n;                                  // dto. Block
+static const uint8_t *zf_ptr;                         // Maskenbyte dieses Blocks
+
+/* -------------------------------------------------------
+                      zfont_getbyte
+
+     liefert Byte i des Blocks n
+   ------------------------------------------------------- */
+uint8_t zfont_getbyte(const zfont_t *font, uint8_t n, uint8_t i)
+{
+  const uint8_t  *p;
+  const uint16_t *index;
+  uint8_t        mask, k, b;
+
+  if ((font != zf_font) || (n != zf_n))
+  {
+    zf_font= font;
+    zf_n= n;
+
+    index= (const uint16_t *)pgm_read_word(&font->index);
+    p= (const uint8_t *)pgm_read_word(&font->data);
+    p += pgm_read_word(&index[n >> 3]);
+
+    for (n &= 7; n; n--)                              // vorhergehende Bloecke ueberspringen
+    {
+      mask= pgm_read_byte(p++);
+      for (k= 8; k; k--)
+      {
+        if (!(mask & 1)) p++;
+        mask >>= 1;
+      }
+    }
+    zf_ptr= p;
+  }
+
+  p= zf_ptr;
+  mask= pgm_read_byte(p++);
+  b= 0;
+  i= (i + 1) & 7;                                     // Byte 7 steht vor Byte 0
+  do
+  {
+    if (!(mask & 1)) b= pgm_read_byte(p++);
+    mask >>= 1;
+  } while (i--);
+
+  return b;
+}
@@ -0,0 +1,69 @@
+/* -------------------------------------------------
+     zfont8x8.c
+
+     komprimierter Zeichensatz fuer zfont.c,
+     erzeugt mit fontcomp aus ../src/font8x8.c
+
+     Zeichen       : 32..132 (Block n = Zeichen - 32)
+     unkomprimiert : 808 Bytes
+     komprimiert   : 587 Bytes (inkl. Index)
+   ------------------------------------------------- */
+
+#include "zfont.h"
+
+static const uint16_t PROGMEM zfont8x8_index[] = {
+      0,    41,    82,   136,   188,   236,   278,   320, 
+    363,   409,   444,   486,   530
+};
+
+static const uint8_t PROGMEM zfont8x8_data[] = {
+  0xff, 0x3d, 0x18, 0x00, 0x18, 0xed, 0x6c, 0x00, 0x85, 0x6c, 0xfe, 0x6c, 
+  0xfe, 0x6c, 0x01, 0x18, 0x3e, 0x58, 0x3c, 0x1a, 0x7c, 0x18, 0x03, 0x63, 
+  0x66, 0x0c, 0x18, 0x33, 0x63, 0x01, 0x1c, 0x36, 0x1c, 0x3b, 0x6e, 0x66, 
+  0x3b, 0xe5, 0x18, 0x30, 0x00, 0x31, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x31, 
+  0x30, 0x18, 0x0c, 0x18, 0x30, 0x03, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 
+  0x4b, 0x18, 0x7e, 0x18, 0x00, 0xbc, 0x30, 0x00, 0x18, 0xcf, 0x7e, 0x00, 
+  0xbf, 0x18, 0x01, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x01, 0x7c, 
+  0xc6, 0xce, 0xd6, 0xe6, 0xc6, 0x7c, 0xf1, 0x18, 0x38, 0x18, 0x01, 0x3c, 
+  0x66, 0x06, 0x0c, 0x18, 0x30, 0x7e, 0x01, 0x3c, 0x66, 0x06, 0x1c, 0x06, 
+  0x66, 0x3c, 0x81, 0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x21, 0x7e, 0x60, 
+  0x7c, 0x06, 0x66, 0x3c, 0x41, 0x3c, 0x66, 0x60, 0x7c, 0x66, 0x3c, 0xc9, 
+  0x7e, 0x06, 0x0c, 0x18, 0x49, 0x3c, 0x66, 0x3c, 0x66, 0x3c, 0x09, 0x3c, 
+  0x66, 0x3e, 0x0c, 0x18, 0x30, 0x97, 0x18, 0x00, 0x18, 0xa4, 0x30, 0x00, 
+  0x18, 0x00, 0x18, 0x01, 0x0c, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0c, 0x27, 
+  0x7e, 0x00, 0x7e, 0x00, 0x01, 0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 
+  0x01, 0x3c, 0x66, 0x06, 0x0c, 0x18, 0x00, 0x18, 0x31, 0x7c, 0xc6, 0xde, 
+  0xc0, 0x7c, 0x91, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x49, 0xfc, 0xc6, 0xfc, 
+  0xc6, 0xfc, 0x31, 0x3c, 0x66, 0xc0, 0x66, 0x3c, 0x31, 0xf8, 0xcc, 0xc6, 
+  0xcc, 0xf8, 0x49, 0xfe, 0xc0, 0xf8, 0xc0, 0xfe, 0xc9, 0xfe, 0xc0, 0xf8, 
+  0xc0, 0x11, 0x3c, 0x66, 0xc0, 0xce, 0x66, 0x3e, 0xcd, 0xc6, 0xfe, 0xc6, 
+  0x79, 0x78, 0x30, 0x78, 0x5d, 0x06, 0xc6, 0x7c, 0x01, 0xf6, 0xcc, 0xd8, 
+  0xf0, 0xd8, 0xcc, 0xc6, 0x7d, 0xc0, 0xfe, 0xc1, 0xc6, 0xee, 0xfe, 0xd6, 
+  0xc6, 0x81, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x31, 0x38, 0x6c, 0xc6, 
+  0x6c, 0x38, 0xc9, 0xfc, 0xc6, 0xfc, 0xc0, 0x11, 0x38, 0x6c, 0xc6, 0xda, 
+  0x6c, 0x36, 0x89, 0xfc, 0xc6, 0xfc, 0xcc, 0xc6, 0x01, 0x7c, 0xc6, 0xc0, 
+  0x7c, 0x06, 0xc6, 0x7c, 0xf9, 0xfc, 0x30, 0x7d, 0xc6, 0x7c, 0x3d, 0xc6, 
+  0x6c, 0x38, 0x0d, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x85, 0xc6, 0x6c, 0x38, 
+  0x6c, 0xc6, 0xcd, 0x66, 0x3c, 0x18, 0x01, 0xfe, 0x06, 0x0c, 0x18, 0x30, 
+  0x60, 0xfe, 0x79, 0x3c, 0x30, 0x3c, 0x01, 0xc0, 0x60, 0x30, 0x18, 0x0c, 
+  0x06, 0x02, 0x79, 0x3c, 0x0c, 0x3c, 0xc1, 0x08, 0x1c, 0x36, 0x63, 0x00, 
+  0xfc, 0xff, 0x00, 0xe1, 0x30, 0x18, 0x0c, 0x00, 0x07, 0x7c, 0x06, 0x7e, 
+  0xc6, 0x7e, 0x65, 0xc0, 0xfc, 0xc6, 0xfc, 0x07, 0x7c, 0xc6, 0xc0, 0xc6, 
+  0x7c, 0x65, 0x06, 0x7e, 0xc6, 0x7e, 0x07, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c, 
+  0xc1, 0x3c, 0x66, 0x60, 0xf8, 0x60, 0x24, 0xfc, 0x00, 0x7e, 0xc6, 0x7e, 
+  0x06, 0xe5, 0xc0, 0xfc, 0xc6, 0xf1, 0x18, 0x00, 0x18, 0x70, 0x78, 0x0c, 
+  0x00, 0x0c, 0xcc, 0x05, 0xc0, 0xc6, 0xcc, 0xf8, 0xcc, 0xc6, 0xfd, 0x18, 
+  0x87, 0x6c, 0xfe, 0xd6, 0xc6, 0xe7, 0xfc, 0xc6, 0x67, 0x7c, 0xc6, 0x7c, 
+  0x24, 0xc0, 0x00, 0xfc, 0xc6, 0xfc, 0xc0, 0x24, 0x06, 0x00, 0x7e, 0xc6, 
+  0x7e, 0x06, 0xc7, 0xfc, 0xc6, 0xc0, 0x07, 0x7c, 0xc0, 0x7c, 0x06, 0xfc, 
+  0x25, 0x60, 0xfc, 0x60, 0x66, 0x3c, 0x77, 0xc6, 0x7e, 0x37, 0xc6, 0x6c, 
+  0x38, 0x17, 0xc6, 0xd6, 0xfe, 0x6c, 0x07, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 
+  0x34, 0xfc, 0x00, 0xc6, 0x7e, 0x06, 0x07, 0x7e, 0x0c, 0x18, 0x30, 0x7e, 
+  0x49, 0x0e, 0x18, 0x70, 0x18, 0x0e, 0xcd, 0x18, 0x00, 0x18, 0x49, 0x70, 
+  0x18, 0x0e, 0x18, 0x70, 0xf1, 0x32, 0x4c, 0x00, 0x43, 0x18, 0x3c, 0x66, 
+  0xc3, 0xff, 0xfe, 0xff, 0xc9, 0x70, 0xd8, 0x70, 0x00, 0x01, 0x38, 0x44, 
+  0x82, 0x44, 0x28, 0xaa, 0xee, 0x34, 0xc0, 0x00, 0x66, 0x7c, 0x60, 0x23, 
+  0x08, 0x0c, 0x7e, 0x0c, 0x08
+};
+
+const zfont_t PROGMEM zfont8x8 = { zfont8x8_index, zfont8x8_data };
@@ -0,0 +1,70 @@
+/* -------------------------------------------------
+     zfont8x8h.c
+
+     komprimierter Zeichensatz fuer zfont.c,
+     erzeugt mit fontcomp aus ../src/font8x8h.c
+
+     Zeichen       : 32..130 (Block n = Zeichen - 32)
+     unkomprimiert : 792 Bytes
+     komprimiert   : 600 Bytes (inkl. Index)
+   ------------------------------------------------- */
+
+#include "zfont.h"
+
+static const uint16_t PROGMEM zfont8x8h_index[] = {
+      0,    44,    83,   133,   177,   226,   271,   321, 
+    370,   417,   460,   509,   555
+};
+
+static const uint8_t PROGMEM zfont8x8h_data[] = {
+  0xff, 0xaf, 0xfa, 0x00, 0x4b, 0xe0, 0x00, 0xe0, 0x00, 0x49, 0x28, 0xfe, 
+  0x28, 0xfe, 0x28, 0x23, 0x24, 0x54, 0xfe, 0x54, 0x48, 0x00, 0x46, 0x00, 
+  0x62, 0x66, 0x0c, 0x18, 0x30, 0x66, 0x00, 0x12, 0x00, 0x0c, 0x5e, 0xf2, 
+  0xba, 0xec, 0x5e, 0x87, 0x20, 0xe0, 0xc0, 0x00, 0x07, 0x38, 0x7c, 0xc6, 
+  0x82, 0x00, 0x07, 0x82, 0xc6, 0x7c, 0x38, 0x00, 0x22, 0x10, 0x54, 0x7c, 
+  0x38, 0x7c, 0x54, 0xab, 0x10, 0x7c, 0x10, 0xaf, 0x06, 0x00, 0xfb, 0x10, 
+  0xaf, 0x06, 0x00, 0x01, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x01, 
+  0x7c, 0xfe, 0x8a, 0x92, 0xa2, 0xfe, 0x7c, 0xa7, 0x40, 0xfe, 0x00, 0x03, 
+  0x42, 0xc6, 0x8e, 0x9a, 0xf2, 0x62, 0x23, 0x44, 0xc6, 0x92, 0xfe, 0x6c, 
+  0x41, 0x18, 0x38, 0x68, 0xc8, 0xfe, 0x08, 0x23, 0xe4, 0xe6, 0xa2, 0xbe, 
+  0x9c, 0x23, 0x7c, 0xfe, 0x92, 0xde, 0x4c, 0x0b, 0x80, 0x8e, 0x9e, 0xf0, 
+  0xe0, 0x23, 0x6c, 0xfe, 0x92, 0xfe, 0x6c, 0x03, 0x60, 0xf2, 0x96, 0x9c, 
+  0xf8, 0x70, 0xaf, 0x36, 0x00, 0x87, 0x80, 0xb6, 0x36, 0x00, 0x03, 0x10, 
+  0x38, 0x6c, 0xc6, 0x82, 0x00, 0xfb, 0x24, 0x03, 0x82, 0xc6, 0x6c, 0x38, 
+  0x10, 0x00, 0x03, 0x40, 0xc0, 0x8a, 0x9a, 0xf0, 0x60, 0x21, 0x7c, 0xfe, 
+  0x82, 0xba, 0xfa, 0x78, 0x01, 0x3e, 0x7e, 0xc8, 0x88, 0xc8, 0x7e, 0x3e, 
+  0x35, 0xfe, 0x92, 0xfe, 0x6c, 0x21, 0x38, 0x7c, 0xc6, 0x82, 0xc6, 0x44, 
+  0x15, 0xfe, 0x82, 0xc6, 0x7c, 0x38, 0xb5, 0xfe, 0x92, 0x82, 0xb5, 0xfe, 
+  0x90, 0x80, 0x01, 0x38, 0x7c, 0xc6, 0x82, 0x8a, 0xce, 0x4e, 0xb5, 0xfe, 
+  0x10, 0xfe, 0x93, 0x82, 0xfe, 0x82, 0x00, 0x31, 0x0c, 0x0e, 0x02, 0xfe, 
+  0xfc, 0x05, 0xfe, 0x90, 0xb8, 0x6c, 0xc6, 0x82, 0xf5, 0xfe, 0x02, 0x85, 
+  0xfe, 0x60, 0x30, 0x60, 0xfe, 0x85, 0xfe, 0x60, 0x30, 0x18, 0xfe, 0x01, 
+  0x38, 0x7c, 0xc6, 0x82, 0xc6, 0x7c, 0x38, 0x35, 0xfe, 0x90, 0xf0, 0x60, 
+  0x01, 0x38, 0x7c, 0xc6, 0x8a, 0xcc, 0x76, 0x3a, 0x15, 0xfe, 0x90, 0x98, 
+  0xfe, 0x66, 0x31, 0x64, 0xf6, 0x92, 0xde, 0x4c, 0x55, 0x80, 0xfe, 0x80, 
+  0x00, 0x31, 0xfc, 0xfe, 0x02, 0xfe, 0xfc, 0x01, 0xf8, 0xfc, 0x06, 0x02, 
+  0x06, 0xfc, 0xf8, 0x85, 0xfe, 0x0c, 0x18, 0x0c, 0xfe, 0x01, 0xc6, 0xee, 
+  0x38, 0x10, 0x38, 0xee, 0xc6, 0x23, 0xe0, 0xf0, 0x1e, 0xf0, 0xe0, 0x01, 
+  0x82, 0x86, 0x8e, 0x9a, 0xb2, 0xe2, 0xc2, 0x57, 0xfe, 0x82, 0x00, 0x01, 
+  0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x57, 0x82, 0xfe, 0x00, 0x00, 
+  0x10, 0x00, 0x10, 0x30, 0x60, 0xc0, 0x60, 0x30, 0xfe, 0x01, 0x07, 0x80, 
+  0xc0, 0x60, 0x20, 0x00, 0x31, 0x04, 0x2e, 0x2a, 0x3e, 0x1e, 0x35, 0xfe, 
+  0x22, 0x3e, 0x1c, 0x31, 0x1c, 0x3e, 0x22, 0x36, 0x14, 0xb1, 0x1c, 0x3e, 
+  0x22, 0xfe, 0x31, 0x1c, 0x3e, 0x2a, 0x3a, 0x18, 0x21, 0x10, 0x7e, 0xfe, 
+  0x90, 0xc0, 0x40, 0x31, 0x19, 0x3d, 0x25, 0x3f, 0x3e, 0x35, 0xfe, 0x20, 
+  0x3e, 0x1e, 0xaf, 0xbe, 0x00, 0x11, 0x02, 0x03, 0x01, 0xbf, 0xbe, 0x00, 
+  0x15, 0xfe, 0x08, 0x1c, 0x36, 0x22, 0xaf, 0xfe, 0x00, 0x01, 0x1e, 0x3e, 
+  0x30, 0x18, 0x30, 0x3e, 0x1e, 0x35, 0x3e, 0x20, 0x3e, 0x1e, 0x31, 0x1c, 
+  0x3e, 0x22, 0x3e, 0x1c, 0x35, 0x3f, 0x24, 0x3c, 0x18, 0xb1, 0x18, 0x3c, 
+  0x24, 0x3f, 0x35, 0x3e, 0x20, 0x30, 0x10, 0x31, 0x12, 0x3a, 0x2a, 0x2e, 
+  0x04, 0x21, 0x20, 0xfc, 0xfe, 0x22, 0x26, 0x04, 0xb1, 0x3c, 0x3e, 0x02, 
+  0x3e, 0x01, 0x38, 0x3c, 0x06, 0x02, 0x06, 0x3c, 0x38, 0x01, 0x3c, 0x3e, 
+  0x06, 0x0c, 0x06, 0x3e, 0x3c, 0x01, 0x22, 0x36, 0x1c, 0x08, 0x1c, 0x36, 
+  0x22, 0x31, 0x39, 0x3d, 0x05, 0x3f, 0x3e, 0x03, 0x22, 0x26, 0x2e, 0x3a, 
+  0x32, 0x22, 0x8b, 0x10, 0x7c, 0xee, 0x82, 0xaf, 0xee, 0x00, 0x8b, 0x82, 
+  0xee, 0x7c, 0x10, 0x53, 0x40, 0x80, 0x40, 0x80, 0x22, 0x0e, 0x1e, 0x32, 
+  0x62, 0x32, 0x1e, 0xfe, 0xff, 0xc9, 0x70, 0xd8, 0x70, 0x00, 0x01, 0x38, 
+  0x44, 0x82, 0x44, 0x28, 0xaa, 0xee
+};
+
+const zfont_t PROGMEM zfont8x8h = { zfont8x8h_index, zfont8x8h_data };
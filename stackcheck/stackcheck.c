@@ -0,0 +1,516 @@
+/* ----------------------------------------------------------
+                         stackcheck.c
+
+     statische Stackanalyse: liest die von avr-gcc mit
+     -fcallgraph-info=su erzeugten .ci Dateien (Aufruf-
+     graph und Stackbedarf je Funktion) aller Module eines
+     Programms und ermittelt den groessten Stackbedarf von
+     main und den Interruptroutinen (__vector_n).
+
+     Zusammen mit dem statischen RAM (.data + .bss) wird
+     der Gesamtbedarf mit dem RAM-Budget verglichen, bei
+     Ueberschreitung endet stackcheck mit Rueckgabewert 1
+     (und das Makefile mit einem Fehler).
+
+     Annahmen:
+       - Interrupts sind nicht verschachtelt, es kommt
+         also hoechstens eine Interruptroutine zum Stack
+         von main hinzu
+       - jeder Aufruf legt zusaetzlich zum Rahmen der
+         Funktion die Ruecksprungadresse ab (-c)
+
+     Aufrufe ueber Funktionszeiger fuehren im Aufrufgraph
+     nur zum Platzhalter __indirect_call, welche Funk-
+     tionen dahinter stehen, steht nicht in den .ci Da-
+     teien. Die moeglichen Ziele werden mit -i angegeben,
+     ohne -i und ohne -x endet stackcheck bei einem er-
+     reichbaren Funktionszeigeraufruf mit einem Fehler.
+
+     17.10.2026    agent
+   ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+
+#define MAXNODES        1024
+#define MAXEDGES        4096
+#define MAXNAME         96
+
+#define MAXTARGETS      32
+
+#define SU_UNKNOWN      -1                // Funktion ohne Angabe (extern, Bibliothek)
+#define INDIRECT        "__indirect_call" // Platzhalter fuer Aufrufe ueber Funktionszeiger
+
+struct node
+{
+  char     title[MAXNAME];                // Name im Aufrufgraph (static: datei.c:name)
+  int      su;                            // Stackrahmen in Bytes
+  int      dynamic;                       // 1 : Rahmen mit variabler Groesse (alloca, VLA)
+  int      worst;                         // max. Stackbedarf inkl. aufgerufener Funktionen
+  int      next;                          // Funktion auf dem unguenstigsten Pfad
+  int      state;                         // 0 : nicht berechnet, 1 : in Berechnung, 2 : fertig
+};
+
+struct edge
+{
+  int      from, to;
+};
+
+struct node nodes[MAXNODES];
+struct edge edges[MAXEDGES];
+int         nodeanz= 0;
+int         edgeanz= 0;
+
+int         retbytes= 2;                  // Ruecksprungadresse je Aufruf
+int         unknownbytes= 0;              // angenommener Bedarf unbekannter Funktionen
+int         unknownset= 0;                // 1 : -x angegeben
+int         recursion= 0;
+
+char       *targets[MAXTARGETS];          // Ziele von Funktionszeigern (-i)
+int         targetanz= 0;
+int         indnode= -1;                  // Knoten __indirect_call
+
+/* ----------------------------------------------------------
+                           readfile
+     liest eine Datei vollstaendig in den Speicher
+   ---------------------------------------------------------- */
+char *readfile(char *fname)
+{
+  FILE *f;
+  long len;
+  char *buf;
+
+  f= fopen(fname, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  len= ftell(f);
+  fseek(f, 0, SEEK_SET);
+  buf= malloc(len + 1);
+  if (buf)
+  {
+    len= fread(buf, 1, len, f);
+    buf[len]= 0;
+  }
+  fclose(f);
+  return buf;
+}
+
+/* ----------------------------------------------------------
+                           getfield
+     sucht in einem Block { ... } das Feld key: "..." und
+     kopiert dessen Inhalt nach dest. Rueckgabe 0, wenn das
+     Feld nicht vorhanden ist.
+   ---------------------------------------------------------- */
+int getfield(char *block, char *end, char *key, char *dest, int maxlen)
+{
+  char *p;
+  int  i;
+
+  p= strstr(block, key);
+  if (!p || p > end) return 0;
+  p= strchr(p, '"');
+  if (!p || p > end) return 0;
+  p++;
+  for (i= 0; *p && *p != '"' && i < maxlen-1; i++) dest[i]= *p++;
+  dest[i]= 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------
+                           findnode
+     liefert den Index einer Funktion, legt sie bei Bedarf
+     (mit unbekanntem Stackbedarf) an
+   ---------------------------------------------------------- */
+int findnode(char *title)
+{
+  int i;
+
+  for (i= 0; i< nodeanz; i++)
+    if (!strcmp(nodes[i].title, title)) return i;
+
+  if (nodeanz >= MAXNODES)
+  {
+    fprintf(stderr, "\n zu viele Funktionen (max. %d)\n", MAXNODES);
+    exit(2);
+  }
+  strncpy(nodes[nodeanz].title, title, MAXNAME-1);
+  nodes[nodeanz].su= SU_UNKNOWN;
+  nodes[nodeanz].next= -1;
+  return nodeanz++;
+}
+
+/* ----------------------------------------------------------
+                           matchname
+     1, wenn title die Funktion name bezeichnet (static
+     Funktionen: datei.c:name)
+   ---------------------------------------------------------- */
+int matchname(char *title, char *name)
+{
+  int lt, ln;
+
+  if (!strcmp(title, name)) return 1;
+  lt= strlen(title);
+  ln= strlen(name);
+  return (lt > ln) && (title[lt-ln-1] == ':') && !strcmp(title + lt - ln, name);
+}
+
+/* ----------------------------------------------------------
+                           addedge
+   ---------------------------------------------------------- */
+void addedge(int from, int to)
+{
+  if (edgeanz >= MAXEDGES)
+  {
+    fprintf(stderr, "\n zu viele Aufrufe (max. %d)\n", MAXEDGES);
+    exit(2);
+  }
+  edges[edgeanz].from= from;
+  edges[edgeanz].to= to;
+  edgeanz++;
+}
+
+/* ----------------------------------------------------------
+                           resolveind
+     verbindet __indirect_call mit allen Funktionen, die
+     mit -i als Ziel angegeben sind. Rueckgabe 0, wenn ein
+     Ziel in keiner .ci Datei vorkommt.
+   ---------------------------------------------------------- */
+int resolveind(void)
+{
+  int i, n, found, anz;
+
+  indnode= findnode(INDIRECT);
+  if (!targetanz) return 1;
+
+  nodes[indnode].su= 0;                                  // Platzhalter hat keinen Rahmen
+  anz= nodeanz;
+  for (i= 0; i< targetanz; i++)
+  {
+    found= 0;
+    for (n= 0; n< anz; n++)
+    {
+      if (n == indnode || !matchname(nodes[n].title, targets[i])) continue;
+      addedge(indnode, n);
+      found= 1;
+    }
+    if (!found)
+    {
+      fprintf(stderr, "\n Ziel %s (-i) nicht gefunden\n", targets[i]);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------
+                           parseci
+     liest Knoten und Kanten einer .ci Datei. Ein Knoten
+
+       node: { title: "f" label: "f\ndatei.c:1:5\n12 bytes (static)" }
+
+     enthaelt den Stackrahmen nur, wenn die Funktion in
+     diesem Modul definiert ist.
+   ---------------------------------------------------------- */
+int parseci(char *fname)
+{
+  char *src, *p, *end, *b;
+  char title[MAXNAME], target[MAXNAME], label[256];
+  int  n, su;
+
+  src= readfile(fname);
+  if (!src) return 0;
+
+  p= src;
+  while (*p)
+  {
+    if (!strncmp(p, "node:", 5) || !strncmp(p, "edge:", 5))
+    {
+      end= strchr(p, '}');
+      if (!end) break;
+
+      if (p[0] == 'n')
+      {
+        if (getfield(p, end, "title:", title, MAXNAME))
+        {
+          n= findnode(title);
+          if (getfield(p, end, "label:", label, sizeof(label)))
+          {
+            // Stackangabe steht hinter dem letzten "\n" der Beschriftung
+            b= strstr(label, " bytes (");
+            if (b)
+            {
+              while (b > label && b[-1] >= '0' && b[-1] <= '9') b--;
+              su= atoi(b);
+              if (su > nodes[n].su) nodes[n].su= su;
+              if (strstr(b, "dynamic") && !strstr(b, "bounded")) nodes[n].dynamic= 1;
+            }
+          }
+        }
+      }
+      else
+      {
+        if (getfield(p, end, "sourcename:", title, MAXNAME) &&
+            getfield(p, end, "targetname:", target, MAXNAME))
+        {
+          addedge(findnode(title), findnode(target));
+        }
+      }
+      p= end;
+    }
+    p++;
+  }
+  free(src);
+  return 1;
+}
+
+/* ----------------------------------------------------------
+                           worst
+     groesster Stackbedarf einer Funktion einschliesslich
+     aller von ihr aufgerufenen Funktionen (Tiefensuche).
+     Der Aufruf ueber __indirect_call legt nur einmal eine
+     Ruecksprungadresse ab.
+   ---------------------------------------------------------- */
+int worst(int n)
+{
+  int i, w, own, ret;
+
+  if (nodes[n].state == 2) return nodes[n].worst;
+  if (nodes[n].state == 1)
+  {
+    fprintf(stderr, " Rekursion: %s\n", nodes[n].title);
+    recursion= 1;
+    return 0;
+  }
+
+  nodes[n].state= 1;
+  own= (nodes[n].su == SU_UNKNOWN) ? unknownbytes : nodes[n].su;
+  ret= (n == indnode) ? 0 : retbytes;
+  nodes[n].worst= own;
+  nodes[n].next= -1;
+
+  for (i= 0; i< edgeanz; i++)
+  {
+    if (edges[i].from != n) continue;
+    w= own + ret + worst(edges[i].to);
+    if (w > nodes[n].worst)
+    {
+      nodes[n].worst= w;
+      nodes[n].next= edges[i].to;
+    }
+  }
+  nodes[n].state= 2;
+  return nodes[n].worst;
+}
+
+/* ----------------------------------------------------------
+                           showpath
+     gibt den unguenstigsten Aufrufpfad ab Funktion n aus
+   ---------------------------------------------------------- */
+void showpath(int n)
+{
+  int  cnt;
+  char *name;
+
+  printf("      ");
+  for (cnt= 0; n >= 0 && cnt < 32; cnt++)
+  {
+    if (cnt)
+    {
+      printf(" ->");
+      if (!(cnt % 4)) printf("\n        ");
+      printf(" ");
+    }
+    name= strrchr(nodes[n].title, '/');                  // Pfad von static Funktionen weglassen
+    name= name ? name + 1 : nodes[n].title;
+    if (nodes[n].su == SU_UNKNOWN) printf("%s (?)", name);
+                              else printf("%s (%d)", name, nodes[n].su);
+    n= nodes[n].next;
+  }
+  printf("\n");
+}
+
+/* ----------------------------------------------------------
+                           show_help
+     gibt Syntaxmeldung aus
+   ---------------------------------------------------------- */
+void help_show(void)
+{
+  printf("  \nstackcheck 0.12");
+  printf("  \n Syntax: stackcheck [Optionen] datei.ci [datei.ci ...]");
+  printf("  \n    -r value     | RAM-Budget in Bytes (ohne Angabe: keine Pruefung)");
+  printf("  \n    -s value     | statischer RAM-Bedarf (.data + .bss) in Bytes");
+  printf("  \n    -c value     | Bytes je Ruecksprungadresse (Standard: 2)");
+  printf("  \n    -x value     | angenommener Stackbedarf von Funktionen ohne");
+  printf("  \n                 | Angabe, bspw. aus avr-libc (Standard: 0)");
+  printf("  \n    -i f1[,f2..] | moegliche Ziele von Aufrufen ueber Funktions-");
+  printf("  \n                 | zeiger (__indirect_call), mehrfach moeglich");
+  printf("  \n    -q           | nur Stackbedarf (main + Interrupt) in Bytes ausgeben");
+  printf("  \n    -h           | diese Anzeige (Help)");
+  printf("  \n");
+}
+
+/* ---------------------------------------------------------------------------
+                                    M A I N
+   --------------------------------------------------------------------------- */
+int main (int argc, char **argv)
+{
+  int  c, i, n, mainnode, isrnode, w, isrmax, total, budget, staticram, unknown, quiet;
+  char *t;
+
+  budget= -1;
+  staticram= 0;
+  quiet= 0;
+
+  // Kommandozeile auswerten
+  opterr= 0;
+
+  while ((c = getopt (argc, argv, "hqr:s:c:x:i:")) != -1)
+  {
+    switch (c)
+    {
+      case 'r' : budget= atoi(optarg); break;
+      case 's' : staticram= atoi(optarg); break;
+      case 'c' : retbytes= atoi(optarg); break;
+      case 'x' : unknownbytes= atoi(optarg); unknownset= 1; break;
+      case 'i' :
+      {
+        for (t= strtok(optarg, ","); t; t= strtok(NULL, ","))
+        {
+          if (targetanz >= MAXTARGETS)
+          {
+            fprintf(stderr, "\n zu viele Ziele (-i, max. %d)\n", MAXTARGETS);
+            return 2;
+          }
+          targets[targetanz++]= t;
+        }
+        break;
+      }
+      case 'q' : quiet= 1; break;
+      case 'h' :
+      {
+        help_show();
+        return -1;
+      }
+      default :
+      {
+        fprintf(stderr, "Unbekannte Option oder fehlender Parameter.\n");
+        help_show();
+        return 2;
+      }
+    }
+  }
+
+  if (optind >= argc)
+  {
+    help_show();
+    return -1;
+  }
+
+  for (i= optind; i< argc; i++)
+  {
+    if (!parseci(argv[i]))
+    {
+      fprintf(stderr, "\n Datei %s kann nicht gelesen werden (mit -fcallgraph-info=su uebersetzt?)\n", argv[i]);
+      return 2;
+    }
+  }
+  if (!resolveind()) return 2;
+
+  // main wird vom Startupcode aufgerufen, Interrupts legen den PC ab
+  mainnode= -1;
+  isrnode= -1;
+  isrmax= 0;
+  for (n= 0; n< nodeanz; n++)
+  {
+    if (!strcmp(nodes[n].title, "main")) mainnode= n;
+    if (!strncmp(nodes[n].title, "__vector_", 9) && nodes[n].su != SU_UNKNOWN)
+    {
+      w= retbytes + worst(n);
+      if (w > isrmax)
+      {
+        isrmax= w;
+        isrnode= n;
+      }
+    }
+  }
+  if (mainnode < 0)
+  {
+    fprintf(stderr, "\n Funktion main nicht gefunden\n");
+    return 2;
+  }
+  w= retbytes + worst(mainnode);
+  total= staticram + w + isrmax;
+
+  // Funktionszeiger ohne bekannte Ziele: Ergebnis waere nur ein Mindestwert
+  if (nodes[indnode].state == 2 && !targetanz && !unknownset)
+  {
+    fprintf(stderr, "\n Aufruf ueber Funktionszeiger in:");
+    for (n= 0; n< nodeanz; n++)
+    {
+      if (nodes[n].state != 2) continue;
+      for (i= 0; i< edgeanz; i++)
+        if (edges[i].from == n && edges[i].to == indnode) break;
+      if (i < edgeanz) fprintf(stderr, " %s", nodes[n].title);
+    }
+    fprintf(stderr, "\n moegliche Ziele mit -i angeben (oder Bedarf mit -x annehmen)\n");
+    return 1;
+  }
+
+  if (quiet)
+  {
+    printf("%d\n", w + isrmax);
+  }
+  else
+  {
+    printf("\n Stackanalyse (%d Module, %d Funktionen)\n\n", argc - optind, nodeanz);
+    printf("   statisch (.data + .bss)  : %4d Bytes\n", staticram);
+    printf("   main                     : %4d Bytes\n", w);
+    showpath(mainnode);
+    if (isrnode >= 0)
+    {
+      printf("   Interrupt (max.)         : %4d Bytes\n", isrmax);
+      showpath(isrnode);
+    }
+    printf("   ---------------------------------------\n");
+    if (budget >= 0)
+      printf("   gesamt                   : %4d von %d Bytes (frei: %d)\n", total, budget, budget - total);
+    else
+      printf("   gesamt                   : %4d Bytes\n", total);
+
+    // Hinweise auf unvollstaendige Angaben
+    unknown= 0;
+    for (n= 0; n< nodeanz; n++)
+    {
+      if (nodes[n].state != 2) continue;                   // nicht erreichbar
+      if (nodes[n].su == SU_UNKNOWN)
+      {
+        if (!unknown) printf("\n   ohne Angabe (mit %d Bytes gerechnet):", unknownbytes);
+        printf(" %s", nodes[n].title);
+        unknown++;
+      }
+    }
+    if (unknown) printf("\n");
+    for (n= 0; n< nodeanz; n++)
+    {
+      if (nodes[n].state == 2 && nodes[n].dynamic)
+        printf("   %s: Stackrahmen variabler Groesse, Angabe ist ein Mindestwert\n", nodes[n].title);
+    }
+    printf("\n");
+  }
+  fflush(stdout);
+
+  if (recursion)
+  {
+    fprintf(stderr, " Stackbedarf bei Rekursion nicht bestimmbar\n");
+    return 1;
+  }
+  if (budget >= 0 && total > budget)
+  {
+    fprintf(stderr, " RAM-Budget um %d Bytes ueberschritten\n", total - budget);
+    return 1;
+  }
+  return 0;
+}